@@ -0,0 +1,132 @@
+/**
+ * @brief  2頂点間の最短路問題におけるA*探索(A* search)と、
+ *         ランドマークと三角不等式による下界(ALT)の実装を行う
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <atomic>
+#include <algorithm>
+#include "../graph/parallel.hpp"
+#include "../graph/heap.hpp"
+#include "../graph/soa.hpp"
+#include "../dijkstra/dijkstra.hpp"
+#include "astar.hpp"
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+namespace {
+
+    /**
+     * @brief  ランドマークLを始点とするdijkstraを行い、距離表を埋める
+     * @note   仕事jはj < kならばG上でL_jからの距離をA.fromの列jに、そうでなければG^T上でL_(j-k)への距離をA.toの列j-kに書き込む
+     *         仕事は1つずつ取ってthreads本のスレッドで分担する. 各スレッドはSとQを1組だけ確保して使い回す
+     *         異なる仕事は異なる列に書き込むので、書き込みが競合することはない
+     *
+     * @param  bool with_from  A.fromも求めるか？(falseならばA.toだけを求める)
+     */
+    void landmark_tables(const csr_graph& G, const csr_graph& GT, alt_landmarks& A, bool with_from, unsigned threads)
+    {
+        const index_t n = G.size(), k = A.size();
+        const index_t first = with_from ? 0 : k, jobs = 2 * k;
+        threads = static_cast<unsigned>(std::min<std::size_t>(resolve_threads(threads), std::max<index_t>(jobs - first, 1)));
+
+        std::atomic<index_t> next(first);
+        parallel_run(threads, [&](unsigned) {
+            vertices_soa S;
+            dary_heap<4> Q(n);
+            for (index_t j; (j = next.fetch_add(1, std::memory_order_relaxed)) < jobs; ) {
+                bool forward = j < k;
+                index_t i = forward ? j : j - k;
+                dijkstra(forward ? G : GT, A.landmarks[i], S, Q);
+                array_t& table = forward ? A.from : A.to;
+                for (index_t v = 0; v < n; ++v) { table[static_cast<std::size_t>(v) * k + i] = S.d[v]; }
+            }
+        });
+    }
+
+}
+
+
+/**
+ * @brief  与えられたランドマークについて、ALTの距離表を求める
+ */
+alt_landmarks alt_preprocess(const csr_graph& G, const indices_t& landmarks, unsigned threads)
+{
+    const std::size_t n = G.size();
+    alt_landmarks A;
+    A.landmarks = landmarks;
+    A.from.assign(n * landmarks.size(), limits::inf);
+    A.to.assign(n * landmarks.size(), limits::inf);
+    landmark_tables(G, transpose(G), A, true, threads);
+    return A;
+}
+
+
+/**
+ * @brief  ALTの前処理として、最遠点挿入でk個のランドマークを選び、距離表を求める
+ * @note   すべての頂点がすでに選んだランドマークとの距離0になれば、k個に満たなくても選ぶのを止める
+ */
+alt_landmarks alt_preprocess(const csr_graph& G, index_t k, unsigned threads)
+{
+    const index_t n = G.size();
+    alt_landmarks A;
+    if (n == 0 || k <= 0) { return A; }
+
+    vertices_soa S;
+    dary_heap<4> Q(n);
+    std::vector<array_t> rows;  // rows[i][v] = δ(L_i, v)
+    dijkstra(G, 0, S, Q);
+    array_t key = S.d;          // 選んだランドマークからの距離の最小値(最初は頂点0からの距離)
+    for (index_t i = 0; i < k; ++i) {
+        index_t far = static_cast<index_t>(std::max_element(key.begin(), key.end()) - key.begin());
+        if (i > 0 && key[far] == 0) { break; }
+        A.landmarks.push_back(far);
+        dijkstra(G, far, S, Q);
+        rows.push_back(S.d);
+        for (index_t v = 0; v < n; ++v) { key[v] = i == 0 ? S.d[v] : std::min(key[v], S.d[v]); }
+    }
+
+    const std::size_t m = A.landmarks.size();
+    A.from.resize(static_cast<std::size_t>(n) * m);
+    A.to.assign(static_cast<std::size_t>(n) * m, limits::inf);
+    for (std::size_t i = 0; i < m; ++i) {
+        for (index_t v = 0; v < n; ++v) { A.from[static_cast<std::size_t>(v) * m + i] = rows[i][v]; }
+    }
+    landmark_tables(G, transpose(G), A, false, threads);
+    return A;
+}
+
+
+/**
+ * @brief  ALTのヒューリスティック関数を用いたA*探索
+ */
+weight_t astar(const csr_graph& G, index_t s, index_t t, const alt_landmarks& A, search_workspace& W)
+{
+    return astar(G, s, t, alt_heuristic{ A, t }, W);
+}
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
@@ -0,0 +1,211 @@
+/**
+ * @brief  2頂点間の最短路問題におけるA*探索(A* search)と、
+ *         ランドマークと三角不等式による下界(ALT : A*, landmarks, triangle inequality)の宣言を行う
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef ASTAR_HPP
+#define ASTAR_HPP
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "../graph/graph.hpp"
+#include "../graph/csr.hpp"
+#include "../graph/workspace.hpp"
+#include <algorithm>
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief  ALTの前処理で求めたランドマークの距離表
+ *
+ * @note   k個のランドマークL_0, ..., L_(k-1)について、各頂点vからの距離と各頂点vへの距離を頂点ごとに連続して並べる
+ *           from[v * k + i] = δ(L_i, v),  to[v * k + i] = δ(v, L_i)
+ *         1回の下界の計算で読むのは頂点vとtの2k要素ずつなので、kが小さければそれぞれ1本のキャッシュラインに収まる
+ *
+ * @note   三角不等式から、任意の頂点v, tとランドマークLについて
+ *           δ(v, t) >= δ(L, t) - δ(L, v),  δ(v, t) >= δ(v, L) - δ(t, L)
+ *         が成り立つ. これらの最大値をA*探索のヒューリスティック関数に用いる. この下界は無矛盾(consistent)である
+ */
+struct alt_landmarks {
+    indices_t landmarks;  /**< ランドマークの頂点 */
+    array_t   from;       /**< from[v * k + i] = δ(L_i, v) */
+    array_t   to;         /**< to[v * k + i] = δ(v, L_i) */
+
+    /**< @brief ランドマークの数kを返す */
+    index_t size() const { return static_cast<index_t>(landmarks.size()); }
+
+    /**
+     * @brief  δ(v, t)の下界を返す
+     * @note   vからtへの道がないことが距離表から分かるときはlimits::infを返す
+     *         (δ(L, v)が有限でδ(L, t)が∞のとき、またはδ(t, L)が有限でδ(v, L)が∞のとき、vからtへの道があるとすると矛盾する)
+     */
+    weight_t lower_bound(index_t v, index_t t) const
+    {
+        const index_t k = size();
+        const weight_t* fv = from.data() + static_cast<std::size_t>(v) * k;
+        const weight_t* ft = from.data() + static_cast<std::size_t>(t) * k;
+        const weight_t* tv = to.data()   + static_cast<std::size_t>(v) * k;
+        const weight_t* tt = to.data()   + static_cast<std::size_t>(t) * k;
+        weight_t h = 0;
+        for (index_t i = 0; i < k; ++i) {
+            if (fv[i] != limits::inf) {
+                if (ft[i] == limits::inf) { return limits::inf; }
+                h = std::max(h, ft[i] - fv[i]);
+            }
+            if (tt[i] != limits::inf) {
+                if (tv[i] == limits::inf) { return limits::inf; }
+                h = std::max(h, tv[i] - tt[i]);
+            }
+        }
+        return h;
+    }
+};
+
+
+/**
+ * @brief 終点tを固定したALTのヒューリスティック関数 h(v) = (δ(v, t)の下界)
+ */
+struct alt_heuristic {
+    const alt_landmarks& A;  /**< ランドマークの距離表 */
+    index_t              t;  /**< 終点t */
+
+    weight_t operator () (index_t v) const { return A.lower_bound(v, t); }
+};
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**
+ * @brief  A*探索により、始点sから終点tへの最短路重みδ(s, t)を求める
+ *
+ * @note   A*探索は、キーをv.d + h(v)としたDijkstraのアルゴリズムである. ここでh(v)はδ(v, t)の下界を与えるヒューリスティック関数であり、
+ *         h(v) <= δ(v, t)(許容的, admissible)ならば、tを取り出した時点でt.d = δ(s, t)である
+ *         さらにh(u) <= w(u, v) + h(v)(無矛盾, consistent)ならば、これは重みŵ(u, v) = w(u, v) - h(u) + h(v) >= 0のもとでの
+ *         Dijkstraのアルゴリズムと同じであり、各頂点は高々1回しか取り出されない. h = 0ならばdijkstra(G, s, t, W)と同じである
+ *
+ * @note   許容的だが無矛盾でないhに対しても正しく動くように、取り出し済みの頂点もd値が減ればキューに戻す
+ *         h(v) = limits::infならば、vからtへの道はないものとしてvをキューに置かない
+ *         道はW.path_to(t)で得られる. tに到達できなければlimits::infを返す
+ *
+ * @tparam Graph      グラフGの表現(graph_tまたはcsr_graph)
+ * @tparam Heuristic  ヒューリスティック関数の型. 頂点vに対してδ(v, t)の下界を返す関数オブジェクト h(v)
+ * @param  const Graph&      G  非負の重み付き有向グラフG
+ * @param  index_t           s  始点s
+ * @param  index_t           t  終点t
+ * @param  Heuristic         h  ヒューリスティック関数
+ * @param  search_workspace& W  作業領域
+ * @return 最短路重みδ(s, t)
+ */
+template<class Graph, class Heuristic>
+weight_t astar(const Graph& G, index_t s, index_t t, Heuristic h, search_workspace& W)
+{
+    W.resize(G.size());
+    W.paint(s, vcolor::gray);
+    W.d[s] = 0;
+    weight_t hs = h(s);
+    if (hs != limits::inf) { W.Q.push(s, hs); }
+    while (!W.Q.empty()) {
+        index_t u = W.Q.top().u; W.Q.pop();
+        W.paint(u, vcolor::black);
+        if (u == t) { break; }
+        for (auto&& e : G[u]) {
+            index_t v = e.dst;
+            W.touch(v);
+            if (W.d[v] <= W.d[u] + e.w) { continue; }
+            weight_t hv = h(v);
+            if (hv == limits::inf) { continue; }  // vからtへの道はない
+            W.d[v]  = W.d[u] + e.w;
+            W.pi[v] = u;
+            W.paint(v, vcolor::gray);
+            W.Q.push(v, W.d[v] + hv);
+        }
+    }
+    return W.color(t) == vcolor::black ? W.d[t] : limits::inf;
+}
+
+
+
+//****************************************
+// 関数の宣言
+//****************************************
+
+/**
+ * @brief  ALTの前処理として、k個のランドマークを選び、各ランドマークとの間の距離表を求める
+ *
+ * @note   ランドマークは最遠点挿入(farthest selection)で選ぶ. 頂点0からの距離が最大の頂点を最初のランドマークとし、以降は
+ *         すでに選んだランドマークからの距離の最小値が最大となる頂点を選ぶ(到達できない頂点があれば、それを優先する)
+ *         ランドマークからの距離δ(L_i, v)は選ぶ過程でGの上のdijkstraとして求まるが、次のランドマークはそれに依存するので逐次に求める
+ *         ランドマークへの距離δ(v, L_i)はG^Tの上のdijkstraで求め、ランドマークごとにthreads本のスレッドで分担する
+ *
+ * @param  const csr_graph&  G       非負の重み付き有向グラフG
+ * @param  index_t           k       ランドマークの数
+ * @param  unsigned          threads スレッド数(0ならばハードウェアの並列度)
+ * @return ランドマークの距離表
+ */
+alt_landmarks alt_preprocess(const csr_graph& G, index_t k, unsigned threads = 0);
+
+
+
+/**
+ * @brief  与えられたランドマークについて、ALTの距離表を求める
+ * @note   ランドマークからの距離と、ランドマークへの距離の2k回のdijkstraを、threads本のスレッドで分担する
+ *
+ * @param  const csr_graph&  G         非負の重み付き有向グラフG
+ * @param  const indices_t&  landmarks ランドマークの頂点
+ * @param  unsigned          threads   スレッド数(0ならばハードウェアの並列度)
+ * @return ランドマークの距離表
+ */
+alt_landmarks alt_preprocess(const csr_graph& G, const indices_t& landmarks, unsigned threads = 0);
+
+
+
+/**
+ * @brief  ALTのヒューリスティック関数を用いたA*探索により、始点sから終点tへの最短路重みδ(s, t)を求める
+ * @note   ヒューリスティック関数は無矛盾なので、各頂点は高々1回しか取り出されない. 道はW.path_to(t)で得られる
+ *
+ * @param  const csr_graph&      G  非負の重み付き有向グラフG(Aを求めたときと同じもの)
+ * @param  index_t               s  始点s
+ * @param  index_t               t  終点t
+ * @param  const alt_landmarks&  A  ランドマークの距離表
+ * @param  search_workspace&     W  作業領域
+ * @return 最短路重みδ(s, t)
+ */
+weight_t astar(const csr_graph& G, index_t s, index_t t, const alt_landmarks& A, search_workspace& W);
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
+
+
+
+#endif  // end of ASTAR_HPP
@@ -10,7 +10,13 @@
 //****************************************
 
 #include <iostream>
+#include <queue>
+#include <atomic>
+#include <algorithm>
+#include <cstdint>
 #include "../graph/relax.hpp"
+#include "../graph/parallel.hpp"
+#include "../graph/atomic_relax.hpp"
 #include "bellman_ford.hpp"
 
 
@@ -39,40 +45,307 @@ GRAPH_BEGIN
  *         アルゴリズムが値TRUEを返すのは、グラフの始点から到達可能な負閉路を含まないとき、かつそのときに限る
  *
  * @note   Bellman-FordアルゴリズムはΟ(VE)時間で走る
+ *         ただし、ある走査でどの辺の緩和もd値を変えなければ、その時点で終了する. 最短路が高々k本の辺からなるならば、走査はk + 1回で済む
  *
- * @param  const graph_t& G グラフG
- * @param  index_t        s 始点s
+ * @tparam Graph          グラフGの表現(graph_tまたはcsr_graph)
+ * @tparam Traits         添字と重みの型を与える特性(graph_traits)
+ * @param  const Graph& G グラフG
+ * @param  index_type   s 始点s
+ * @param  basic_vertices_soa<Traits>& V 始点sからの最短路重みを格納する頂点集合V
+ * @return 始点から到達可能な負閉路を含まないか？
  */
-std::pair<bool, vertices_t> bellman_ford(const graph_t& G, index_t s)
+template<class Graph, class Traits>
+static bool bellman_ford_impl(const Graph& G, typename Traits::index_type s, basic_vertices_soa<Traits>& V)
 {   
-    index_t n = G.size();
-    vertices_t V(n);
-    auto relax_pred = [] (const vertices_t& V, index_t u) -> bool { return V[u].d != limits::inf; };
+    using index_type = typename Traits::index_type;
+    index_type n = G.size();
+    V.resize(n);
+    auto relax_pred = [] (const basic_vertices_soa<Traits>& V, index_type u) -> bool { return V.d[u] != Traits::inf(); };
 
     
     initialize_single_source(V, s);  // すべての頂点のd値とπ値を初期化する
     // アルゴリズムはグラフのすべての辺を|V| - 1回走査する
-    for (index_t i = 0; i < n - 1; ++i) {
-        for (auto&& es : G) { for (auto&& e : es) {
-                relax(V, e, relax_pred);  // グラフの各辺をそれぞれ1回緩和する
+    for (index_type i = 0; i < n - 1; ++i) {
+        bool changed = false;
+        for (index_type u = 0; u < n; ++u) { for (auto&& e : G[u]) {
+                changed |= relax(V, e, relax_pred);  // グラフの各辺をそれぞれ1回緩和する
             }
         }
+        // 1回の走査でどのd値も変わらなければ、以降の走査でも変わらない. このときすべての辺(u, v)についてv.d <= u.d + w(u, v)なので、
+        // 負閉路の判定も不要である
+        if (!changed) { return true; }
     }
     // Gがsから到達可能な負閉路を含まなければ、終了時に、すべての辺(u, v)に対して、
     //   u.d = δ(s, v)
     //      <= δ(s, u) + w(u, v) (∵ 三角不等式)
     //       = u.d + w(u, v)
     // だから、BELLMAN-FORDは値FALSEを返すことはなく、TRUEを返す
-    for (auto&& es : G) { for (auto&& e : es) {               // 負の重みを持つ閉路の有無を判定する
-            index_t v = e.dst, u = e.src;
-            if (V[u].d != limits::inf && V[v].d > V[u].d + e.w) {  // Gが始点sから到達可能な負閉路を含むとき、
-                return std::make_pair(false, V);       // FALSEを返す
+    for (index_type i = 0; i < n; ++i) { for (auto&& e : G[i]) {  // 負の重みを持つ閉路の有無を判定する
+            index_type v = e.dst, u = e.src;
+            if (V.d[u] != Traits::inf() && V.d[v] > V.d[u] + e.w) {  // Gが始点sから到達可能な負閉路を含むとき、
+                return false;                                    // FALSEを返す
             }
         }
     }
     // Gがsから到達可能な負閉路を含まなければ、値TRUEを返し、すべての頂点v ∈ Vに対してδ(s, v)が成り立ち、
     // 先行点部分グラフGπはsを根とする最短路木である
-    return std::make_pair(true, V);
+    return true;
+}
+
+
+/**
+ * @brief  キューを用いるBellman-Fordアルゴリズム(SPFA)
+ *
+ * @note   d値が変わった頂点から出る辺だけを緩和すれば十分である. d値が減った頂点をFIFOキューQに置き(すでに置かれていれば置かない)、
+ *         Qから取り出した頂点uから出る辺をすべて緩和することを、Qが空になるまで繰り返す
+ *
+ * @note   負閉路の判定には、各頂点vのd値を与えた歩道の辺数len[v]を用いる. (u, v)の緩和でv.dが減ったときlen[v] = len[u] + 1とする
+ *         len[v] >= |V|ならばその歩道はある頂点を2回通るが、d値は単調に減るので、その間の閉路の重みは負である
+ *         逆に、sから到達可能な負閉路があればd値は際限なく減り、いずれlen[v] >= |V|となる
+ *
+ * @note   最悪実行時間はΟ(VE)であるが、最短路の辺数が少ないグラフではほぼ線形時間で終了する
+ */
+template<class Graph, class Traits>
+static bool bellman_ford_queue_impl(const Graph& G, typename Traits::index_type s, basic_vertices_soa<Traits>& V)
+{
+    using index_type = typename Traits::index_type;
+    index_type n = G.size();
+    V.resize(n);
+    initialize_single_source(V, s);
+
+    std::vector<index_type> len(n, 0);       // v.dを与えた歩道の辺数
+    std::vector<std::uint8_t> queued(n, 0);  // vがQに置かれているか？
+    std::queue<index_type> Q;
+    Q.push(s); queued[s] = 1;
+    while (!Q.empty()) {
+        index_type u = Q.front(); Q.pop();
+        queued[u] = 0;
+        for (auto&& e : G[u]) {
+            index_type v = e.dst;
+            if (V.d[v] <= V.d[u] + e.w) { continue; }
+            V.d[v] = V.d[u] + e.w; V.pi[v] = u;   // 緩和し、
+            if ((len[v] = len[u] + 1) >= n) { return false; }  // 歩道が|V|本以上の辺を含めば、負閉路がある
+            if (!queued[v]) { Q.push(v); queued[v] = 1; }       // vがQになければQの末尾に置く
+        }
+    }
+    return true;
+}
+
+
+/**< @brief 隣接リスト表現のグラフGに対してBellman-Fordアルゴリズムを実行する */
+std::pair<bool, vertices_t> bellman_ford(const graph_t& G, index_t s)
+{
+    vertices_soa V;
+    bool ok = bellman_ford_impl(G, s, V);
+    return std::make_pair(ok, V.to_vertices());
+}
+
+
+/**< @brief CSR表現のグラフGに対してBellman-Fordアルゴリズムを実行する */
+std::pair<bool, vertices_t> bellman_ford(const csr_graph& G, index_t s)
+{
+    vertices_soa V;
+    bool ok = bellman_ford_impl(G, s, V);
+    return std::make_pair(ok, V.to_vertices());
+}
+
+
+/**< @brief 隣接リスト表現のグラフGに対してBellman-Fordアルゴリズムを実行し、結果を配列の構造体Vに格納する */
+bool bellman_ford(const graph_t& G, index_t s, vertices_soa& V)
+{
+    return bellman_ford_impl(G, s, V);
+}
+
+
+/**< @brief CSR表現のグラフGに対してBellman-Fordアルゴリズムを実行し、結果を配列の構造体Vに格納する */
+bool bellman_ford(const csr_graph& G, index_t s, vertices_soa& V)
+{
+    return bellman_ford_impl(G, s, V);
+}
+
+
+
+/**< @brief 隣接リスト表現のグラフGに対してキューを用いるBellman-Fordアルゴリズムを実行する */
+bool bellman_ford_queue(const graph_t& G, index_t s, vertices_soa& V)
+{
+    return bellman_ford_queue_impl(G, s, V);
+}
+
+
+/**< @brief CSR表現のグラフGに対してキューを用いるBellman-Fordアルゴリズムを実行する */
+bool bellman_ford_queue(const csr_graph& G, index_t s, vertices_soa& V)
+{
+    return bellman_ford_queue_impl(G, s, V);
+}
+
+
+/**< @brief 特性Traitsによる隣接リスト表現のグラフGに対してBellman-Fordアルゴリズムを実行する */
+template<class Traits>
+bool bellman_ford(const basic_graph_t<Traits>& G, typename Traits::index_type s, basic_vertices_soa<Traits>& V)
+{
+    return bellman_ford_impl(G, s, V);
+}
+
+
+/**< @brief 特性TraitsによるCSR表現のグラフGに対してBellman-Fordアルゴリズムを実行する */
+template<class Traits>
+bool bellman_ford(const basic_csr_graph<Traits>& G, typename Traits::index_type s, basic_vertices_soa<Traits>& V)
+{
+    return bellman_ford_impl(G, s, V);
+}
+
+
+/**< @brief 特性Traitsによる隣接リスト表現のグラフGに対してキューを用いるBellman-Fordアルゴリズムを実行する */
+template<class Traits>
+bool bellman_ford_queue(const basic_graph_t<Traits>& G, typename Traits::index_type s, basic_vertices_soa<Traits>& V)
+{
+    return bellman_ford_queue_impl(G, s, V);
+}
+
+
+/**< @brief 特性TraitsによるCSR表現のグラフGに対してキューを用いるBellman-Fordアルゴリズムを実行する */
+template<class Traits>
+bool bellman_ford_queue(const basic_csr_graph<Traits>& G, typename Traits::index_type s, basic_vertices_soa<Traits>& V)
+{
+    return bellman_ford_queue_impl(G, s, V);
+}
+
+
+// 既定以外の特性による版の明示的な実体化. 既定の特性の版と同じbellman_ford_implとbellman_ford_queue_implを用いる
+#define GRAPH_INSTANTIATE_BELLMAN_FORD(Traits)                                                                              \
+    template bool bellman_ford<Traits>(const basic_graph_t<Traits>&, Traits::index_type, basic_vertices_soa<Traits>&);         \
+    template bool bellman_ford<Traits>(const basic_csr_graph<Traits>&, Traits::index_type, basic_vertices_soa<Traits>&);       \
+    template bool bellman_ford_queue<Traits>(const basic_graph_t<Traits>&, Traits::index_type, basic_vertices_soa<Traits>&);   \
+    template bool bellman_ford_queue<Traits>(const basic_csr_graph<Traits>&, Traits::index_type, basic_vertices_soa<Traits>&);
+
+GRAPH_INSTANTIATE_BELLMAN_FORD(wide_traits)
+GRAPH_INSTANTIATE_BELLMAN_FORD(narrow_traits)
+GRAPH_INSTANTIATE_BELLMAN_FORD(real_traits)
+
+#undef GRAPH_INSTANTIATE_BELLMAN_FORD
+
+
+/**
+ * @brief  作業領域Wを使い回して、キューを用いるBellman-Fordアルゴリズムを実行する
+ * @note   FIFOキューQはW.fifoを環状の配列として用い、一杯になったら大きさを倍にする. Qに置かれている頂点は灰色とし、
+ *         各頂点は高々1つしか置かれないので、Qの大きさは触れた頂点の数で抑えられる. 取り出した頂点は黒色とする
+ */
+template<class Graph>
+static bool bellman_ford_queue_impl(const Graph& G, index_t s, search_workspace& W)
+{
+    index_t n = G.size();
+    W.resize(n);
+    W.touch(s); W.d[s] = 0;
+
+    indices_t& Q = W.fifo;
+    std::size_t head = 0, count = 0;
+    auto enqueue = [&](index_t v) {
+        if (count == Q.size()) {
+            std::rotate(Q.begin(), Q.begin() + head, Q.end());
+            head = 0;
+            Q.resize(std::max<std::size_t>(16, 2 * Q.size()));
+        }
+        Q[(head + count++) % Q.size()] = v;
+        W.paint(v, vcolor::gray);
+    };
+
+    enqueue(s);
+    while (count > 0) {
+        index_t u = Q[head]; head = (head + 1) % Q.size(); --count;
+        W.paint(u, vcolor::black);
+        for (auto&& e : G[u]) {
+            index_t v = e.dst;
+            if (W.dist(v) <= W.d[u] + e.w) { continue; }
+            W.touch(v);
+            W.d[v] = W.d[u] + e.w; W.pi[v] = u;                       // 緩和し、
+            if ((W.len[v] = W.len[u] + 1) >= n) { return false; }    // 歩道が|V|本以上の辺を含めば、負閉路がある
+            if (W.color(v) != vcolor::gray) { enqueue(v); }          // vがQになければQの末尾に置く
+        }
+    }
+    return true;
+}
+
+
+/**< @brief 隣接リスト表現のグラフGに対して、作業領域Wを使い回してキューを用いるBellman-Fordアルゴリズムを実行する */
+bool bellman_ford_queue(const graph_t& G, index_t s, search_workspace& W)
+{
+    return bellman_ford_queue_impl(G, s, W);
+}
+
+
+/**< @brief CSR表現のグラフGに対して、作業領域Wを使い回してキューを用いるBellman-Fordアルゴリズムを実行する */
+bool bellman_ford_queue(const csr_graph& G, index_t s, search_workspace& W)
+{
+    return bellman_ford_queue_impl(G, s, W);
+}
+
+
+/**
+ * @brief  Bellman-Fordアルゴリズムの各走査をthreads本のスレッドで行う
+ *
+ * @note   辺の数がほぼ等しくなるように頂点を連続した区間に分け、各スレッドは自分の区間の頂点から出る辺を緩和する
+ *         (v.d, v.π)は1つの64ビット整数に詰め、比較交換で減らす(graph/atomic_relax.hpp). 走査の区切りでは待ち合わせる
+ *         走査の途中で他のスレッドが減らしたd値も用いるので、各走査は逐次版の走査以上に推定値を改善する
+ *         したがって、負閉路がなければ高々|V| - 1回の走査でd値は変わらなくなり、|V|回目の走査でもd値が変われば負閉路がある
+ */
+bool bellman_ford_parallel(const csr_graph& G, index_t s, vertices_soa& V, unsigned threads)
+{
+    const index_t n = G.size(), m = G.edge_count();
+    threads = resolve_threads(threads);
+
+    std::vector<std::atomic<std::uint64_t>> D(n);
+    for (auto&& x : D) { x.store(pack_relax(limits::inf, limits::nil), std::memory_order_relaxed); }
+    D[s].store(pack_relax(0, limits::nil), std::memory_order_relaxed);
+
+    // スレッドtidは頂点first[tid], ..., first[tid + 1] - 1から出る辺を緩和する
+    indices_t first(threads + 1, n);
+    for (unsigned tid = 0; tid < threads; ++tid) {
+        std::int64_t k = static_cast<std::int64_t>(m) * tid / threads;
+        first[tid] = static_cast<index_t>(std::lower_bound(G.offset.begin(), G.offset.begin() + n, k) - G.offset.begin());
+    }
+
+    std::atomic<bool> changed(false);
+    bool done = false, ok = true;
+    index_t pass = 0;
+    barrier sync(threads);
+
+    parallel_run(threads, [&](unsigned tid) {
+        while (true) {
+            bool relaxed = false;
+            for (index_t u = first[tid]; u < first[tid + 1]; ++u) {
+                weight_t du = unpack_d(D[u].load(std::memory_order_relaxed));
+                if (du == limits::inf) { continue; }
+                for (index_t i = G.offset[u]; i < G.offset[u + 1]; ++i) {
+                    relaxed |= relax_atomic(D[G.dst[i]], du + G.w[i], u);
+                }
+            }
+            if (relaxed) { changed.store(true, std::memory_order_relaxed); }
+            sync.arrive_and_wait();
+
+            if (tid == 0) {
+                ++pass;
+                if (!changed.exchange(false, std::memory_order_relaxed)) { done = true; }  // d値が変わらなければ終了する
+                else if (pass == n) { done = true; ok = false; }                           // |V|回目の走査でも変われば負閉路がある
+            }
+            sync.arrive_and_wait();
+            if (done) { break; }
+        }
+    });
+
+    V.resize(n);
+    for (index_t v = 0; v < n; ++v) {
+        std::uint64_t x = D[v].load(std::memory_order_relaxed);
+        V.d[v]  = unpack_d(x);
+        V.pi[v] = unpack_pi(x);
+    }
+    return ok;
+}
+
+
+/**< @brief 隣接リスト表現のグラフGをCSR表現に変換してから、並列版のBellman-Fordアルゴリズムを実行する */
+bool bellman_ford_parallel(const graph_t& G, index_t s, vertices_soa& V, unsigned threads)
+{
+    return bellman_ford_parallel(csr_graph(G), s, V, threads);
 }
 
 
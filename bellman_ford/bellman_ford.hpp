@@ -19,6 +19,9 @@
 //****************************************
 
 #include "../graph/graph.hpp"
+#include "../graph/csr.hpp"
+#include "../graph/soa.hpp"
+#include "../graph/workspace.hpp"
 
 
 
@@ -40,6 +43,8 @@ GRAPH_BEGIN
  *         実際の最短路重みδ(s, v)に一致するまで徐々に減らす
  *         アルゴリズムが値TRUEを返すのは、グラフの始点から到達可能な負閉路を含まないとき、かつそのときに限る
  *
+ * @note   ある走査でどのd値も変わらなければ、残りの走査を行わずに終了する
+ *
  * @param  const graph_t& G グラフG
  * @param  index_t        s 始点s
  */
@@ -47,6 +52,102 @@ std::pair<bool, vertices_t> bellman_ford(const graph_t& G, index_t s);
 
 
 
+/**
+ * @brief  CSR表現のグラフGに対してBellman-Fordアルゴリズムを実行する
+ * @note   結果はgraph_tに対するbellman_fordと同じである
+ *
+ * @param  const csr_graph& G グラフG
+ * @param  index_t          s 始点s
+ */
+std::pair<bool, vertices_t> bellman_ford(const csr_graph& G, index_t s);
+
+
+
+/**
+ * @brief  Bellman-Fordアルゴリズムを実行し、結果を配列の構造体Vに格納する
+ * @note   Vは頂点数|V|に合わせて初期化される. vertices_tが必要ならばV.to_vertices()で変換できる
+ *
+ * @param  const graph_t& G グラフG
+ * @param  index_t        s 始点s
+ * @param  vertices_soa&  V 始点sからの最短路重みを格納する頂点集合V
+ * @return 始点から到達可能な負閉路を含まないか？
+ */
+bool bellman_ford(const graph_t& G, index_t s, vertices_soa& V);
+bool bellman_ford(const csr_graph& G, index_t s, vertices_soa& V);
+
+
+
+/**
+ * @brief  キューを用いるBellman-Fordアルゴリズム(SPFA)
+ *
+ * @note   d値が減った頂点だけをFIFOキューに置き、取り出した頂点から出る辺だけを緩和する
+ *         負閉路は、d値を与えた歩道の辺数が|V|以上になったことで検出する
+ *         最悪実行時間はbellman_fordと同じΟ(VE)であるが、緩和が数回の走査で収束するグラフでは、走査する辺の数が大きく減る
+ *
+ * @param  const graph_t& G グラフG
+ * @param  index_t        s 始点s
+ * @param  vertices_soa&  V 始点sからの最短路重みを格納する頂点集合V
+ * @return 始点から到達可能な負閉路を含まないか？
+ */
+bool bellman_ford_queue(const graph_t& G, index_t s, vertices_soa& V);
+bool bellman_ford_queue(const csr_graph& G, index_t s, vertices_soa& V);
+
+
+
+/**
+ * @brief  添字と重みの型を特性Traitsで選んだグラフGに対してBellman-Fordアルゴリズムを実行する
+ * @note   既定の特性の版と同じ実装(bellman_ford.cpp)を実体化したものであり、異なるのは添字と重みの型だけである
+ *         bellman_ford.cppでwide_traits, narrow_traits, real_traitsについて実体化する. 既定の特性による呼び出しには非テンプレートの版が選ばれる
+ *
+ * @param  const basic_graph_t<Traits>& G グラフG(またはbasic_csr_graph<Traits>)
+ * @param  index_type                   s 始点s
+ * @param  basic_vertices_soa<Traits>&  V 始点sからの最短路重みを格納する頂点集合V
+ * @return 始点から到達可能な負閉路を含まないか？
+ */
+template<class Traits>
+bool bellman_ford(const basic_graph_t<Traits>& G, typename Traits::index_type s, basic_vertices_soa<Traits>& V);
+template<class Traits>
+bool bellman_ford(const basic_csr_graph<Traits>& G, typename Traits::index_type s, basic_vertices_soa<Traits>& V);
+template<class Traits>
+bool bellman_ford_queue(const basic_graph_t<Traits>& G, typename Traits::index_type s, basic_vertices_soa<Traits>& V);
+template<class Traits>
+bool bellman_ford_queue(const basic_csr_graph<Traits>& G, typename Traits::index_type s, basic_vertices_soa<Traits>& V);
+
+
+
+/**
+ * @brief  作業領域Wを使い回して、キューを用いるBellman-Fordアルゴリズム(SPFA)を実行する
+ * @note   Wの頂点属性は触れた頂点だけが初期化されるので、1回の呼び出しの時間はsから到達できる頂点と緩和の回数だけで決まり、|V|には依存しない
+ *         結果はW.dist(v), W.pred(v)で読む. 負閉路を見つけて途中で戻った場合、Wの内容は意味を持たない
+ *
+ * @param  const graph_t&    G グラフG
+ * @param  index_t           s 始点s
+ * @param  search_workspace& W 作業領域
+ * @return 始点から到達可能な負閉路を含まないか？
+ */
+bool bellman_ford_queue(const graph_t& G, index_t s, search_workspace& W);
+bool bellman_ford_queue(const csr_graph& G, index_t s, search_workspace& W);
+
+
+
+/**
+ * @brief  Bellman-Fordアルゴリズムの各走査をthreads本のスレッドで行う
+ *
+ * @note   辺を始点の区間でスレッドに分け、d値とπ値は比較交換による不可分な最小値の更新で減らす
+ *         d値が変わらない走査があれば終了し、|V|回目の走査でもd値が変われば負閉路があると判定する
+ *         d値はbellman_fordと一致する. 同じ重みの最短路が複数あるとき、π値はbellman_fordと異なりうるが、Gπは最短路木である
+ *
+ * @param  const csr_graph& G       グラフG
+ * @param  index_t          s       始点s
+ * @param  vertices_soa&    V       始点sからの最短路重みを格納する頂点集合V
+ * @param  unsigned         threads スレッド数(0ならばハードウェアの並列度)
+ * @return 始点から到達可能な負閉路を含まないか？
+ */
+bool bellman_ford_parallel(const csr_graph& G, index_t s, vertices_soa& V, unsigned threads = 0);
+bool bellman_ford_parallel(const graph_t& G, index_t s, vertices_soa& V, unsigned threads = 0);
+
+
+
 GRAPH_END
 
 
@@ -0,0 +1,91 @@
+/**
+ * @brief  小さな部分グラフの構築、問い合わせ、破棄を繰り返すときの、既定のアロケータとアリーナの速度を比較する
+ *
+ * @note   1サイクルでは、k頂点のグラフに乱数で選んだdeg * k本の辺を隣接リスト表現で構築し、CSR表現に変換してから
+ *         dijkstra(G, 0, k - 1, W)で問い合わせ、すべてを破棄する. これを
+ *           1. graph_tとcsr_graph(既定のアロケータ, new/delete)
+ *           2. graph::pmr::graph_tとcsr_graph(G, &A)(アリーナA). サイクルの終わりにA.release()で一度に解放する
+ *         の2通りで行い、1サイクルあたりの平均時間を出力する. 作業領域Wは両方とも使い回す
+ *
+ * @note   ビルドと実行の例
+ *           g++ -std=c++17 -O2 benchmark/arena.cpp dijkstra/dijkstra.cpp -o arena_bench && ./arena_bench [頂点数] [平均次数] [サイクル数]
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <iostream>
+#include <random>
+#include <chrono>
+#include <cstdlib>
+#include "../graph/arena.hpp"
+#include "../dijkstra/dijkstra.hpp"
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**
+ * @brief  サイクルをcycles回繰り返し、1回あたりの平均時間[us]を返す
+ * @note   cycle(rng)はそのサイクルの最短路重みを返す. すべての重みの合計をchecksumに格納する
+ */
+template<class Cycle>
+static double measure(int cycles, long long& checksum, Cycle cycle)
+{
+    std::mt19937 rng(12345);
+    checksum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < cycles; ++i) { checksum += cycle(rng); }
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(stop - start).count() / cycles;
+}
+
+
+
+//****************************************
+// エントリポイント
+//****************************************
+
+int main(int argc, char* argv[])
+{
+    using namespace graph;
+    index_t k      = argc > 1 ? std::atoi(argv[1]) : 64;
+    index_t deg    = argc > 2 ? std::atoi(argv[2]) : 4;
+    int     cycles = argc > 3 ? std::atoi(argv[3]) : 100000;
+
+    search_workspace W(k);
+    long long sum1, sum2;
+
+    double heap = measure(cycles, sum1, [&](std::mt19937& rng) {
+        graph_t G(k);
+        for (index_t i = 0; i < deg * k; ++i) { index_t u = rng() % k, v = rng() % k; G[u].emplace_back(u, v, static_cast<weight_t>(rng() % 100)); }
+        csr_graph C(G);
+        weight_t d = dijkstra(C, 0, k - 1, W);
+        return d == limits::inf ? -1 : d;
+    });
+    std::cout << "default allocator : " << heap << " us/cycle\n";
+
+    arena A;
+    double pool = measure(cycles, sum2, [&](std::mt19937& rng) {
+        weight_t d;
+        {
+            pmr::graph_t G(k, &A);
+            for (index_t i = 0; i < deg * k; ++i) { index_t u = rng() % k, v = rng() % k; G[u].emplace_back(u, v, static_cast<weight_t>(rng() % 100)); }
+            csr_graph C(G, &A);
+            d = dijkstra(C, 0, k - 1, W);
+        }
+        A.release();
+        return d == limits::inf ? -1 : d;
+    });
+    std::cout << "arena             : " << pool << " us/cycle (first block " << A.capacity() << " bytes)\n";
+
+    if (sum1 != sum2) { std::cerr << "checksum mismatch\n"; return 1; }
+    return 0;
+}
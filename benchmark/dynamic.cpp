@@ -0,0 +1,118 @@
+/**
+ * @brief  辺を1本ずつ挿入するときの、動的グラフによる増分的な修復と最初からの再計算の更新時間を比較する
+ *
+ * @note   乱数で生成した重み1以上100以下の無向グラフに、乱数で選んだ辺を1本ずつ挿入する. 挿入ごとに
+ *           1. dynamic_graph::insert(最短路と連結性を修復する)
+ *           2. dynamic_graph::insert(最短路、連結性と最小全域森を修復する)
+ *           3. dijkstraとkruskalを最初から実行し直す(挿入の一部でだけ測る)
+ *         に要した時間の中央値と99パーセンタイルを出力する. 最後に、修復した結果と再計算した結果が一致することを確かめる
+ *
+ * @note   ビルドと実行の例
+ *           g++ -std=c++17 -O2 -DGRAPH_NO_MAIN benchmark/dynamic.cpp dynamic/dynamic.cpp dijkstra/dijkstra.cpp kruskal/kruskal.cpp -pthread -o dynamic_bench && ./dynamic_bench [頂点数] [平均次数] [挿入数]
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <iostream>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <vector>
+#include <cstdlib>
+#include "../dynamic/dynamic.hpp"
+#include "../dijkstra/dijkstra.hpp"
+#include "../kruskal/kruskal.hpp"
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**< @brief 時間の列tの中央値と99パーセンタイル[us]を出力する */
+static void report(const char* name, std::vector<double> t)
+{
+    std::sort(t.begin(), t.end());
+    std::cout << name << "median " << t[t.size() / 2] << " us, p99 " << t[t.size() * 99 / 100] << " us (" << t.size() << " updates)\n";
+}
+
+
+/**
+ * @brief  Dの複製に辺の列Eを1本ずつ挿入し、各挿入の時間[us]を返す
+ * @note   結果を確かめるために、挿入後のDを返す
+ */
+static std::vector<double> measure(graph::dynamic_graph& D, const graph::edges_t& E)
+{
+    std::vector<double> t;
+    t.reserve(E.size());
+    for (auto&& e : E) {
+        auto start = std::chrono::steady_clock::now();
+        D.insert(e.src, e.dst, e.w);
+        t.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+    }
+    return t;
+}
+
+
+
+//****************************************
+// エントリポイント
+//****************************************
+
+int main(int argc, char* argv[])
+{
+    using namespace graph;
+    index_t n   = argc > 1 ? std::atoi(argv[1]) : 100000;
+    index_t deg = argc > 2 ? std::atoi(argv[2]) : 8;
+    int     k   = argc > 3 ? std::atoi(argv[3]) : 1000;
+
+    std::mt19937 rng(12345);
+    std::uniform_int_distribution<index_t> vertex(0, n - 1);
+    std::uniform_int_distribution<weight_t> weight(1, 100);
+    graph_t G(n);
+    for (index_t i = 0; i < n * deg / 2; ++i) {
+        index_t u = vertex(rng), v = vertex(rng);
+        weight_t w = weight(rng);
+        G[u].emplace_back(u, v, w); G[v].emplace_back(v, u, w);
+    }
+    edges_t E;
+    for (int i = 0; i < k; ++i) { E.emplace_back(vertex(rng), vertex(rng), weight(rng)); }
+    std::cout << "|V| = " << n << ", |E| = " << static_cast<long long>(n) * deg << "\n";
+
+    dynamic_graph D1(G);
+    D1.track_shortest_paths(0);
+    report("insert (sssp, connectivity)      : ", measure(D1, E));
+
+    dynamic_graph D2(G);
+    D2.track_shortest_paths(0);
+    D2.track_spanning_forest();
+    report("insert (sssp, connectivity, mst) : ", measure(D2, E));
+
+    std::vector<double> t;
+    graph_t H = G;
+    weight_t mst = 0;
+    vertices_t V;
+    for (int i = 0; i < k; ++i) {
+        H[E[i].src].push_back(E[i]); H[E[i].dst].emplace_back(E[i].dst, E[i].src, E[i].w);
+        if (i % 50 != 49) { continue; }
+        auto start = std::chrono::steady_clock::now();
+        V   = dijkstra(H, 0);
+        mst = kruskal(H).second;
+        t.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+    }
+    V   = dijkstra(H, 0);
+    mst = kruskal(H).second;
+    report("recompute (dijkstra, kruskal)    : ", t);
+
+    for (index_t v = 0; v < n; ++v) {
+        if (V[v].d != D1.V[v].d || V[v].d != D2.V[v].d) { std::cerr << "distance mismatch\n"; return 1; }
+    }
+    if (mst != D2.forest_weight) { std::cerr << "forest weight mismatch\n"; return 1; }
+    return 0;
+}
@@ -0,0 +1,124 @@
+/**
+ * @brief  全点対最短路の表を、辺の重みの減少ごとに増分的に更新する時間と、最初から計算し直す時間を比較する
+ *
+ * @note   乱数で生成した重み1以上1000以下の有向グラフ(密な行列)について
+ *           1. floyd_warshall_blocked(最初からの計算)とnext_hops(次の頂点の行列の構築)
+ *           2. floyd_warshall_decrease(距離だけ)
+ *           3. floyd_warshall_decrease(距離と次の頂点)
+ *         に要した時間を出力する. 2と3は乱数で選んだ辺の重みを1本ずつ減らし、中央値と99パーセンタイルを出力する
+ *         最後に、更新した結果と再計算した結果が一致することを確かめる
+ *
+ * @note   ビルドと実行の例
+ *           g++ -std=c++17 -O2 -march=native benchmark/floyd_warshall_update.cpp floyd_warshall/floyd_warshall.cpp -pthread -o fw_update_bench && ./fw_update_bench [頂点数] [平均次数] [更新数]
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <iostream>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <vector>
+#include <cstdlib>
+#include "../floyd_warshall/floyd_warshall.hpp"
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**< @brief 経過時間[ms]を返す */
+static double elapsed(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+
+/**< @brief 時間の列tの中央値と99パーセンタイル[ms]を出力する */
+static void report(const char* name, std::vector<double> t)
+{
+    std::sort(t.begin(), t.end());
+    std::cout << name << "median " << t[t.size() / 2] << " ms, p99 " << t[t.size() * 99 / 100] << " ms (" << t.size() << " updates)\n";
+}
+
+
+
+//****************************************
+// エントリポイント
+//****************************************
+
+int main(int argc, char* argv[])
+{
+    using namespace graph;
+    index_t n   = argc > 1 ? std::atoi(argv[1]) : 2000;
+    index_t deg = argc > 2 ? std::atoi(argv[2]) : 8;
+    int     k   = argc > 3 ? std::atoi(argv[3]) : 100;
+
+    std::mt19937 rng(12345);
+    std::uniform_int_distribution<index_t> vertex(0, n - 1);
+    std::uniform_int_distribution<weight_t> weight(1, 1000);
+    dense_matrix W(n, n, limits::inf);
+    for (index_t i = 0; i < n; ++i) { W[i][i] = 0; }
+    for (index_t i = 0; i < n * deg; ++i) {
+        index_t u = vertex(rng), v = vertex(rng);
+        if (u != v) { W[u][v] = std::min(W[u][v], weight(rng)); }
+    }
+    std::cout << "|V| = " << n << "\n";
+
+    auto start = std::chrono::steady_clock::now();
+    dense_matrix D = floyd_warshall_blocked(W);
+    std::cout << "floyd_warshall_blocked            : " << elapsed(start) << " ms\n";
+
+    start = std::chrono::steady_clock::now();
+    next_hop_matrix N = next_hops(W, D);
+    std::cout << "next_hops                         : " << elapsed(start) << " ms, "
+              << N.memory_bytes() / (1 << 20) << " MiB (" << N.width << " byte(s) per entry, "
+              << static_cast<std::size_t>(n) * n * sizeof(index_t) / (1 << 20) << " MiB as index_t)\n";
+
+    // 辺の重みの減少(または辺の追加)の列
+    struct update { index_t u, v; weight_t w; };
+    std::vector<update> E;
+    for (int i = 0; i < k; ++i) {
+        index_t u = vertex(rng), v = vertex(rng);
+        E.push_back({ u, v, std::uniform_int_distribution<weight_t>(1, 100)(rng) });
+    }
+
+    dense_matrix D1 = D;
+    std::vector<double> t;
+    for (auto&& e : E) {
+        start = std::chrono::steady_clock::now();
+        floyd_warshall_decrease(D1, e.u, e.v, e.w);
+        t.push_back(elapsed(start));
+    }
+    report("floyd_warshall_decrease           : ", t);
+
+    t.clear();
+    for (auto&& e : E) {
+        start = std::chrono::steady_clock::now();
+        floyd_warshall_decrease(D, N, e.u, e.v, e.w);
+        t.push_back(elapsed(start));
+    }
+    report("floyd_warshall_decrease (next hop): ", t);
+
+    for (auto&& e : E) { if (e.u != e.v) { W[e.u][e.v] = std::min(W[e.u][e.v], e.w); } }
+    dense_matrix R = floyd_warshall_blocked(W);
+    for (index_t i = 0; i < n; ++i) {
+        for (index_t j = 0; j < n; ++j) {
+            if (R[i][j] != D[i][j] || R[i][j] != D1[i][j]) { std::cerr << "distance mismatch\n"; return 1; }
+        }
+    }
+    for (index_t j = 0; j < n; ++j) {
+        auto p = N.path(0, j);
+        weight_t s = 0;
+        for (std::size_t x = 1; x < p.size(); ++x) { s += W[p[x - 1]][p[x]]; }
+        if (R[0][j] != limits::inf && s != R[0][j]) { std::cerr << "path mismatch\n"; return 1; }
+    }
+    return 0;
+}
@@ -0,0 +1,146 @@
+/**
+ * @brief  2頂点間の最短路の問い合わせについて、打ち切りの有無と探索の方向による速度と触れた頂点の数を比較する
+ *
+ * @note   道路網に似た形のグラフとして、W x Wの格子の4近傍に乱数の重みを付けた無向グラフを生成し、乱数で選んだ頂点対(s, t)について
+ *           1. すべての頂点を処理するdijkstra(G, s, S)
+ *           2. tを取り出した時点で打ち切るdijkstra(G, s, t, W)
+ *           3. 双方向のdijkstra_bidirectional(G, GT, s, t, B)
+ *           4. ALTのランドマークを用いたastar(G, s, t, A, W)
+ *           5. 縮約階層のcontraction_hierarchy::query(s, t, B)
+ *         の1回あたりの平均時間と、触れた頂点の平均数を出力する. 最短路重みがすべて一致することも確かめる
+ *         4と5は前処理の時間も出力する
+ *
+ * @note   ビルドと実行の例
+ *           g++ -std=c++17 -O2 -pthread benchmark/point_to_point.cpp dijkstra/dijkstra.cpp astar/astar.cpp contraction_hierarchies/contraction_hierarchies.cpp -o p2p_bench && ./p2p_bench [格子の幅] [問い合わせの回数] [ランドマークの数]
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <iostream>
+#include <random>
+#include <chrono>
+#include <cstdlib>
+#include <utility>
+#include "../dijkstra/dijkstra.hpp"
+#include "../astar/astar.hpp"
+#include "../contraction_hierarchies/contraction_hierarchies.hpp"
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**< @brief W x Wの格子の4近傍に重み1以上100以下の辺を張った無向グラフを生成する */
+static graph::csr_graph make_grid(graph::index_t W, unsigned seed)
+{
+    using namespace graph;
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<weight_t> weight(1, 100);
+    graph_t G(static_cast<std::size_t>(W) * W);
+    for (index_t i = 0; i < W; ++i) {
+        for (index_t j = 0; j < W; ++j) {
+            index_t v = i * W + j;
+            if (j + 1 < W) { weight_t w = weight(rng); G[v].emplace_back(v, v + 1, w); G[v + 1].emplace_back(v + 1, v, w); }
+            if (i + 1 < W) { weight_t w = weight(rng); G[v].emplace_back(v, v + W, w); G[v + W].emplace_back(v + W, v, w); }
+        }
+    }
+    return csr_graph(G);
+}
+
+
+/**
+ * @brief  各頂点対について問い合わせquery(s, t)を行い、1回あたりの平均時間[us]を返す
+ * @note   queryは(最短路重み, 触れた頂点の数)を返す. 最短路重みはd[i]と比べ(d[i]が空なら記録し)、触れた頂点の数はtouchedに足す
+ */
+template<class Query>
+static double measure(const std::vector<std::pair<graph::index_t, graph::index_t>>& pairs, graph::array_t& d, double& touched, Query query)
+{
+    bool record = d.empty();
+    touched = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < pairs.size(); ++i) {
+        auto r = query(pairs[i].first, pairs[i].second);
+        if (record) { d.push_back(r.first); }
+        else if (d[i] != r.first) { std::cerr << "distance mismatch at query " << i << "\n"; std::exit(1); }
+        touched += r.second;
+    }
+    auto stop = std::chrono::steady_clock::now();
+    touched /= pairs.size();
+    return std::chrono::duration<double, std::micro>(stop - start).count() / pairs.size();
+}
+
+
+
+//****************************************
+// エントリポイント
+//****************************************
+
+int main(int argc, char* argv[])
+{
+    using namespace graph;
+    index_t W       = argc > 1 ? std::atoi(argv[1]) : 500;
+    index_t queries = argc > 2 ? std::atoi(argv[2]) : 100;
+    index_t k       = argc > 3 ? std::atoi(argv[3]) : 8;
+
+    csr_graph G = make_grid(W, 12345), GT = transpose(G);
+    std::cout << "|V| = " << G.size() << ", |E| = " << G.edge_count() << "\n";
+
+    std::mt19937 rng(54321);
+    std::uniform_int_distribution<index_t> pick(0, G.size() - 1);
+    std::vector<std::pair<index_t, index_t>> pairs(queries);
+    for (auto&& p : pairs) { p = std::make_pair(pick(rng), pick(rng)); }
+
+    array_t d;
+    double touched;
+    vertices_soa S;
+    search_workspace Ws(G.size());
+    bidirectional_workspace B;
+
+    double full = measure(pairs, d, touched, [&](index_t s, index_t t) {
+        dijkstra(G, s, S);
+        return std::make_pair(S.d[t], static_cast<double>(G.size()));
+    });
+    std::cout << "dijkstra(G, s)              : " << full << " us/query, touched = " << touched << "\n";
+
+    double early = measure(pairs, d, touched, [&](index_t s, index_t t) {
+        weight_t x = dijkstra(G, s, t, Ws);
+        return std::make_pair(x, static_cast<double>(Ws.touched().size()));
+    });
+    std::cout << "dijkstra(G, s, t)           : " << early << " us/query, touched = " << touched << "\n";
+
+    double bidir = measure(pairs, d, touched, [&](index_t s, index_t t) {
+        weight_t x = dijkstra_bidirectional(G, GT, s, t, B);
+        return std::make_pair(x, static_cast<double>(B.forward.touched().size() + B.backward.touched().size()));
+    });
+    std::cout << "dijkstra_bidirectional      : " << bidir << " us/query, touched = " << touched << "\n";
+
+    auto start = std::chrono::steady_clock::now();
+    alt_landmarks A = alt_preprocess(G, k);
+    auto stop = std::chrono::steady_clock::now();
+    std::cout << "alt_preprocess (k = " << k << ")      : " << std::chrono::duration<double>(stop - start).count() << " s\n";
+
+    double alt = measure(pairs, d, touched, [&](index_t s, index_t t) {
+        weight_t x = astar(G, s, t, A, Ws);
+        return std::make_pair(x, static_cast<double>(Ws.touched().size()));
+    });
+    std::cout << "astar (ALT)                 : " << alt << " us/query, touched = " << touched << "\n";
+
+    start = std::chrono::steady_clock::now();
+    contraction_hierarchy H(G);
+    stop = std::chrono::steady_clock::now();
+    std::cout << "contraction_hierarchy       : " << std::chrono::duration<double>(stop - start).count() << " s, |E+| = " << H.edge_count() << "\n";
+
+    double ch = measure(pairs, d, touched, [&](index_t s, index_t t) {
+        weight_t x = H.query(s, t, B);
+        return std::make_pair(x, static_cast<double>(B.forward.touched().size() + B.backward.touched().size()));
+    });
+    std::cout << "contraction_hierarchy::query: " << ch << " us/query, touched = " << touched << "\n";
+    return 0;
+}
@@ -0,0 +1,96 @@
+/**
+ * @brief  同期型の並列プッシュ再ラベル法のスレッド数に対する速度向上を測る
+ *
+ * @note   画像の領域分割で現れる形のフローネットワーク(格子状の4近傍の辺と、各画素から入口sまたは出口tへの辺)を乱数で生成し、
+ *         逐次版のpush_relabelと、スレッド数を1, 2, 4, ...と変えたparallel_push_relabelの実行時間を出力する
+ *         速度向上(speedup)はスレッド数1のparallel_push_relabelに対する比である. 最大フローの値がすべて一致することも確かめる
+ *
+ * @note   ビルドと実行の例
+ *           g++ -std=c++17 -O2 -pthread benchmark/push_relabel.cpp -o push_relabel_bench && ./push_relabel_bench [格子の幅] [最大スレッド数]
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <iostream>
+#include <random>
+#include <chrono>
+#include <cstdlib>
+#include "../push_relabel/push_relabel.hpp"
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**< @brief W x Wの格子状のフローネットワークを生成する. 頂点W * Wが入口s、W * W + 1が出口tである */
+static graph::edges_t make_grid(graph::index_t W, unsigned seed)
+{
+    using namespace graph;
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<capacity_t> smooth(1, 20), data(1, 40);
+    std::uniform_int_distribution<int> side(0, 3);
+    index_t s = W * W, t = s + 1;
+    edges_t E;
+    for (index_t i = 0; i < W; ++i) {
+        for (index_t j = 0; j < W; ++j) {
+            index_t v = i * W + j;
+            if (j + 1 < W) { capacity_t c = smooth(rng); E.emplace_back(v, v + 1, c); E.emplace_back(v + 1, v, c); }
+            if (i + 1 < W) { capacity_t c = smooth(rng); E.emplace_back(v, v + W, c); E.emplace_back(v + W, v, c); }
+            int k = side(rng);
+            if (k == 0) { E.emplace_back(s, v, data(rng)); }
+            if (k == 1) { E.emplace_back(v, t, data(rng)); }
+        }
+    }
+    return E;
+}
+
+
+/**< @brief フローネットワークEの最大フローを求め、かかった時間[s]を返す */
+template<class Flow>
+static double measure(Flow&& F, const graph::edges_t& E, graph::index_t s, graph::index_t t, graph::capacity_t& value)
+{
+    for (auto&& e : E) { F.add_edge(e.src, e.dst, e.c); }
+    auto start = std::chrono::steady_clock::now();
+    value = F.compute(s, t);
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(stop - start).count();
+}
+
+
+
+//****************************************
+// エントリポイント
+//****************************************
+
+int main(int argc, char* argv[])
+{
+    using namespace graph;
+    index_t  W       = argc > 1 ? std::atoi(argv[1]) : 1000;
+    unsigned threads = argc > 2 ? static_cast<unsigned>(std::atoi(argv[2])) : resolve_threads(0);
+
+    edges_t E = make_grid(W, 12345);
+    index_t n = W * W + 2, s = W * W, t = s + 1;
+    std::cout << "|V| = " << n << ", |E| = " << E.size() << "\n";
+
+    capacity_t expected;
+    double sequential = measure(push_relabel(n), E, s, t, expected);
+    std::cout << "push_relabel            : " << sequential << " s (flow = " << expected << ")\n";
+
+    double base = 0;
+    for (unsigned k = 1; k <= threads; k *= 2) {
+        capacity_t value;
+        double time = measure(parallel_push_relabel(n, k), E, s, t, value);
+        if (k == 1) { base = time; }
+        std::cout << "parallel_push_relabel " << k << (k < 10 ? " " : "") << ": " << time << " s, speedup = " << base / time << "\n";
+        if (value != expected) { std::cerr << "flow mismatch: " << value << " != " << expected << "\n"; return 1; }
+        if (k < threads && k * 2 > threads) { k = threads / 2; }  // 最後に最大スレッド数でも測る
+    }
+    return 0;
+}
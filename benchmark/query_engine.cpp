@@ -0,0 +1,104 @@
+/**
+ * @brief  問い合わせエンジンの処理量(1秒あたりの問い合わせ数, QPS)を、投入の仕方ごとに比較する
+ *
+ * @note   乱数で生成した重み1以上100以下の有向グラフに対して、乱数で選んだ頂点対の問い合わせ(最短路重みと到達可能性)を
+ *           1. 呼び出したスレッドで、1つの作業領域を使い回して順に答える
+ *           2. query_engineに1件ずつ投入する(distance, reachable)
+ *           3. query_engineにまとめて投入する(submit)
+ *         の3通りで処理し、それぞれのQPSを出力する. 最後に、3通りの結果が一致することを確かめる
+ *
+ * @note   ビルドと実行の例
+ *           g++ -std=c++17 -O2 benchmark/query_engine.cpp query_engine/query_engine.cpp dijkstra/dijkstra.cpp -pthread -o query_bench && ./query_bench [頂点数] [平均次数] [問い合わせ数] [スレッド数]
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <iostream>
+#include <random>
+#include <chrono>
+#include <vector>
+#include <cstdlib>
+#include "../query_engine/query_engine.hpp"
+#include "../dijkstra/dijkstra.hpp"
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**< @brief 経過時間[s]を返す */
+static double elapsed(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+
+
+//****************************************
+// エントリポイント
+//****************************************
+
+int main(int argc, char* argv[])
+{
+    using namespace graph;
+    index_t  n       = argc > 1 ? std::atoi(argv[1]) : 100000;
+    index_t  deg     = argc > 2 ? std::atoi(argv[2]) : 4;
+    int      k       = argc > 3 ? std::atoi(argv[3]) : 2000;
+    unsigned threads = argc > 4 ? static_cast<unsigned>(std::atoi(argv[4])) : 0;
+
+    std::mt19937 rng(12345);
+    std::uniform_int_distribution<index_t> vertex(0, n - 1);
+    std::uniform_int_distribution<weight_t> weight(1, 100);
+    graph_t G(n);
+    for (index_t i = 0; i < n * deg; ++i) {
+        index_t u = vertex(rng), v = vertex(rng);
+        G[u].emplace_back(u, v, weight(rng));
+    }
+    std::vector<query> batch;
+    for (int i = 0; i < k; ++i) { batch.push_back({ i % 2 == 0 ? query_kind::distance : query_kind::reachable, vertex(rng), vertex(rng) }); }
+
+    query_engine Q(G, threads);
+    std::cout << "|V| = " << n << ", |E| = " << static_cast<long long>(n) * deg << ", threads = " << Q.threads() << "\n";
+
+    // 1. 呼び出したスレッドで順に答える(到達可能性は最短路重みが∞でないかで判定する)
+    csr_graph C(G);
+    search_workspace W(n);
+    std::vector<weight_t> r1;
+    auto start = std::chrono::steady_clock::now();
+    for (auto&& q : batch) {
+        weight_t d = dijkstra(C, q.s, q.t, W);
+        r1.push_back(q.kind == query_kind::distance ? d : d != limits::inf);
+    }
+    std::cout << "sequential        : " << k / elapsed(start) << " qps\n";
+
+    // 2. 1件ずつ投入する
+    start = std::chrono::steady_clock::now();
+    std::vector<std::future<weight_t>> fd;
+    std::vector<std::future<bool>> fr;
+    for (auto&& q : batch) {
+        if (q.kind == query_kind::distance) { fd.push_back(Q.distance(q.s, q.t)); }
+        else                                { fr.push_back(Q.reachable(q.s, q.t)); }
+    }
+    std::vector<weight_t> r2;
+    for (std::size_t i = 0, a = 0, b = 0; i < batch.size(); ++i) {
+        r2.push_back(batch[i].kind == query_kind::distance ? fd[a++].get() : fr[b++].get());
+    }
+    std::cout << "engine (single)   : " << k / elapsed(start) << " qps\n";
+
+    // 3. まとめて投入する
+    start = std::chrono::steady_clock::now();
+    auto f3 = Q.submit(batch);
+    std::vector<weight_t> r3;
+    for (auto&& f : f3) { r3.push_back(f.get()); }
+    std::cout << "engine (batched)  : " << k / elapsed(start) << " qps\n";
+
+    if (r1 != r2 || r1 != r3) { std::cerr << "result mismatch\n"; return 1; }
+    return 0;
+}
@@ -0,0 +1,100 @@
+/**
+ * @brief  緩和(relax)の述語をstd::functionで受け取る場合とテンプレート引数で受け取る場合の1辺あたりのコストを比較する
+ *
+ * @note   Bellman-Fordアルゴリズムと同じ順序でグラフのすべての辺を繰り返し緩和し、1辺の緩和にかかる平均時間を出力する
+ *         std::functionで受け取る版は、以前のrelax.hppと同じ形の関数をここに残したものである
+ *
+ * @note   ビルドと実行の例
+ *           g++ -std=c++14 -O2 benchmark/relax.cpp -o relax_bench && ./relax_bench [頂点数] [辺数] [走査回数]
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <iostream>
+#include <functional>
+#include <random>
+#include <chrono>
+#include <cstdlib>
+#include "../graph/relax.hpp"
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**< @brief 述語を型消去されたstd::functionで受け取る以前の緩和 */
+static void relax_type_erased(graph::vertices_t& V, const graph::edge& e,
+                              std::function<bool(const graph::vertices_t&, graph::index_t)> pred)
+{
+    if (pred(V, e.src) && V[e.dst].d > V[e.src].d + e.w) {
+        V[e.dst].d  = V[e.src].d + e.w;
+        V[e.dst].pi = e.src;
+    }
+}
+
+
+/**
+ * @brief  グラフGのすべての辺をpasses回緩和し、1辺あたりの平均時間[ns]を返す
+ * @param  Relax relax 緩和の手続き relax(V, e)
+ */
+template<class Relax>
+static double measure(const graph::graph_t& G, int passes, Relax relax)
+{
+    using namespace graph;
+    index_t n = G.size();
+    vertices_t V(n);
+    std::size_t m = 0;
+    for (auto&& es : G) { m += es.size(); }
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < passes; ++i) {
+        initialize_single_source(V, 0);
+        for (index_t k = 0; k < n - 1 && k < 8; ++k) {  // 収束に十分な回数だけ走査する
+            for (auto&& es : G) { for (auto&& e : es) { relax(V, e); } }
+        }
+    }
+    auto stop = std::chrono::steady_clock::now();
+
+    volatile weight_t sink = V[n - 1].d; (void)sink;  // 最適化で計算が消えないようにする
+    double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+    return ns / (static_cast<double>(m) * passes * std::min<index_t>(n - 1, 8));
+}
+
+
+
+//****************************************
+// エントリポイント
+//****************************************
+
+int main(int argc, char* argv[])
+{
+    using namespace graph;
+    index_t n    = argc > 1 ? std::atoi(argv[1]) : 100000;
+    index_t m    = argc > 2 ? std::atoi(argv[2]) : 1000000;
+    int  passes  = argc > 3 ? std::atoi(argv[3]) : 5;
+
+    std::mt19937 rng(12345);
+    std::uniform_int_distribution<index_t> vertex(0, n - 1);
+    std::uniform_int_distribution<weight_t> weight(1, 100);
+    graph_t G(n);
+    for (index_t i = 0; i < m; ++i) {
+        index_t u = vertex(rng), v = vertex(rng);
+        G[u].emplace_back(u, v, weight(rng));
+    }
+
+    auto pred = [](const vertices_t& V, index_t u) -> bool { return V[u].d != limits::inf; };
+    double erased  = measure(G, passes, [&](vertices_t& V, const edge& e) { relax_type_erased(V, e, pred); });
+    double inlined = measure(G, passes, [&](vertices_t& V, const edge& e) { relax(V, e, pred); });
+
+    std::cout << "n = " << n << ", m = " << m << "\n";
+    std::cout << "std::function relax : " << erased  << " ns/edge\n";
+    std::cout << "template relax      : " << inlined << " ns/edge\n";
+    return 0;
+}
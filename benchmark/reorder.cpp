@@ -0,0 +1,180 @@
+/**
+ * @brief  頂点の番号を付け替えたときの、bfs, dijkstra, primの速度を比較する
+ *
+ * @note   次の2つのグラフを、頂点の番号を乱数で並べ替えてから生成する(入力の番号が乱雑な場合を模す)
+ *           grid: k * k の格子グラフ(道路網のような、直径の大きい疎なグラフ)
+ *           rmat: R-MATの生成器による、次数の分布が偏ったグラフ
+ *         それぞれについて、番号を付け替えない(identity)、degree_order、bfs_order、reverse_cuthill_mckeeの
+ *         4通りでCSR表現を作り、同じ始点からの探索を繰り返したときの1回あたりの平均時間[ms]と、付け替えに要した時間[ms]を出力する
+ *         結果は元の番号に戻して比べ、すべての順序で一致しなければならない
+ *
+ * @note   ビルドと実行の例
+ *           g++ -std=c++17 -O2 benchmark/reorder.cpp reorder/reorder.cpp bfs/bfs.cpp dijkstra/dijkstra.cpp prim/prim.cpp -pthread -o reorder_bench && ./reorder_bench [格子の一辺] [R-MATの規模] [反復回数]
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <chrono>
+#include <numeric>
+#include <algorithm>
+#include <cstdlib>
+#include "../reorder/reorder.hpp"
+#include "../bfs/bfs.hpp"
+#include "../dijkstra/dijkstra.hpp"
+#include "../prim/prim.hpp"
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**< @brief 経過時間[ms]を返す */
+static double elapsed(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+
+/**< @brief 頂点の番号を乱数で並べ替えたk * kの格子グラフ(無向、重み1以上8以下)を生成する */
+static graph::edges_t grid(graph::index_t k, std::mt19937& rng)
+{
+    using namespace graph;
+    indices_t id(k * k);
+    std::iota(id.begin(), id.end(), 0);
+    std::shuffle(id.begin(), id.end(), rng);
+    std::uniform_int_distribution<weight_t> weight(1, 8);
+    edges_t E;
+    for (index_t i = 0; i < k; ++i) {
+        for (index_t j = 0; j < k; ++j) {
+            index_t u = id[i * k + j];
+            if (j + 1 < k) { weight_t w = weight(rng); E.emplace_back(u, id[i * k + j + 1], w); E.emplace_back(id[i * k + j + 1], u, w); }
+            if (i + 1 < k) { weight_t w = weight(rng); E.emplace_back(u, id[(i + 1) * k + j], w); E.emplace_back(id[(i + 1) * k + j], u, w); }
+        }
+    }
+    return E;
+}
+
+
+/**< @brief 頂点の番号を乱数で並べ替えた、2^scale頂点、平均次数16のR-MATグラフ(無向、重み1以上8以下)を生成する */
+static graph::edges_t rmat(int scale, std::mt19937& rng)
+{
+    using namespace graph;
+    index_t n = index_t(1) << scale;
+    indices_t id(n);
+    std::iota(id.begin(), id.end(), 0);
+    std::shuffle(id.begin(), id.end(), rng);
+    std::uniform_real_distribution<double> coin(0.0, 1.0);
+    std::uniform_int_distribution<weight_t> weight(1, 8);
+    edges_t E;
+    for (index_t i = 0; i < 8 * n; ++i) {
+        index_t u = 0, v = 0;
+        for (int b = 0; b < scale; ++b) {
+            double p = coin(rng);
+            u = 2 * u + (p >= 0.57 + 0.19 ? 1 : 0);
+            v = 2 * v + ((p >= 0.57 && p < 0.57 + 0.19) || p >= 0.95 ? 1 : 0);
+        }
+        weight_t w = weight(rng);
+        E.emplace_back(id[u], id[v], w); E.emplace_back(id[v], id[u], w);
+    }
+    return E;
+}
+
+
+/**
+ * @brief  置換permで付け替えたグラフに対して、bfs, dijkstra, primをruns回ずつ実行し、1回あたりの平均時間を出力する
+ * @note   始点は元の番号でsの頂点である. 各探索の結果を元の番号に戻し、距離の合計と最小全域木の重みをchecksumに加える
+ */
+static void measure(const char* name, const graph::csr_graph& G, graph::index_t s0, const graph::indices_t& perm, double cost, int runs, long long& checksum)
+{
+    using namespace graph;
+    csr_graph H = relabel(G, perm);
+    index_t s = perm[s0];
+    vertices_soa V;
+    checksum = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < runs; ++i) { bfs(H, s, V); }
+    double tb = elapsed(start) / runs;
+    for (auto&& d : restore(V, perm).d) { if (d != limits::inf) { checksum += d; } }
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < runs; ++i) { dijkstra(H, s, V); }
+    double td = elapsed(start) / runs;
+    for (auto&& d : restore(V, perm).d) { if (d != limits::inf) { checksum += d; } }
+
+    start = std::chrono::steady_clock::now();
+    weight_t mst = 0;
+    for (int i = 0; i < runs; ++i) { mst = prim(H, s).second; }
+    double tp = elapsed(start) / runs;
+    checksum += mst;
+
+    std::cout << std::left << std::setw(24) << name << std::right << std::fixed << std::setprecision(2)
+              << std::setw(10) << cost << std::setw(10) << tb << std::setw(10) << td << std::setw(10) << tp << "\n";
+}
+
+
+/**
+ * @brief  グラフGに対して4通りの順序を比べる. すべての順序でchecksumが一致すればtrueを返す
+ * @note   始点は出次数の最大の頂点とする(R-MATでは孤立した頂点が多いため)
+ */
+static bool compare(const char* family, graph::index_t n, const graph::edges_t& E, int runs)
+{
+    using namespace graph;
+    csr_graph G(n, E);
+    index_t s = 0;
+    for (index_t u = 0; u < n; ++u) { if (G.degree(u) > G.degree(s)) { s = u; } }
+    std::cout << family << ": |V| = " << n << ", |E| = " << E.size() << "\n"
+              << std::left << std::setw(24) << "order" << std::right
+              << std::setw(10) << "reorder" << std::setw(10) << "bfs" << std::setw(10) << "dijkstra" << std::setw(10) << "prim" << "  [ms]\n";
+
+    long long sum[4];
+    indices_t identity(n);
+    std::iota(identity.begin(), identity.end(), 0);
+    measure("identity", G, s, identity, 0.0, runs, sum[0]);
+
+    auto start = std::chrono::steady_clock::now();
+    indices_t perm = degree_order(G);
+    measure("degree_order", G, s, perm, elapsed(start), runs, sum[1]);
+
+    start = std::chrono::steady_clock::now();
+    perm = bfs_order(G);
+    measure("bfs_order", G, s, perm, elapsed(start), runs, sum[2]);
+
+    start = std::chrono::steady_clock::now();
+    perm = reverse_cuthill_mckee(G);
+    measure("reverse_cuthill_mckee", G, s, perm, elapsed(start), runs, sum[3]);
+
+    std::cout << "\n";
+    return sum[0] == sum[1] && sum[0] == sum[2] && sum[0] == sum[3];
+}
+
+
+
+//****************************************
+// エントリポイント
+//****************************************
+
+int main(int argc, char* argv[])
+{
+    using namespace graph;
+    index_t k     = argc > 1 ? std::atoi(argv[1]) : 1000;
+    int     scale = argc > 2 ? std::atoi(argv[2]) : 18;
+    int     runs  = argc > 3 ? std::atoi(argv[3]) : 3;
+
+    std::mt19937 rng(12345);
+    bool ok = compare("grid", k * k, grid(k, rng), runs);
+    ok = compare("rmat", index_t(1) << scale, rmat(scale, rng), runs) && ok;
+
+    if (!ok) { std::cerr << "checksum mismatch\n"; return 1; }
+    return 0;
+}
@@ -0,0 +1,104 @@
+/**
+ * @brief  スナップショットから辺を順に読む準外部記憶の最小全域森と連結成分を、メモリの上のkruskalとconnected_componentsと比較する
+ *
+ * @note   乱数で生成した重み1以上1000以下の無向グラフ(各辺を両方向の辺として格納する)をsave_snapshotで書き出し、
+ *           1. load_snapshotで読み込んだグラフに対するkruskalとconnected_components
+ *           2. external_kruskal(辺の連の大きさを辺の配列の8分の1に制限する)とexternal_connected_components
+ *         の時間と、2でファイルを読んだ速さ[MB/s]を出力する. 最後に、最小全域森の重みと連結成分が一致することを確かめる
+ *         (ファイルはページキャッシュに載っているので、ディスクからの読み込みの時間は含まない)
+ *
+ * @note   ビルドと実行の例
+ *           g++ -std=c++17 -O2 -pthread -DGRAPH_NO_MAIN benchmark/semi_external.cpp semi_external/semi_external.cpp snapshot/snapshot.cpp kruskal/kruskal.cpp connected_components/connected_components.cpp -o semi_external_bench && ./semi_external_bench [頂点数] [平均次数] [作業用ディレクトリ]
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <iostream>
+#include <random>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include "../semi_external/semi_external.hpp"
+#include "../snapshot/snapshot.hpp"
+#include "../kruskal/kruskal.hpp"
+#include "../connected_components/connected_components.hpp"
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**< @brief 関数fの実行時間[s]を返す */
+template<class Function>
+static double seconds(Function f)
+{
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(stop - start).count();
+}
+
+
+
+//****************************************
+// エントリポイント
+//****************************************
+
+int main(int argc, char* argv[])
+{
+    using namespace graph;
+    index_t n   = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    index_t deg = argc > 2 ? std::atoi(argv[2]) : 16;
+    std::string dir = argc > 3 ? argv[3] : "/tmp";
+    std::string binary = dir + "/graph_semi_external.csr";
+
+    std::mt19937 rng(12345);
+    std::uniform_int_distribution<index_t> vertex(0, n - 1);
+    std::uniform_int_distribution<weight_t> weight(1, 1000);
+    edges_t E;
+    E.reserve(static_cast<std::size_t>(n) * deg);
+    for (index_t i = 0; i < n * deg / 2; ++i) {
+        index_t u = vertex(rng), v = vertex(rng);
+        weight_t w = weight(rng);
+        E.emplace_back(u, v, w); E.emplace_back(v, u, w);
+    }
+    if (!save_snapshot(binary, csr_graph(n, E))) { std::cerr << "save_snapshot failed\n"; return 1; }
+    const double megabytes = static_cast<double>(E.size()) * (sizeof(index_t) + sizeof(weight_t)) / (1 << 20);
+    std::cout << "|V| = " << n << ", |E| = " << E.size() << " (" << megabytes << " MB of dst and w)\n";
+    edges_t().swap(E);
+
+    csr_graph G;
+    std::pair<edges_t, weight_t> mst;
+    indices_t label;
+    double load = seconds([&] { load_snapshot(binary, G); });
+    double internal = seconds([&] { mst = kruskal(G); });
+    double components = seconds([&] { label = connected_components(G, 1); });
+    std::cout << "in memory : load " << load << " s, kruskal " << internal << " s, connected_components " << components << " s\n";
+    G = csr_graph();
+
+    external_options opt;
+    opt.symmetric = true;
+    opt.memory    = static_cast<std::size_t>(megabytes * (1 << 20)) / 8;  // 辺の連が8個以上に分かれるようにする
+    edges_t A;
+    weight_t w = 0;
+    indices_t L;
+    bool ok = true;
+    double external = seconds([&] { ok = external_kruskal(binary, A, w, opt) && ok; });
+    double single = seconds([&] { ok = external_connected_components(binary, L, opt) && ok; });
+    if (!ok) { std::cerr << "reading the snapshot failed\n"; return 1; }
+    std::cout << "external  : kruskal " << external << " s (" << megabytes / external << " MB/s), "
+              << "connected_components " << single << " s (" << megabytes / single << " MB/s)\n";
+
+    std::remove(binary.c_str());
+    if (w != mst.second || A.size() != mst.first.size()) { std::cerr << "forest weight mismatch\n"; return 1; }
+    if (L != label) { std::cerr << "components mismatch\n"; return 1; }
+    return 0;
+}
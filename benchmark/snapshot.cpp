@@ -0,0 +1,119 @@
+/**
+ * @brief  テキストの辺リストの解析と、バイナリのスナップショットのメモリ写像による読み込みの時間を比較する
+ *
+ * @note   乱数で生成した有向グラフを「n m」の行と「u v w」のm行からなるテキストファイルと、save_snapshotによるスナップショットに
+ *         書き出し、それぞれについて
+ *           1. std::ifstreamから1辺ずつ読んでemplace_backし、csr_graph(n, E)を構成する
+ *           2. read_edge_listでファイルを写像し、並列に解析する
+ *           3. load_snapshotでファイルを写像する
+ *         の時間を出力する. 3ではページは触れたときに読み込まれるので、読み込んだ後にすべての辺の重みを合計する時間も出力する
+ *         (ファイルはページキャッシュに載っているので、ディスクからの読み込みの時間は含まない)
+ *
+ * @note   ビルドと実行の例
+ *           g++ -std=c++17 -O2 -pthread benchmark/snapshot.cpp snapshot/snapshot.cpp edge_list/edge_list.cpp -o snapshot_bench && ./snapshot_bench [頂点数] [辺数] [作業用ディレクトリ]
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <iostream>
+#include <fstream>
+#include <random>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include "../snapshot/snapshot.hpp"
+#include "../edge_list/edge_list.hpp"
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**< @brief 関数fの実行時間[s]を返す */
+template<class Function>
+static double seconds(Function f)
+{
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(stop - start).count();
+}
+
+
+/**< @brief すべての辺の重みの合計を返す(各ページに触れる) */
+static long long weight_sum(const graph::csr_graph& G)
+{
+    long long sum = 0;
+    for (auto&& x : G.w) { sum += x; }
+    return sum;
+}
+
+
+
+//****************************************
+// エントリポイント
+//****************************************
+
+int main(int argc, char* argv[])
+{
+    using namespace graph;
+    index_t n = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    index_t m = argc > 2 ? std::atoi(argv[2]) : 10000000;
+    std::string dir = argc > 3 ? argv[3] : "/tmp";
+    std::string text = dir + "/graph_bench.txt", binary = dir + "/graph_bench.csr";
+
+    std::mt19937 rng(12345);
+    std::uniform_int_distribution<index_t> vertex(0, n - 1);
+    std::uniform_int_distribution<weight_t> weight(1, 1000);
+    edges_t E;
+    E.reserve(m);
+    for (index_t i = 0; i < m; ++i) { E.emplace_back(vertex(rng), vertex(rng), weight(rng)); }
+    csr_graph G(n, E);
+    {
+        std::ofstream out(text);
+        out << n << " " << m << "\n";
+        for (auto&& e : E) { out << e.src << " " << e.dst << " " << e.w << "\n"; }
+    }
+    if (!save_snapshot(binary, G)) { std::cerr << "save_snapshot failed\n"; return 1; }
+    std::cout << "|V| = " << n << ", |E| = " << m << "\n";
+
+    csr_graph T;
+    double parse = seconds([&] {
+        std::ifstream in(text);
+        index_t tn, tm;
+        in >> tn >> tm;
+        edges_t TE;
+        for (index_t i = 0, u, v, w; i < tm && in >> u >> v >> w; ++i) { TE.emplace_back(u, v, w); }
+        T = csr_graph(tn, TE);
+    });
+    std::cout << "text edge list  : " << parse << " s\n";
+
+    csr_graph P;
+    bool ok = true;
+    double fast = seconds([&] { ok = read_edge_list(text, P); });
+    if (!ok || P.offset != T.offset || P.dst != T.dst || P.w != T.w) { std::cerr << "read_edge_list failed\n"; return 1; }
+    std::cout << "read_edge_list  : " << fast << " s\n";
+
+    csr_graph S;
+    double load = seconds([&] { ok = load_snapshot(binary, S); });
+    if (!ok) { std::cerr << "load_snapshot failed\n"; return 1; }
+    long long sum = 0;
+    double scan = seconds([&] { sum = weight_sum(S); });
+    std::cout << "load_snapshot   : " << load * 1e6 << " us (first scan of w: " << scan << " s)\n";
+
+    double verify = seconds([&] { ok = load_snapshot(binary, S, true); });
+    std::cout << "verify = true   : " << verify << " s\n";
+
+    if (!ok || S.offset != T.offset || S.dst != T.dst || S.w != T.w || sum != weight_sum(T)) { std::cerr << "graphs differ\n"; return 1; }
+    std::remove(text.c_str());
+    std::remove(binary.c_str());
+    return 0;
+}
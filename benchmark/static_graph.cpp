@@ -0,0 +1,136 @@
+/**
+ * @brief  小さな固定の大きさのグラフについて、std::arrayによるconstexprの版と、graph_tやmatrix_tに対する実行時の版の時間を比較する
+ *
+ * @note   kruskal.cppのmainの9頂点の無向グラフと、6頂点の有向非巡回グラフ(dsp.cppのmainと同じ大きさ)を、
+ *         1回ごとに辺の重みを1つ変えながら繰り返し解き、1回あたりの時間[ns]を出力する
+ *           1. floyd_warshall(9頂点)
+ *           2. dijkstra(9頂点、始点0)
+ *           3. kruskal(9頂点)
+ *           4. tsort(6頂点)
+ *         実行時の版では、毎回グラフを構成するところから測る. 9頂点のグラフの最小全域木の重みは、翻訳時にstatic_assertでも確かめる
+ *
+ * @note   ビルドと実行の例
+ *           g++ -std=c++17 -O2 -DGRAPH_NO_MAIN benchmark/static_graph.cpp floyd_warshall/floyd_warshall.cpp dijkstra/dijkstra.cpp kruskal/kruskal.cpp topological_sort/tsort.cpp -pthread -o static_graph_bench && ./static_graph_bench [繰り返しの回数]
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include "../static_graph/static_graph.hpp"
+#include "../floyd_warshall/floyd_warshall.hpp"
+#include "../dijkstra/dijkstra.hpp"
+#include "../kruskal/kruskal.hpp"
+#include "../topological_sort/tsort.hpp"
+
+
+
+//****************************************
+// 定数の定義
+//****************************************
+
+namespace {
+
+    constexpr graph::weight_t inf = graph::limits::inf;
+
+    /**< @brief kruskal.cppのmainの9頂点の無向グラフ */
+    constexpr graph::static_matrix<9> mst_graph = {{
+        {   0,   4, inf, inf, inf, inf, inf,   8, inf },
+        {   4,   0,   8, inf, inf, inf, inf,  11, inf },
+        { inf,   8,   0,   7, inf,   4, inf, inf,   2 },
+        { inf, inf,   7,   0,   9,  14, inf, inf, inf },
+        { inf, inf, inf,   9,   0,  10, inf, inf, inf },
+        { inf, inf,   4,  14,  10,   0,   2, inf, inf },
+        { inf, inf, inf, inf, inf,   2,   0,   1,   6 },
+        {   8,  11, inf, inf, inf, inf,   1,   0,   7 },
+        { inf, inf,   2, inf, inf, inf,   6,   7,   0 },
+    }};
+
+    /**< @brief 6頂点の有向非巡回グラフ(10本の辺) */
+    constexpr graph::static_matrix<6> dag = graph::make_static_matrix<6>(std::array<graph::static_edge, 10>{{
+        { 0, 1, 5 }, { 0, 2, 3 }, { 1, 2, 2 }, { 1, 3, 6 }, { 2, 3, 7 },
+        { 2, 4, 4 }, { 2, 5, 2 }, { 3, 4, -1 }, { 3, 5, 1 }, { 4, 5, -2 },
+    }});
+
+    static_assert(graph::kruskal(mst_graph).w == 37, "the minimum spanning tree of the 9-vertex graph weighs 37");
+    static_assert(graph::floyd_warshall(mst_graph)[0][4] == 21, "");
+    static_assert(graph::tsort(dag)[0] == 0 && graph::tsort(dag)[5] == 5, "");
+
+    /**< @brief 負の辺0 → 1だけを持つ3頂点のグラフ. 到達できない要素は∞のままである */
+    constexpr graph::static_matrix<3> negative = graph::make_static_matrix<3>(std::array<graph::static_edge, 1>{{ { 0, 1, -5 } }});
+    static_assert(graph::floyd_warshall(negative)[0][1] == -5, "");
+    static_assert(graph::floyd_warshall(negative)[0][2] == inf && graph::floyd_warshall(negative)[1][0] == inf, "");
+
+}
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**< @brief f(i)をi = 0, 1, ..., k - 1について呼び、1回あたりの時間[ns]を出力する. fの戻り値の合計も出力して、計算を省かれないようにする */
+template<class Function>
+static void measure(const char* name, int k, Function f)
+{
+    long long sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < k; ++i) { sum += f(i); }
+    auto stop = std::chrono::steady_clock::now();
+    std::cout << name << std::chrono::duration<double, std::nano>(stop - start).count() / k << " ns (checksum " << sum << ")\n";
+}
+
+
+/**< @brief 隣接行列Wを隣接リスト表現に直す */
+template<std::size_t N>
+static graph::graph_t to_graph(const graph::static_matrix<N>& W)
+{
+    graph::graph_t G(N);
+    for (graph::index_t i = 0; i < static_cast<graph::index_t>(N); ++i) {
+        for (graph::index_t j = 0; j < static_cast<graph::index_t>(N); ++j) { if (i != j && W[i][j] != inf) { G[i].emplace_back(i, j, W[i][j]); } }
+    }
+    return G;
+}
+
+
+/**< @brief 隣接行列Wをmatrix_tに直す */
+template<std::size_t N>
+static graph::matrix_t to_matrix(const graph::static_matrix<N>& W)
+{
+    graph::matrix_t M(N, graph::array_t(N));
+    for (std::size_t i = 0; i < N; ++i) { for (std::size_t j = 0; j < N; ++j) { M[i][j] = W[i][j]; } }
+    return M;
+}
+
+
+
+//****************************************
+// エントリポイント
+//****************************************
+
+int main(int argc, char* argv[])
+{
+    using namespace graph;
+    int k = argc > 1 ? std::atoi(argv[1]) : 1000000;
+
+    // 1回ごとに辺(6, 7)の重みを変え、結果を翻訳時に畳み込まれないようにする
+    auto mst_input = [](int i) { static_matrix<9> W = mst_graph; W[6][7] = W[7][6] = 1 + (i & 3); return W; };
+    auto dag_input = [](int i) { static_matrix<6> W = dag; W[0][(i & 1) + 4] = 1; return W; };
+
+    measure("floyd_warshall (matrix_t)      : ", k, [&](int i) { return floyd_warshall(to_matrix(mst_input(i)))[0][4]; });
+    measure("floyd_warshall (static_matrix) : ", k, [&](int i) { return floyd_warshall(mst_input(i))[0][4]; });
+    measure("dijkstra (graph_t)             : ", k, [&](int i) { return dijkstra(to_graph(mst_input(i)), 0)[4].d; });
+    measure("dijkstra (static_matrix)       : ", k, [&](int i) { return dijkstra(mst_input(i), 0).d[4]; });
+    measure("kruskal (graph_t)              : ", k, [&](int i) { return kruskal(to_graph(mst_input(i))).second; });
+    measure("kruskal (static_matrix)        : ", k, [&](int i) { return kruskal(mst_input(i)).w; });
+    measure("tsort (graph_t)                : ", k, [&](int i) { return tsort(to_graph(dag_input(i)))[1]; });
+    measure("tsort (static_matrix)          : ", k, [&](int i) { return tsort(dag_input(i))[1]; });
+    return 0;
+}
@@ -0,0 +1,355 @@
+/**
+ * @brief  各アルゴリズムを生成したグラフの族といくつかの大きさで実行し、時間、毎秒の辺数、ヒープの最大使用量を出力する
+ *
+ * @note   グラフの族
+ *           rmat  : R-MAT(a, b, c, d) = (0.57, 0.19, 0.19, 0.05)による次数の偏った有向グラフ. |E| = 8|V|
+ *           grid  : k x kの格子に隣り合う頂点を双方向の辺で結んだ道路網に似た無向グラフ
+ *           dag   : 乱数で選んだ位相順序に沿う辺だけを持つ有向非巡回グラフ. |E| = 8|V|
+ *           dense : 各頂点対を確率1/2で結んだ密な無向グラフ(隣接行列表現も作る)
+ *           flow  : 入口s -> 左の頂点 -> 右の頂点 -> 出口tの2部グラフのフローネットワーク. 左の各頂点から右へ8本の辺を出す
+ *         各族には大きさが3段階あり、辺の重み(容量)は一様な乱数で選ぶ. 乱数の種は固定なので、同じ引数ならば同じグラフになる
+ *
+ * @note   アルゴリズムと族の組み合わせ
+ *           bfs, dfs, dijkstra, bellman_ford          : rmat, grid        (隣接リスト表現graph_t)
+ *           dijkstra(matrix), floyd_warshall           : dense             (隣接行列表現matrix_t)
+ *           prim, kruskal                              : grid, dense       (primはdenseで隣接行列表現も用いる)
+ *           scc                                        : rmat, dag
+ *           tsort                                      : dag
+ *           edmonds_karp, ford_fulkerson               : flow              (残余ネットワークの構築を時間に含む)
+ *
+ * @note   出力はCSVであり、1行目は列名である. 版の間で比べて退行を見つけるために用いる
+ *           algorithm,family,size,n,m,seconds,edges_per_second,peak_bytes,checksum
+ *         secondsはrepeats回の実行の最小値、edges_per_secondは入力グラフの辺数|E|をsecondsで割ったものである
+ *         peak_bytesは1回の実行のあいだに、実行前から確保されていた分を除いてヒープに同時に確保された大きさの最大値である
+ *         (大域のoperator new/deleteを置き換えて数える). checksumは結果から求めた値(距離の和、MSTの重み、最大フローなど)であり、
+ *         版の間で異なれば結果が変わったことを表す
+ *
+ * @note   ビルドと実行の例(最上位のCMakeLists.txtのsuiteターゲット、またはg++で直接ビルドする)
+ *           cmake -S . -B build && cmake --build build --target suite && ./build/suite 1 > result.csv
+ *           g++ -std=c++17 -O2 -pthread -DGRAPH_NO_MAIN benchmark/suite.cpp bfs/bfs.cpp dfs/dfs.cpp dijkstra/dijkstra.cpp \
+ *               bellman_ford/bellman_ford.cpp floyd_warshall/floyd_warshall.cpp prim/prim.cpp kruskal/kruskal.cpp scc/scc.cpp \
+ *               transitive_closure/transitive_closure.cpp topological_sort/tsort.cpp -o suite_bench
+ *           ./suite_bench [大きさの段階数(1~3)] [反復回数] [アルゴリズム名] > result.csv
+ *         アルゴリズム名を与えると、その名前で始まるアルゴリズムだけを実行する(たとえばdijkstraでdijkstraとdijkstra(matrix))
+ *         GRAPH_NO_MAINはkruskal.cppの動作例のmainを除くために定義する
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <iostream>
+#include <random>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <atomic>
+#include <algorithm>
+#include <numeric>
+#include <functional>
+#include <string>
+#include <vector>
+#include "../bfs/bfs.hpp"
+#include "../dfs/dfs.hpp"
+#include "../dijkstra/dijkstra.hpp"
+#include "../bellman_ford/bellman_ford.hpp"
+#include "../floyd_warshall/floyd_warshall.hpp"
+#include "../prim/prim.hpp"
+#include "../kruskal/kruskal.hpp"
+#include "../scc/scc.hpp"
+#include "../topological_sort/tsort.hpp"
+#include "../edmonds_karp/edmonds_karp.hpp"
+#include "../ford_fulkerson/ford_fulkerson.hpp"
+
+
+
+//****************************************
+// ヒープの使用量の計測
+//****************************************
+
+namespace {
+
+    std::atomic<std::size_t> live(0);  /**< 現在確保されている大きさ[byte] */
+    std::atomic<std::size_t> peak(0);  /**< liveの最大値 */
+
+    /**
+     * @brief  大きさnの領域を境界alignで確保し、その直前の境界の分に大きさを記録する
+     * @note   liveを増やしたらpeakを更新する
+     */
+    void* tracked_allocate(std::size_t n, std::size_t align)
+    {
+        align = std::max(align, alignof(std::max_align_t));
+        void* p = std::aligned_alloc(align, (n + align + align - 1) / align * align);
+        if (!p) { throw std::bad_alloc(); }
+        char* q = static_cast<char*>(p) + align;
+        std::memcpy(q - sizeof(std::size_t), &n, sizeof(std::size_t));
+        std::size_t now = live += n, old = peak.load();
+        while (now > old && !peak.compare_exchange_weak(old, now)) {}
+        return q;
+    }
+
+    void tracked_deallocate(void* q, std::size_t align)
+    {
+        if (!q) { return; }
+        align = std::max(align, alignof(std::max_align_t));
+        std::size_t n;
+        std::memcpy(&n, static_cast<char*>(q) - sizeof(std::size_t), sizeof(std::size_t));
+        live -= n;
+        std::free(static_cast<char*>(q) - align);
+    }
+
+}
+
+void* operator new (std::size_t n) { return tracked_allocate(n, alignof(std::max_align_t)); }
+void* operator new[] (std::size_t n) { return tracked_allocate(n, alignof(std::max_align_t)); }
+void* operator new (std::size_t n, std::align_val_t a) { return tracked_allocate(n, static_cast<std::size_t>(a)); }
+void* operator new[] (std::size_t n, std::align_val_t a) { return tracked_allocate(n, static_cast<std::size_t>(a)); }
+void operator delete (void* p) noexcept { tracked_deallocate(p, alignof(std::max_align_t)); }
+void operator delete[] (void* p) noexcept { tracked_deallocate(p, alignof(std::max_align_t)); }
+void operator delete (void* p, std::size_t) noexcept { tracked_deallocate(p, alignof(std::max_align_t)); }
+void operator delete[] (void* p, std::size_t) noexcept { tracked_deallocate(p, alignof(std::max_align_t)); }
+void operator delete (void* p, std::align_val_t a) noexcept { tracked_deallocate(p, static_cast<std::size_t>(a)); }
+void operator delete[] (void* p, std::align_val_t a) noexcept { tracked_deallocate(p, static_cast<std::size_t>(a)); }
+void operator delete (void* p, std::size_t, std::align_val_t a) noexcept { tracked_deallocate(p, static_cast<std::size_t>(a)); }
+void operator delete[] (void* p, std::size_t, std::align_val_t a) noexcept { tracked_deallocate(p, static_cast<std::size_t>(a)); }
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief 生成したグラフ
+ */
+struct instance {
+    std::string     family;   /**< 族の名前 */
+    int             size;     /**< 大きさの段階(0, 1, 2) */
+    graph::graph_t  G;        /**< 隣接リスト表現 */
+    graph::matrix_t M;        /**< 隣接行列表現(denseのみ. 辺がなければ∞、対角要素は0) */
+    graph::index_t  s = 0;    /**< 始点(フローネットワークの入口) */
+    graph::index_t  t = 0;    /**< フローネットワークの出口 */
+
+    graph::index_t  n() const { return static_cast<graph::index_t>(G.size()); }
+    long long       m() const { long long k = 0; for (auto&& es : G) { k += es.size(); } return k; }
+};
+
+
+/**
+ * @brief 実行するアルゴリズム. runはinstanceに対してアルゴリズムを1回実行し、checksumを返す
+ */
+struct algorithm {
+    std::string                              name;
+    std::vector<std::string>                 families;
+    std::function<long long(const instance&)> run;
+};
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+namespace {
+
+    using namespace graph;
+
+    /**< @brief 頂点u, vを重みwの双方向の辺で結ぶ */
+    void connect(graph_t& G, index_t u, index_t v, weight_t w)
+    {
+        G[u].emplace_back(u, v, w);
+        G[v].emplace_back(v, u, w);
+    }
+
+
+    /**< @brief 2^scale頂点、8 * 2^scale辺のR-MATグラフを生成する */
+    instance make_rmat(int size, std::mt19937& rng)
+    {
+        const int scale = 12 + 2 * size;
+        const index_t n = index_t(1) << scale;
+        std::uniform_real_distribution<double> coin(0.0, 1.0);
+        std::uniform_int_distribution<weight_t> weight(1, 100);
+        instance I { "rmat", size, graph_t(n), {} };
+        for (index_t i = 0; i < 8 * n; ++i) {
+            index_t u = 0, v = 0;
+            for (int b = 0; b < scale; ++b) {
+                double r = coin(rng);
+                u = (u << 1) | (r >= 0.76);                            // 象限c, dならば下半分
+                v = (v << 1) | (r >= 0.57 && r < 0.76) | (r >= 0.95);  // 象限b, dならば右半分
+            }
+            I.G[u].emplace_back(u, v, weight(rng));
+        }
+        return I;
+    }
+
+
+    /**< @brief k x kの格子グラフを生成する */
+    instance make_grid(int size, std::mt19937& rng)
+    {
+        const index_t k = 64 << size;
+        std::uniform_int_distribution<weight_t> weight(1, 100);
+        instance I { "grid", size, graph_t(k * k), {} };
+        for (index_t r = 0; r < k; ++r) {
+            for (index_t c = 0; c < k; ++c) {
+                if (c + 1 < k) { connect(I.G, r * k + c, r * k + c + 1, weight(rng)); }
+                if (r + 1 < k) { connect(I.G, r * k + c, (r + 1) * k + c, weight(rng)); }
+            }
+        }
+        return I;
+    }
+
+
+    /**< @brief 乱数で選んだ位相順序に沿う8|V|本の辺を持つ有向非巡回グラフを生成する */
+    instance make_dag(int size, std::mt19937& rng)
+    {
+        const index_t n = 4096 << (2 * size);
+        indices_t order(n);
+        std::iota(order.begin(), order.end(), 0);
+        std::shuffle(order.begin(), order.end(), rng);
+        std::uniform_int_distribution<index_t> vertex(0, n - 1);
+        std::uniform_int_distribution<weight_t> weight(1, 100);
+        instance I { "dag", size, graph_t(n), {} };
+        for (index_t i = 0; i < 8 * n; ++i) {
+            index_t a = vertex(rng), b = vertex(rng);
+            if (a == b) { continue; }
+            if (a > b) { std::swap(a, b); }
+            I.G[order[a]].emplace_back(order[a], order[b], weight(rng));
+        }
+        return I;
+    }
+
+
+    /**< @brief 各頂点対を確率1/2で結んだ密な無向グラフを、隣接リスト表現と隣接行列表現の両方で生成する */
+    instance make_dense(int size, std::mt19937& rng)
+    {
+        const index_t n = 128 << size;
+        std::uniform_int_distribution<weight_t> weight(1, 100);
+        instance I { "dense", size, graph_t(n), matrix_t(n, array_t(n, limits::inf)) };
+        for (index_t u = 0; u < n; ++u) {
+            I.M[u][u] = 0;
+            for (index_t v = u + 1; v < n; ++v) {
+                if (rng() & 1) { continue; }
+                weight_t w = weight(rng);
+                connect(I.G, u, v, w);
+                I.M[u][v] = I.M[v][u] = w;
+            }
+        }
+        return I;
+    }
+
+
+    /**< @brief 入口s、左の頂点L個、右の頂点L個、出口tからなる2部グラフのフローネットワークを生成する */
+    instance make_flow(int size, std::mt19937& rng)
+    {
+        const index_t L = 256 << (2 * size);
+        std::uniform_int_distribution<index_t> right(L + 1, 2 * L);
+        std::uniform_int_distribution<capacity_t> capacity(1, 4);
+        instance I { "flow", size, graph_t(2 * L + 2), {} };
+        I.s = 0; I.t = 2 * L + 1;
+        for (index_t u = 1; u <= L; ++u) {
+            I.G[I.s].emplace_back(I.s, u, capacity(rng));
+            for (int i = 0; i < 8; ++i) { I.G[u].emplace_back(u, right(rng), capacity(rng)); }
+        }
+        for (index_t v = L + 1; v <= 2 * L; ++v) { I.G[v].emplace_back(v, I.t, capacity(rng)); }
+        return I;
+    }
+
+
+    /**< @brief 頂点集合Vのうち到達できた頂点のd値の和を返す */
+    long long distance_sum(const vertices_t& V)
+    {
+        long long sum = 0;
+        for (auto&& v : V) { if (v.d != limits::inf) { sum += v.d; } }
+        return sum;
+    }
+
+
+    /**< @brief 実行するアルゴリズムの一覧を返す */
+    std::vector<algorithm> algorithms()
+    {
+        return {
+            { "bfs",              { "rmat", "grid" },  [](const instance& I) { return distance_sum(bfs(I.G, I.s)); } },
+            { "dfs",              { "rmat", "grid" },  [](const instance& I) {
+                auto r = dfs(I.G);
+                return std::accumulate(r.second.begin(), r.second.end(), 0LL);
+            } },
+            { "dijkstra",         { "rmat", "grid" },  [](const instance& I) { return distance_sum(dijkstra(I.G, I.s)); } },
+            { "dijkstra(matrix)", { "dense" },         [](const instance& I) { return distance_sum(dijkstra(I.M, I.s)); } },
+            { "bellman_ford",     { "rmat", "grid" },  [](const instance& I) { return distance_sum(bellman_ford(I.G, I.s).second); } },
+            { "floyd_warshall",   { "dense" },         [](const instance& I) {
+                long long sum = 0;
+                for (auto&& row : floyd_warshall(I.M)) { for (auto&& d : row) { if (d != limits::inf) { sum += d; } } }
+                return sum;
+            } },
+            { "prim",             { "grid", "dense" }, [](const instance& I) { return static_cast<long long>(prim(I.G, I.s).second); } },
+            { "prim(matrix)",     { "dense" },         [](const instance& I) { return static_cast<long long>(prim(I.M, I.s).second); } },
+            { "kruskal",          { "grid", "dense" }, [](const instance& I) { return static_cast<long long>(kruskal(I.G).second); } },
+            { "scc",              { "rmat", "dag" },   [](const instance& I) {
+                indices_t C = scc(I.G);
+                return C.empty() ? 0LL : *std::max_element(C.begin(), C.end()) + 1LL;
+            } },
+            { "tsort",            { "dag" },           [](const instance& I) {
+                indices_t L = tsort(I.G);
+                long long sum = 0;
+                for (std::size_t i = 0; i < L.size(); ++i) { sum += static_cast<long long>(i % 1024) * L[i]; }
+                return sum;
+            } },
+            { "edmonds_karp",     { "flow" },          [](const instance& I) { edmonds_karp F(I.G); return static_cast<long long>(F.compute(I.s, I.t)); } },
+            { "ford_fulkerson",   { "flow" },          [](const instance& I) { ford_fulkerson F(I.G); return static_cast<long long>(F.compute(I.s, I.t)); } },
+        };
+    }
+
+}
+
+
+
+//****************************************
+// エントリポイント
+//****************************************
+
+int main(int argc, char* argv[])
+{
+    const int sizes   = argc > 1 ? std::max(1, std::min(3, std::atoi(argv[1]))) : 3;
+    const int repeats = argc > 2 ? std::max(1, std::atoi(argv[2])) : 3;
+    const std::string filter = argc > 3 ? argv[3] : "";
+
+    using generator = instance (*)(int, std::mt19937&);
+    const std::pair<const char*, generator> families[] = {
+        { "rmat", make_rmat }, { "grid", make_grid }, { "dag", make_dag }, { "dense", make_dense }, { "flow", make_flow },
+    };
+    const std::vector<algorithm> A = algorithms();
+
+    std::cout << "algorithm,family,size,n,m,seconds,edges_per_second,peak_bytes,checksum\n";
+    for (auto&& f : families) {
+        for (int size = 0; size < sizes; ++size) {
+            std::mt19937 rng(12345 + size);
+            const instance I = f.second(size, rng);
+            const long long m = I.m();
+            for (auto&& a : A) {
+                if (a.name.compare(0, filter.size(), filter) != 0) { continue; }
+                if (std::find(a.families.begin(), a.families.end(), f.first) == a.families.end()) { continue; }
+
+                double best = 1e300;
+                std::size_t most = 0;
+                long long checksum = 0;
+                for (int r = 0; r < repeats; ++r) {
+                    const std::size_t base = live.load();
+                    peak = base;
+                    auto start = std::chrono::steady_clock::now();
+                    checksum = a.run(I);
+                    auto stop = std::chrono::steady_clock::now();
+                    best = std::min(best, std::chrono::duration<double>(stop - start).count());
+                    most = std::max(most, peak.load() - base);
+                }
+                std::cout << a.name << "," << I.family << "," << size << "," << I.n() << "," << m << ","
+                          << best << "," << static_cast<long long>(m / std::max(best, 1e-9)) << "," << most << "," << checksum << std::endl;
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,94 @@
+/**
+ * @brief  重みの型を特性(graph_traits)で選んだときの、Dijkstraのアルゴリズムの速度を比較する
+ *
+ * @note   乱数で生成した重み1以上8以下の有向グラフを、重みの型が
+ *           1. std::int32_t  (default_traits)
+ *           2. std::int64_t  (wide_traits)
+ *           3. std::uint16_t (narrow_traits)
+ *           4. double        (real_traits)
+ *         であるCSR表現に変換し、それぞれについて同じ始点からのdijkstraを繰り返したときの1回あたりの平均時間と、
+ *         重みの配列G.wと距離の配列S.dの大きさの合計を出力する. 最短路重みはすべての型で一致しなければならない
+ *
+ * @note   ビルドと実行の例
+ *           g++ -std=c++17 -O2 benchmark/traits.cpp dijkstra/dijkstra.cpp -o traits_bench && ./traits_bench [頂点数] [辺数] [反復回数]
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <iostream>
+#include <random>
+#include <chrono>
+#include <cstdlib>
+#include "../dijkstra/dijkstra.hpp"
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**
+ * @brief  辺集合Eを特性Traitsによる辺集合に変換してCSR表現を構成し、始点0からのdijkstraをruns回繰り返す
+ * @note   1回あたりの平均時間[ms]を返す. 到達できる頂点の最短路重みの合計をchecksumに格納する
+ */
+template<class Traits>
+static double measure(const char* name, graph::index_t n, const graph::edges_t& E, int runs, long long& checksum)
+{
+    using namespace graph;
+    basic_edges_t<Traits> F;
+    F.reserve(E.size());
+    for (auto&& e : E) { F.emplace_back(e.src, e.dst, static_cast<typename Traits::weight_type>(e.w)); }
+    basic_csr_graph<Traits> G(n, F);
+    basic_vertices_soa<Traits> S(n);
+    dary_heap<4, Traits> Q(n);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < runs; ++i) { dijkstra(G, 0, S, Q); }
+    auto stop = std::chrono::steady_clock::now();
+    double ms = std::chrono::duration<double, std::milli>(stop - start).count() / runs;
+
+    checksum = 0;
+    for (index_t v = 0; v < n; ++v) {
+        if (S.d[v] != Traits::inf()) { checksum += static_cast<long long>(S.d[v]); }
+    }
+    std::size_t bytes = G.w.size() * sizeof(G.w[0]) + S.d.size() * sizeof(S.d[0]);
+    std::cout << name << ms << " ms/run (w + d: " << bytes / (1 << 20) << " MiB)\n";
+    return ms;
+}
+
+
+
+//****************************************
+// エントリポイント
+//****************************************
+
+int main(int argc, char* argv[])
+{
+    using namespace graph;
+    index_t n    = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    index_t m    = argc > 2 ? std::atoi(argv[2]) : 8000000;
+    int     runs = argc > 3 ? std::atoi(argv[3]) : 5;
+
+    std::mt19937 rng(12345);
+    std::uniform_int_distribution<index_t> vertex(0, n - 1);
+    std::uniform_int_distribution<weight_t> weight(1, 8);
+    edges_t E;
+    E.reserve(m);
+    for (index_t i = 0; i < m; ++i) { E.emplace_back(vertex(rng), vertex(rng), weight(rng)); }
+    std::cout << "|V| = " << n << ", |E| = " << m << "\n";
+
+    long long sum[4];
+    measure<default_traits>("int32_t  : ", n, E, runs, sum[0]);
+    measure<wide_traits>   ("int64_t  : ", n, E, runs, sum[1]);
+    measure<narrow_traits> ("uint16_t : ", n, E, runs, sum[2]);
+    measure<real_traits>   ("double   : ", n, E, runs, sum[3]);
+
+    if (sum[0] != sum[1] || sum[0] != sum[2] || sum[0] != sum[3]) { std::cerr << "checksum mismatch\n"; return 1; }
+    return 0;
+}
@@ -0,0 +1,104 @@
+/**
+ * @brief  小さな近傍にしか到達しない問い合わせを繰り返すとき、作業領域search_workspaceを使い回す効果を測る
+ *
+ * @note   頂点数kの小さな連結成分を多数並べたグラフ(|V| = k x 成分の数)を乱数で生成し、始点を変えてbfsとdijkstraを繰り返す
+ *         vertices_soaを渡す版は呼び出しのたびに|V|個の頂点属性を初期化するので、1回の問い合わせにΘ(V)時間かかる
+ *         search_workspaceを渡す版は触れた頂点だけを初期化するので、1回の問い合わせの時間は成分の大きさkだけで決まる
+ *         両者のd値が一致することも確かめる
+ *
+ * @note   ビルドと実行の例
+ *           g++ -std=c++17 -O2 benchmark/workspace.cpp bfs/bfs.cpp dijkstra/dijkstra.cpp -o workspace_bench && ./workspace_bench [成分の数] [成分の頂点数] [問い合わせの回数]
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <iostream>
+#include <random>
+#include <chrono>
+#include <cstdlib>
+#include "../bfs/bfs.hpp"
+#include "../dijkstra/dijkstra.hpp"
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**< @brief 頂点数kの連結成分をparts個並べたCSR表現のグラフを生成する. 各成分は閉路に乱数の弦を加えたものである */
+static graph::csr_graph make_clusters(graph::index_t parts, graph::index_t k, unsigned seed)
+{
+    using namespace graph;
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<index_t>  pick(0, k - 1);
+    std::uniform_int_distribution<weight_t> weight(1, 100);
+    graph_t G(static_cast<std::size_t>(parts) * k);
+    for (index_t c = 0; c < parts; ++c) {
+        index_t base = c * k;
+        for (index_t i = 0; i < k; ++i) {
+            index_t u = base + i;
+            G[u].emplace_back(u, base + (i + 1) % k, weight(rng));
+            G[u].emplace_back(u, base + pick(rng), weight(rng));
+        }
+    }
+    return csr_graph(G);
+}
+
+
+/**< @brief 始点sourcesの各頂点から問い合わせquery(s)を行い、1回あたりの平均時間[us]を返す */
+template<class Query>
+static double measure(const graph::indices_t& sources, Query query)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (auto&& s : sources) { query(s); }
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(stop - start).count() / sources.size();
+}
+
+
+
+//****************************************
+// エントリポイント
+//****************************************
+
+int main(int argc, char* argv[])
+{
+    using namespace graph;
+    index_t parts   = argc > 1 ? std::atoi(argv[1]) : 100000;
+    index_t k       = argc > 2 ? std::atoi(argv[2]) : 32;
+    index_t queries = argc > 3 ? std::atoi(argv[3]) : 2000;
+
+    csr_graph G = make_clusters(parts, k, 12345);
+    std::cout << "|V| = " << G.size() << ", |E| = " << G.edge_count() << ", component size = " << k << "\n";
+
+    std::mt19937 rng(54321);
+    std::uniform_int_distribution<index_t> pick(0, G.size() - 1);
+    indices_t sources(queries);
+    for (auto&& s : sources) { s = pick(rng); }
+
+    vertices_soa     S;
+    search_workspace W(G.size());  // 最初の確保は計測から除く
+    double bfs_soa = measure(sources, [&](index_t s) { bfs(G, s, S); });
+    double bfs_ws  = measure(sources, [&](index_t s) { bfs(G, s, W); });
+    double dij_soa = measure(sources, [&](index_t s) { dijkstra(G, s, S); });
+    double dij_ws  = measure(sources, [&](index_t s) { dijkstra(G, s, W); });
+
+    std::cout << "bfs      vertices_soa     : " << bfs_soa << " us/query\n";
+    std::cout << "bfs      search_workspace : " << bfs_ws  << " us/query (" << bfs_soa / bfs_ws << "x)\n";
+    std::cout << "dijkstra vertices_soa     : " << dij_soa << " us/query\n";
+    std::cout << "dijkstra search_workspace : " << dij_ws  << " us/query (" << dij_soa / dij_ws << "x)\n";
+
+    for (auto&& s : sources) {
+        dijkstra(G, s, S); dijkstra(G, s, W);
+        for (index_t v = s / k * k; v < s / k * k + k; ++v) {
+            if (S.d[v] != W.dist(v)) { std::cerr << "distance mismatch at " << v << "\n"; return 1; }
+        }
+    }
+    return 0;
+}
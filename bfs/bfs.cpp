@@ -15,8 +15,10 @@
 #include <utility>
 #include <algorithm>
 #include <vector>
-#include <queue>
+#include <cstdint>
+#include <atomic>
 
+#include "../graph/stats.hpp"
 #include "bfs.hpp"
 
 
@@ -57,47 +59,332 @@ GRAPH_BEGIN
  *
  * @note   BFSの総実行時間はΟ(V+E)である.したがって、幅優先探索はGの隣接リスト表現のサイズの線形時間で走る
  *
- * @param  const graph& G  グラフG
+ * @note   キューQは配列の区間[head, Q.size())で表す. 各頂点は高々1回しかQに置かれないので、配列の長さは|V|を超えない
+ *
+ * @tparam Graph   グラフGの表現(graph_t, csr_graphまたはcompressed_graph)
+ * @tparam Vertices 頂点集合の表現(vertices_soaまたはsearch_workspace)
+ * @param  const Graph& G  グラフG
  * @param  index_t s  始点s
- * @return 幅優先木
+ * @param  Vertices& V  幅優先木
+ * @param  indices_t& Q  キューに用いる配列
  */
-vertices_t bfs(const graph_t& G, index_t s)
+template<class Graph, class Vertices>
+static void bfs_impl(const Graph& G, index_t s, Vertices& V, indices_t& Q)
 {
     index_t n = G.size();
-    vertices_t V(n);
 
-    for (auto&& u : V) {            // すべての頂点uについて、
-        u.color = vcolor::white;    // uを白に彩色し、
-        u.d     = limits::inf;      // u.dを無限大に設定し、
-        u.pi    = limits::nil;      // uの親をNILに設定する
+    {
+        GRAPH_STAT_PHASE("initialize");
+        V.resize(n);                // すべての頂点uについて、uを白に彩色し、u.dを無限大に設定し、uの親をNILに設定する
     }
+    GRAPH_STAT_PHASE("search");
     // 手続き開始と同時に始点sを発見すると考え、
-    V[s].color = vcolor::gray;      // 始点sを灰色に彩色する 
-    V[s].d     = 0;                 // s.dを0に初期化し、
-    V[s].pi    = limits::nil;       // 始点の先行点をNILに設定する
+    V.paint(s, vcolor::gray);       // 始点sを灰色に彩色する 
+    V.d[s]  = 0;                    // s.dを0に初期化し、
+    V.pi[s] = limits::nil;          // 始点の先行点をNILに設定する
 
-    std::queue<index_t> Q;
-    Q.push(s);                      // sだけを含むようにQを初期化する
+    Q.assign(1, s);                 // sだけを含むようにQを初期化する
 
-    // 以下のwhile文に対して、つぎのループ不変式が成立する
-    // while文の条件判定を行う時点ではキューQはすべての灰頂点を含む
-    while (!Q.empty()) {
-        index_t u = Q.front(); Q.pop();
+    // 以下のfor文に対して、つぎのループ不変式が成立する
+    // for文の条件判定を行う時点ではキューQはすべての灰頂点を含む
+    for (std::size_t head = 0; head < Q.size(); ) {
+        index_t u = Q[head++];
+        GRAPH_STAT_ADD(edges_scanned, G[u].size());
         for (auto&& e : G[u]) {                  // uの隣接リストに
             index_t v = e.dst;                   // 属する各頂点vを考える
-            if (V[v].color == vcolor::white) {   // vが白ならvは未発見である
-                V[v].color = vcolor::gray;       // vを灰色に彩色し、
-                V[v].d     = V[u].d + 1;         // 距離v.dをu.d+1に設定し、
-                V[v].pi    = u;                  // uをその親v.piとして記録し、
-                Q.push(v);                       // vをキューQの末尾に置く
+            if (V.color(v) == vcolor::white) {   // vが白ならvは未発見である
+                V.paint(v, vcolor::gray);        // vを灰色に彩色し、
+                V.d[v]  = V.d[u] + 1;            // 距離v.dをu.d+1に設定し、
+                V.pi[v] = u;                     // uをその親v.piとして記録し、
+                Q.push_back(v);                  // vをキューQの末尾に置く
             }
         }
-        V[u].color = vcolor::black;  // uの隣接リストに属するすべての頂点の探索が完了すると、この頂点を黒に彩色する
+        V.paint(u, vcolor::black);   // uの隣接リストに属するすべての頂点の探索が完了すると、この頂点を黒に彩色する
     }
     // ある頂点を灰に彩色したときには、この頂点をQへ挿入し、ある頂点をQから削除したときには、この頂点を黒に彩色するので、
     // ループ不変式が保存される
+    GRAPH_STAT_ADD(bfs_levels, V.d[Q.back()] + 1);  // 頂点は距離の順にQに置かれるので、最後の頂点が最も遠い
+}
+
+
+/**< @brief 隣接リスト表現のグラフGに対して幅優先探索を行います */
+vertices_t bfs(const graph_t& G, index_t s)
+{
+    vertices_soa V;
+    bfs(G, s, V);
+    return V.to_vertices();
+}
+
+
+/**< @brief CSR表現のグラフGに対して幅優先探索を行います */
+vertices_t bfs(const csr_graph& G, index_t s)
+{
+    vertices_soa V;
+    bfs(G, s, V);
+    return V.to_vertices();
+}
+
+
+/**< @brief 隣接リスト表現のグラフGに対して幅優先探索を行い、結果を配列の構造体Vに格納する */
+void bfs(const graph_t& G, index_t s, vertices_soa& V)
+{
+    indices_t Q;
+    bfs_impl(G, s, V, Q);
+}
+
+
+/**< @brief CSR表現のグラフGに対して幅優先探索を行い、結果を配列の構造体Vに格納する */
+void bfs(const csr_graph& G, index_t s, vertices_soa& V)
+{
+    indices_t Q;
+    bfs_impl(G, s, V, Q);
+}
+
+
+/**< @brief 隣接リスト表現のグラフGに対して、作業領域Wを使い回して幅優先探索を行う */
+void bfs(const graph_t& G, index_t s, search_workspace& W)
+{
+    bfs_impl(G, s, W, W.fifo);
+}
 
-    return V;
+
+/**< @brief CSR表現のグラフGに対して、作業領域Wを使い回して幅優先探索を行う */
+void bfs(const csr_graph& G, index_t s, search_workspace& W)
+{
+    bfs_impl(G, s, W, W.fifo);
+}
+
+
+/**< @brief 圧縮表現のグラフGに対して幅優先探索を行います */
+vertices_t bfs(const compressed_graph& G, index_t s)
+{
+    vertices_soa V;
+    bfs(G, s, V);
+    return V.to_vertices();
+}
+
+
+/**< @brief 圧縮表現のグラフGに対して幅優先探索を行い、結果を配列の構造体Vに格納する */
+void bfs(const compressed_graph& G, index_t s, vertices_soa& V)
+{
+    indices_t Q;
+    bfs_impl(G, s, V, Q);
+}
+
+
+/**< @brief 圧縮表現のグラフGに対して、作業領域Wを使い回して幅優先探索を行う */
+void bfs(const compressed_graph& G, index_t s, search_workspace& W)
+{
+    bfs_impl(G, s, W, W.fifo);
+}
+
+
+/**< @brief ビット行列で表したグラフAに対して、語ごとに並列な幅優先探索を行います */
+vertices_t bfs(const bit_matrix& A, index_t s)
+{
+    vertices_soa V;
+    bfs(A, s, V);
+    return V.to_vertices();
+}
+
+
+/**
+ * @brief  ビット行列で表したグラフAに対して、語ごとに並列な幅優先探索を行い、結果を配列の構造体Vに格納する
+ * @note   フロンティアの頂点は、その段の走査を終えたときに黒に彩色する
+ */
+void bfs(const bit_matrix& A, index_t s, vertices_soa& V)
+{
+    using word_t = bit_matrix::word_t;
+    constexpr std::size_t bits = bit_matrix::bits;
+    const index_t n = static_cast<index_t>(A.size());
+    const std::size_t words = A.words();
+
+    V.resize(n);
+    V.paint(s, vcolor::gray);
+    V.d[s]  = 0;
+    V.pi[s] = limits::nil;
+
+    std::vector<word_t> seen(words, 0), frontier(words, 0), next(words);
+    seen[s / bits] = frontier[s / bits] = word_t(1) << (s % bits);
+
+    for (weight_t level = 1; ; ++level) {
+        std::fill(next.begin(), next.end(), word_t(0));
+        bool found = false;
+        for (std::size_t k = 0; k < words; ++k) {
+            for (word_t x = frontier[k]; x != 0; x &= x - 1) {
+                index_t u = static_cast<index_t>(k * bits + __builtin_ctzll(x));
+                const word_t* r = A.row(u);
+                GRAPH_STAT_ADD(edges_scanned, words);
+                for (std::size_t l = 0; l < words; ++l) {
+                    word_t fresh = r[l] & ~(seen[l] | next[l]);  // uから初めて発見される頂点
+                    if (fresh == 0) { continue; }
+                    next[l] |= fresh;
+                    found = true;
+                    for (; fresh != 0; fresh &= fresh - 1) {
+                        index_t v = static_cast<index_t>(l * bits + __builtin_ctzll(fresh));
+                        V.paint(v, vcolor::gray);
+                        V.d[v]  = level;
+                        V.pi[v] = u;
+                    }
+                }
+                V.paint(u, vcolor::black);
+            }
+        }
+        if (!found) { GRAPH_STAT_ADD(bfs_levels, level); break; }
+        for (std::size_t l = 0; l < words; ++l) { seen[l] |= next[l]; }
+        frontier.swap(next);
+    }
+}
+
+
+/**
+ * @brief  方向最適化幅優先探索を行い、結果を配列の構造体Vに格納する
+ *
+ * @note   フロンティアは頂点の列frontierとビットマップinfrontの両方で保持する
+ *         ビットマップはボトムアップの段でだけ必要なので、その段の前にfrontierの頂点のビットを立て、段の後に下ろす
+ */
+std::size_t bfs_direction_optimizing(const csr_graph& G, const csr_graph& GT, index_t s, vertices_soa& V,
+                                     const bfs_direction_params& params)
+{
+    index_t n = G.size();
+    V.resize(n);
+    V.paint(s, vcolor::gray);
+    V.d[s]  = 0;
+    V.pi[s] = limits::nil;
+
+    std::vector<std::uint64_t> infront((n + 63) / 64, 0);
+    auto test = [&](index_t u) { return (infront[u >> 6] >> (u & 63)) & 1; };
+    auto flip = [&](index_t u) { infront[u >> 6] ^= std::uint64_t(1) << (u & 63); };
+
+    indices_t frontier(1, s), next;
+    std::size_t examined = 0;
+    std::size_t mu = static_cast<std::size_t>(GT.edge_count()) - GT.degree(s);  // 未訪問の頂点に入る辺の数m_u
+    std::size_t mf = G.degree(s);                                                 // フロンティアから出る辺の数m_f
+    bool bottomup = false;
+
+    for (weight_t level = 0; !frontier.empty(); ++level) {
+        GRAPH_STAT_ADD(bfs_levels, 1);
+        if (!bottomup && mf > mu / params.alpha) { bottomup = true; }
+        else if (bottomup && frontier.size() < n / params.beta) { bottomup = false; }
+
+        next.clear();
+        mf = 0;
+        if (!bottomup) {
+            // トップダウン : フロンティアの各頂点uから出る辺(u, v)を調べる
+            for (auto&& u : frontier) {
+                for (auto&& e : G[u]) {
+                    ++examined;
+                    index_t v = e.dst;
+                    if (V.color(v) == vcolor::white) {
+                        V.paint(v, vcolor::gray);
+                        V.d[v]  = level + 1;
+                        V.pi[v] = u;
+                        next.push_back(v);
+                        mu -= GT.degree(v); mf += G.degree(v);
+                    }
+                }
+            }
+        }
+        else {
+            // ボトムアップ : 未訪問の各頂点vに入る辺(u, v)を、uがフロンティアに見つかるまで調べる
+            for (auto&& u : frontier) { flip(u); }
+            for (index_t v = 0; v < n; ++v) {
+                if (V.color(v) != vcolor::white) { continue; }
+                for (auto&& e : GT[v]) {
+                    ++examined;
+                    index_t u = e.dst;
+                    if (test(u)) {
+                        V.paint(v, vcolor::gray);
+                        V.d[v]  = level + 1;
+                        V.pi[v] = u;
+                        next.push_back(v);
+                        mu -= GT.degree(v); mf += G.degree(v);
+                        break;
+                    }
+                }
+            }
+            for (auto&& u : frontier) { flip(u); }
+        }
+        for (auto&& u : frontier) { V.paint(u, vcolor::black); }
+        frontier.swap(next);
+    }
+    GRAPH_STAT_ADD(edges_scanned, examined);
+    return examined;
+}
+
+
+/**< @brief G^Tを計算してから方向最適化幅優先探索を行う */
+std::size_t bfs_direction_optimizing(const csr_graph& G, index_t s, vertices_soa& V, const bfs_direction_params& params)
+{
+    return bfs_direction_optimizing(G, transpose(G), s, V, params);
+}
+
+
+/**
+ * @brief  CSR表現のグラフGに対して、threads本のスレッドで段同期の幅優先探索を行う
+ *
+ * @note   フロンティアは2本の配列F[0], F[1]を段ごとに交互に用いる. 各段は3回の待ち合わせで区切られる
+ *           1. 各スレッドはフロンティアの区間をchunk個ずつ取り、発見した頂点を局所バッファlocal[tid]に置く
+ *           2. スレッド0が各バッファの書き込み位置を計算し、次のフロンティアの大きさを決める
+ *           3. 各スレッドは自分のバッファを次のフロンティアに写す
+ */
+void bfs_parallel(const csr_graph& G, index_t s, vertices_soa& V, unsigned threads)
+{
+    constexpr std::size_t chunk = 64;  // 1回に取るフロンティアの頂点の数
+    index_t n = G.size();
+    threads = resolve_threads(threads);
+
+    V.resize(n);
+    std::vector<std::atomic<index_t>> parent(n);
+    for (auto&& p : parent) { p.store(limits::nil, std::memory_order_relaxed); }
+    parent[s].store(s, std::memory_order_relaxed);  // 始点はそれ自身を親として獲得済みとしておく
+    V.d[s] = 0;
+
+    indices_t F[2] = { indices_t(1, s), indices_t() };
+    std::vector<indices_t> local(threads);
+    indices_t offset(threads + 1, 0);
+    std::atomic<std::size_t> cursor(0);
+    barrier sync(threads);
+
+    parallel_run(threads, [&](unsigned tid) {
+        for (weight_t level = 0; !F[level & 1].empty(); ++level) {
+            const indices_t& cur = F[level & 1];
+            indices_t& out = local[tid];
+            for (std::size_t i; (i = cursor.fetch_add(chunk, std::memory_order_relaxed)) < cur.size(); ) {
+                std::size_t last = std::min(i + chunk, cur.size());
+                for (; i < last; ++i) {
+                    index_t u = cur[i];
+                    for (auto&& e : G[u]) {
+                        index_t v = e.dst, nil = limits::nil;
+                        if (parent[v].load(std::memory_order_relaxed) == nil &&
+                            parent[v].compare_exchange_strong(nil, u, std::memory_order_relaxed)) {
+                            V.d[v] = level + 1;
+                            out.push_back(v);
+                        }
+                    }
+                }
+            }
+            sync.arrive_and_wait();
+
+            if (tid == 0) {
+                for (unsigned t = 0; t < threads; ++t) { offset[t + 1] = offset[t] + static_cast<index_t>(local[t].size()); }
+                F[(level + 1) & 1].resize(offset[threads]);
+                cursor.store(0, std::memory_order_relaxed);
+            }
+            sync.arrive_and_wait();
+
+            std::copy(out.begin(), out.end(), F[(level + 1) & 1].begin() + offset[tid]);
+            out.clear();
+            sync.arrive_and_wait();
+        }
+    });
+
+    for (index_t v = 0; v < n; ++v) {
+        index_t p = parent[v].load(std::memory_order_relaxed);
+        if (p == limits::nil) { continue; }
+        V.pi[v] = v == s ? limits::nil : p;
+        V.paint(v, vcolor::black);
+    }
 }
 
 
@@ -19,6 +19,17 @@
 //****************************************
 
 #include "../graph/graph.hpp"
+#include "../graph/csr.hpp"
+#include "../graph/compressed.hpp"
+#include "../graph/bitmatrix.hpp"
+#include "../graph/soa.hpp"
+#include "../graph/workspace.hpp"
+#include "../graph/parallel.hpp"
+#include "../graph/stats.hpp"
+#include <cstddef>
+#include <algorithm>
+#include <cstdint>
+#include <vector>
 
 
 
@@ -30,6 +41,20 @@ GRAPH_BEGIN
 
 
 
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief 方向最適化幅優先探索で、トップダウンとボトムアップを切り替える閾値
+ */
+struct bfs_direction_params {
+    double alpha = 14.0;  /**< フロンティアから出る辺の数m_fが、未訪問の頂点に入る辺の数m_uのalpha分の1を超えるとボトムアップに切り替える */
+    double beta  = 24.0;  /**< フロンティアの頂点数n_fが|V|のbeta分の1を下回るとトップダウンに戻す */
+};
+
+
+
 //****************************************
 // 関数の宣言
 //****************************************
@@ -66,6 +91,163 @@ vertices_t bfs(const graph_t& G, index_t s);
 
 
 
+/**
+ * @brief  CSR表現のグラフGに対して幅優先探索を行います
+ * @note   隣接リストが連続したメモリに格納されているので、辺の走査でポインタを辿らずに済む
+ *         結果はgraph_tに対するbfsと同じである
+ *
+ * @param  const csr_graph& G  グラフG
+ * @param  index_t s  始点s
+ * @return 幅優先木
+ */
+vertices_t bfs(const csr_graph& G, index_t s);
+
+
+
+/**
+ * @brief  幅優先探索を行い、結果を配列の構造体Vに格納する
+ * @note   Vは頂点数|V|に合わせて初期化される. vertices_tが必要ならばV.to_vertices()で変換できる
+ *
+ * @param  const graph_t& G  グラフG
+ * @param  index_t s  始点s
+ * @param  vertices_soa& V  幅優先木
+ */
+void bfs(const graph_t& G, index_t s, vertices_soa& V);
+void bfs(const csr_graph& G, index_t s, vertices_soa& V);
+
+
+
+/**
+ * @brief  作業領域Wを使い回して幅優先探索を行う
+ * @note   Wの頂点属性は触れた頂点だけが初期化されるので、1回の呼び出しの時間はsから到達できる頂点と辺の数だけで決まり、|V|には依存しない
+ *         結果はW.dist(v), W.pred(v)で読む. 発見した頂点は発見した順にW.touched()に並ぶ
+ *
+ * @param  const graph_t& G  グラフG
+ * @param  index_t s  始点s
+ * @param  search_workspace& W  作業領域(キューW.fifoも使い回す)
+ */
+void bfs(const graph_t& G, index_t s, search_workspace& W);
+void bfs(const csr_graph& G, index_t s, search_workspace& W);
+
+
+
+/**
+ * @brief  圧縮表現のグラフGに対して幅優先探索を行う
+ * @note   隣接リストを復号しながら走査する. 各頂点の距離v.dはgraph_tやcsr_graphに対するbfsと一致する
+ *         隣接リストは終点の昇順に並び直されているので、同じ段の頂点のうちどれを親に選ぶかは異なりうる
+ */
+vertices_t bfs(const compressed_graph& G, index_t s);
+void bfs(const compressed_graph& G, index_t s, vertices_soa& V);
+void bfs(const compressed_graph& G, index_t s, search_workspace& W);
+
+
+
+/**
+ * @brief  ビット行列で表した密なグラフAに対して、語ごとに並列な(word-parallel)幅優先探索を行う
+ *
+ * @note   既訪問の頂点の集合seen、フロンティアfrontier、次のフロンティアnextをビット列で表す. フロンティアの各頂点uについて、
+ *           A[u] & ~(seen | next)
+ *         を1語で64頂点ずつ計算し、新しく立ったビットの頂点vを発見する(v.π = u). 隣接行列の行を1要素ずつ調べないので、
+ *         実行時間はΘ(V^2 / 64)であり、隣接行列に対する素朴な幅優先探索のΘ(V^2)よりも定数倍速い
+ *
+ * @note   各頂点の距離v.dは他の表現に対するbfsと一致する. 同じ段の頂点は番号の順に調べるので、親の選び方は異なりうる
+ */
+vertices_t bfs(const bit_matrix& A, index_t s);
+void bfs(const bit_matrix& A, index_t s, vertices_soa& V);
+
+
+
+/**
+ * @brief  方向最適化幅優先探索(direction-optimizing BFS)を行い、結果を配列の構造体Vに格納する
+ *
+ * @note   直径の小さいグラフでは、中間の数段でフロンティアがほとんどの頂点を含むようになり、トップダウンの探索は
+ *         すでに訪問済みの頂点に向かう辺を大量に調べることになる
+ *         ボトムアップの段では、逆に未訪問の各頂点vについて、vに入る辺(u, v)を逆向きの隣接リストGT[v]から調べ、
+ *         uがフロンティアに属していればvを発見してそこで打ち切る. フロンティアはビットマップで表すので、所属判定は1回のビット検査で済む
+ *
+ *         m_fをフロンティアから出る辺の数、m_uを未訪問の頂点に入る辺の数、n_fをフロンティアの頂点数とするとき、
+ *           トップダウンの段で m_f > m_u / alpha ならばボトムアップに切り替え、
+ *           ボトムアップの段で n_f < |V| / beta  ならばトップダウンに戻す
+ *
+ * @note   各頂点の距離v.dはbfsと一致する. 同じ段の頂点のうちどれを親に選ぶかは異なりうるが、Gπは幅優先木である
+ *
+ * @param  const csr_graph& G   グラフG
+ * @param  const csr_graph& GT  Gの転置G^T(無向グラフならばG自身でよい)
+ * @param  index_t s  始点s
+ * @param  vertices_soa& V  幅優先木
+ * @param  const bfs_direction_params& params  切り替えの閾値
+ * @return 調べた辺の数
+ */
+std::size_t bfs_direction_optimizing(const csr_graph& G, const csr_graph& GT, index_t s, vertices_soa& V,
+                                     const bfs_direction_params& params = bfs_direction_params());
+
+
+
+/**< @brief G^Tを計算してから方向最適化幅優先探索を行う */
+std::size_t bfs_direction_optimizing(const csr_graph& G, index_t s, vertices_soa& V,
+                                     const bfs_direction_params& params = bfs_direction_params());
+
+
+
+/**
+ * @brief  CSR表現のグラフGに対して、threads本のスレッドで段同期(level-synchronous)の幅優先探索を行い、結果を配列の構造体Vに格納する
+ *
+ * @note   距離kの頂点からなるフロンティアをスレッドで分担して走査し、距離k+1の頂点を発見する. すべてのスレッドが段を終えるまで待ち合わせる
+ *         各頂点vの親はNILからuへの比較交換(compare-and-swap)で獲得するので、vを発見できるのは1本のスレッドだけである
+ *         発見した頂点はスレッドごとの局所的なバッファに置き、段の終わりにまとめて次のフロンティアにする
+ *
+ * @note   各頂点の距離v.dはbfsと一致する. 親v.πは比較交換に勝ったスレッドによって決まるので実行ごとに異なりうるが、
+ *         いずれもu.d + 1 = v.dを満たす辺(u, v)であり、Gπは幅優先木である
+ *
+ * @param  const csr_graph& G  グラフG
+ * @param  index_t s  始点s
+ * @param  vertices_soa& V  幅優先木
+ * @param  unsigned threads  スレッド数(0ならばハードウェアの並列度)
+ */
+void bfs_parallel(const csr_graph& G, index_t s, vertices_soa& V, unsigned threads = 0);
+
+
+
+/**
+ * @brief  CSR表現のグラフGに対して、始点の列Sのすべてから幅優先探索を行い、各始点からの距離を返す
+ *
+ * @note   始点ごとにbfsを呼ぶとグラフの走査が|S|回繰り返され、その時間の大半は隣接リストの読み込みが占める
+ *         多始点幅優先探索(multi-source BFS, MS-BFS)は、64 * Words個の始点を1つのビット集合にまとめ、各頂点vに
+ *           seen[v] : vを発見済みの始点の集合
+ *           visit[v]: vがいまの段のフロンティアに属する始点の集合
+ *         を持たせる. 1回の段ではvisit[v]が空でない各頂点vについて隣接リストを1度だけ走査し、各辺(v, w)でnext[w] |= visit[v]とする
+ *         next[w] & ~seen[w]が、その段でwを初めて発見した始点の集合である
+ *         したがって隣接リストの読み込みは|S|回ではなく、高々|S| / (64 * Words)回の走査で済む
+ *
+ * @note   ビット集合の語数Wordsを4にすると256個の始点を1度にまとめ、ビット集合の演算はSIMD命令にベクトル化されうる
+ *         |S|が64 * Wordsを超えるときは、その大きさの組に分けて順に探索する
+ *
+ * @note   距離D[i][v]は始点S[i]からvへの距離である(到達できなければlimits::inf). 同じ始点がSに複数回現れてもよい
+ *         幅優先木(π属性)は計算しない. 各段の時間はΘ(V)なので、直径の大きいグラフではbfsを繰り返す方が速いことがある
+ *
+ * @tparam Words ビット集合の語数
+ * @param  const csr_graph& G  グラフG
+ * @param  const indices_t& S  始点の列
+ * @return 距離の表D(|S|行|V|列)
+ */
+template<std::size_t Words = 1>
+matrix_t bfs_multi_source(const csr_graph& G, const indices_t& S);
+
+
+
+/**
+ * @brief  多始点幅優先探索を行い、始点S[i]が頂点vを距離dで発見するたびにvisit(i, v, d)を呼ぶ
+ * @note   距離の表を持たずに、発見を流れとして受け取る(追加のメモリはΘ(V * Words)語). 呼び出しは距離dの昇順である
+ *         同じ組の中では同じ段の発見がまとめて報告されるが、組が変わるとdは0から始まり直す
+ *
+ * @tparam Words   ビット集合の語数
+ * @tparam Visitor void(std::size_t i, index_t v, weight_t d)として呼べる関数オブジェクト
+ */
+template<std::size_t Words = 1, class Visitor>
+void bfs_multi_source(const csr_graph& G, const indices_t& S, Visitor&& visit);
+
+
+
 /**
  * @brief BFSが幅優先木を計算した後でこの手続きを用いれば、sからvへの最短路上の頂点を印刷できる
  */
@@ -73,6 +255,85 @@ void printpath(const vertices_t& V, index_t s, index_t v);
 
 
 
+//****************************************
+// 関数の定義
+//****************************************
+
+/**
+ * @brief  多始点幅優先探索を行い、始点S[i]が頂点vを距離dで発見するたびにvisit(i, v, d)を呼ぶ
+ *
+ * @note   ビット集合は頂点ごとにWords語を連続して置く(seen[v * Words + k]). 1つの組は始点S[first], ..., S[first + 64 * Words - 1]である
+ *         段の終わりにnextをvisitに入れ替えて、nextを空にする
+ */
+template<std::size_t Words, class Visitor>
+void bfs_multi_source(const csr_graph& G, const indices_t& S, Visitor&& visit)
+{
+    using word = std::uint64_t;
+    constexpr std::size_t width = 64 * Words;  // 1つの組の始点の数
+    const std::size_t n = static_cast<std::size_t>(G.size());
+    std::vector<word> seen(n * Words), cur(n * Words), next(n * Words);
+
+    for (std::size_t first = 0; first < S.size(); first += width) {
+        std::size_t k = std::min(width, S.size() - first);
+        std::fill(seen.begin(), seen.end(), 0);
+        std::fill(cur.begin(),  cur.end(),  0);
+        for (std::size_t i = 0; i < k; ++i) {
+            index_t s = S[first + i];
+            word bit = word(1) << (i & 63);
+            seen[s * Words + (i >> 6)] |= bit;
+            cur [s * Words + (i >> 6)] |= bit;
+            visit(first + i, s, weight_t(0));
+        }
+
+        for (weight_t level = 0; ; ++level) {
+            // トップダウン : フロンティアに属する始点の集合を、隣接する頂点に伝える
+            bool active = false;
+            for (std::size_t v = 0; v < n; ++v) {
+                const word* f = &cur[v * Words];
+                word any = 0;
+                for (std::size_t j = 0; j < Words; ++j) { any |= f[j]; }
+                if (any == 0) { continue; }
+                active = true;
+                GRAPH_STAT_ADD(edges_scanned, G.degree(static_cast<index_t>(v)));
+                for (index_t i = G.offset[v]; i < G.offset[v + 1]; ++i) {
+                    word* t = &next[static_cast<std::size_t>(G.dst[i]) * Words];
+                    for (std::size_t j = 0; j < Words; ++j) { t[j] |= f[j]; }
+                }
+            }
+            if (!active) { break; }
+            GRAPH_STAT_ADD(bfs_levels, 1);
+
+            // 初めて発見した始点だけを次のフロンティアに残す
+            for (std::size_t v = 0; v < n; ++v) {
+                word* t = &next[v * Words];
+                word* r = &seen[v * Words];
+                for (std::size_t j = 0; j < Words; ++j) {
+                    word fresh = t[j] & ~r[j];
+                    r[j] |= fresh;
+                    t[j]  = fresh;
+                    for (word b = fresh; b != 0; b &= b - 1) {
+                        visit(first + j * 64 + static_cast<std::size_t>(__builtin_ctzll(b)), static_cast<index_t>(v), level + 1);
+                    }
+                }
+            }
+            cur.swap(next);
+            std::fill(next.begin(), next.end(), 0);
+        }
+    }
+}
+
+
+/**< @brief 多始点幅優先探索を行い、各始点からの距離の表を返す */
+template<std::size_t Words>
+matrix_t bfs_multi_source(const csr_graph& G, const indices_t& S)
+{
+    matrix_t D(S.size(), array_t(G.size(), limits::inf));
+    bfs_multi_source<Words>(G, S, [&](std::size_t i, index_t v, weight_t d) { D[i][v] = d; });
+    return D;
+}
+
+
+
 //****************************************
 // 名前空間の終端
 //****************************************
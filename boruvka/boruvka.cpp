@@ -0,0 +1,152 @@
+/**
+ * @brief  最小全域木問題(minimum-spanning tree problem)における
+ *         Borůvkaのアルゴリズム(Borůvka's algorithm)の実装を行う
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <atomic>
+#include <algorithm>
+#include <cstdint>
+#include "../graph/parallel.hpp"
+#include "../graph/radix_sort.hpp"
+#include "../kruskal/disjoint_sets/concurrent_disjoint_sets.hpp"
+#include "boruvka.hpp"
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+namespace {
+
+    constexpr std::uint64_t none = ~std::uint64_t(0);  // 最小流出辺がまだない
+
+    /**< @brief 辺の重み(上位32ビット)と番号(下位32ビット)を1つの64ビット整数に詰める. 整数の大小が辺の全順序になる */
+    inline std::uint64_t pack(weight_t w, index_t k)
+    {
+        return static_cast<std::uint64_t>(radix_key(w)) << 32 | static_cast<std::uint32_t>(k);
+    }
+    inline index_t unpack_edge(std::uint64_t x) { return static_cast<index_t>(static_cast<std::uint32_t>(x)); }
+
+    /**< @brief 木cの最小流出辺の候補xを比較交換で書き込む */
+    inline void update_min(std::atomic<std::uint64_t>& c, std::uint64_t x)
+    {
+        std::uint64_t old = c.load(std::memory_order_relaxed);
+        while (x < old && !c.compare_exchange_weak(old, x, std::memory_order_relaxed)) { }
+    }
+
+}
+
+
+/**
+ * @brief  Borůvkaのアルゴリズム
+ * @note   各ラウンドは次の手順で行い、手順の区切りでスレッドを待ち合わせる
+ *           1. 各木の根vの最小流出辺best[v]を空にする
+ *           2. 残っている辺を分担して、両端点の木が異なれば両方の木のbestを更新し、同じならばその辺を捨てる
+ *           3. 各根vについて、best[v]の両端点の木を合併する. 合併に成功した辺だけをAに加える
+ *         合併の起こらなかったラウンドで終了する
+ *
+ * @tparam Graph          グラフGの表現(graph_tまたはcsr_graph)
+ */
+template<class Graph>
+static std::pair<edges_t, weight_t> boruvka_impl(const Graph& G, unsigned threads)
+{
+    constexpr std::size_t chunk = 4096;  // 1回に取る辺の数
+    const std::size_t n = static_cast<std::size_t>(G.size());
+    threads = resolve_threads(threads);
+
+    edges_t E;  // グラフGから集合G.Eを取り出す
+    for (index_t u = 0; u < static_cast<index_t>(n); ++u) { for (auto&& e : G[u]) { E.push_back(e); } }
+
+    indices_t alive;  // 両端点が異なる木に属しうる辺の番号
+    alive.reserve(E.size());
+    for (index_t k = 0; k < static_cast<index_t>(E.size()); ++k) { if (E[k].src != E[k].dst) { alive.push_back(k); } }
+
+    concurrent_disjoint_sets ds(n);
+    std::vector<std::atomic<std::uint64_t>> best(n);
+    std::vector<indices_t> kept(threads), added(threads);  // スレッドごとの残す辺と、Aに加えた辺
+    std::atomic<std::size_t> cursor(0), merged(0);
+    bool done = alive.empty();
+    barrier sync(threads);
+
+    parallel_run(threads, [&](unsigned tid) {
+        const std::size_t first = n * tid / threads, last = n * (tid + 1) / threads;
+        while (!done) {
+            for (std::size_t v = first; v < last; ++v) { best[v].store(none, std::memory_order_relaxed); }
+            sync.arrive_and_wait();
+
+            for (std::size_t i; (i = cursor.fetch_add(chunk, std::memory_order_relaxed)) < alive.size(); ) {
+                std::size_t end = std::min(i + chunk, alive.size());
+                for (; i < end; ++i) {
+                    index_t k = alive[i];
+                    index_t cu = ds.find_set(E[k].src), cv = ds.find_set(E[k].dst);
+                    if (cu == cv) { continue; }  // 両端点が同じ木に属する辺を捨てる
+                    kept[tid].push_back(k);
+                    std::uint64_t x = pack(E[k].w, k);
+                    update_min(best[cu], x);
+                    update_min(best[cv], x);
+                }
+            }
+            sync.arrive_and_wait();
+
+            std::size_t count = 0;
+            for (std::size_t v = first; v < last; ++v) {
+                std::uint64_t x = best[v].load(std::memory_order_relaxed);
+                if (x == none) { continue; }
+                index_t k = unpack_edge(x);
+                if (ds.merge(E[k].src, E[k].dst)) { added[tid].push_back(k); ++count; }  // 2つの木を縮約する
+            }
+            merged.fetch_add(count, std::memory_order_relaxed);
+            sync.arrive_and_wait();
+
+            if (tid == 0) {
+                alive.clear();
+                for (auto&& K : kept) { alive.insert(alive.end(), K.begin(), K.end()); K.clear(); }
+                done = merged.exchange(0, std::memory_order_relaxed) == 0 || alive.empty();
+                cursor.store(0, std::memory_order_relaxed);
+            }
+            sync.arrive_and_wait();
+        }
+    });
+
+    weight_t w = 0; edges_t A;
+    for (auto&& K : added) { for (auto&& k : K) { A.push_back(E[k]); w += E[k].w; } }
+    return std::make_pair(A, w);
+}
+
+
+/**< @brief 隣接リスト表現のグラフGに対してBorůvkaのアルゴリズムを実行する */
+std::pair<edges_t, weight_t> boruvka(const graph_t& G, unsigned threads)
+{
+    return boruvka_impl(G, threads);
+}
+
+
+/**< @brief CSR表現のグラフGに対してBorůvkaのアルゴリズムを実行する */
+std::pair<edges_t, weight_t> boruvka(const csr_graph& G, unsigned threads)
+{
+    return boruvka_impl(G, threads);
+}
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
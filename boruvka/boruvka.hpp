@@ -0,0 +1,72 @@
+/**
+ * @brief  最小全域木問題(minimum-spanning tree problem)における
+ *         Borůvkaのアルゴリズム(Borůvka's algorithm)の宣言を行う
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef BORUVKA_HPP
+#define BORUVKA_HPP
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "../graph/graph.hpp"
+#include "../graph/csr.hpp"
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 関数の宣言
+//****************************************
+
+/**
+ * @brief  Borůvkaのアルゴリズムをthreads本のスレッドで実行する
+ *
+ * @note   Borůvkaのアルゴリズムは、各頂点がそれぞれ1つの木である森から始め、各ラウンドで次の2つの操作を行う
+ *           1. 各木について、その木と別の木を連結する最小重みの辺(最小流出辺)を求める
+ *           2. 求めたすべての辺を森に加え、連結された木を1つの木に縮約する
+ *         木Cの最小流出辺はCをほかの木と連結する軽い辺だから、Aに対して安全な辺である. 各ラウンドで木の数は半分以下になるので、
+ *         ラウンドの数は高々lgVであり、全体の実行時間はΟ(ElgV)である
+ *
+ * @note   辺の重みが等しいときは辺の番号の小さい方を軽いとみなして、辺の間に全順序を定める. こうすれば、同じラウンドに加えた辺が閉路を作ることはない
+ *         各ラウンドでは、辺をスレッドで分担して両端点の木の最小流出辺を比較交換で更新し、求めた辺の両端点の木を並行素集合森で合併する
+ *         両端点がすでに同じ木に属する辺は二度と最小流出辺にならないので、そのラウンドで辺の列から取り除く
+ *
+ * @note   無向グラフの各辺は両方向の辺として格納してあってもよい. 非連結なグラフに対しては最小全域森を求める
+ *         同じ重みの辺が複数あるとき、得られる辺集合Aはkruskalやprimと異なりうるが、その重みは等しい
+ *
+ * @param  const graph_t& G       グラフG
+ * @param  unsigned       threads スレッド数(0ならばハードウェアの並列度)
+ * @return 辺集合Aとその重み(最小全域木の重み)
+ */
+std::pair<edges_t, weight_t> boruvka(const graph_t& G, unsigned threads = 0);
+std::pair<edges_t, weight_t> boruvka(const csr_graph& G, unsigned threads = 0);
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
+
+
+
+#endif  // end of BORUVKA_HPP
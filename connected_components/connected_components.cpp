@@ -0,0 +1,98 @@
+/**
+ * @brief  無向グラフの連結成分(connected components)を並列に求める処理の実装
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <atomic>
+#include <algorithm>
+#include "../graph/parallel.hpp"
+#include "../kruskal/disjoint_sets/concurrent_disjoint_sets.hpp"
+#include "connected_components.hpp"
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**
+ * @brief  グラフGの連結成分をthreads本のスレッドで求める
+ * @note   次数の偏りがあってもスレッドの仕事量が揃うように、頂点をchunk個ずつ取って分担する
+ *
+ * @tparam Graph          グラフGの表現(graph_t, csr_graphまたはcompressed_graph)
+ */
+template<class Graph>
+static indices_t connected_components_impl(const Graph& G, unsigned threads)
+{
+    constexpr std::size_t chunk = 1024;  // 1回に取る頂点の数
+    const std::size_t n = static_cast<std::size_t>(G.size());
+    threads = static_cast<unsigned>(std::min<std::size_t>(resolve_threads(threads), std::max<std::size_t>(n / chunk, 1)));
+
+    concurrent_disjoint_sets ds(n);
+    std::atomic<std::size_t> cursor(0);
+    parallel_run(threads, [&](unsigned) {
+        for (std::size_t i; (i = cursor.fetch_add(chunk, std::memory_order_relaxed)) < n; ) {
+            std::size_t last = std::min(i + chunk, n);
+            for (index_t u = static_cast<index_t>(i); u < static_cast<index_t>(last); ++u) {
+                for (auto&& e : G[u]) { if (e.dst != u) { ds.merge(u, e.dst); } }
+            }
+        }
+    });
+
+    // すべての合併が終わった後なので、各頂点の代表元(成分の最小の添字)は確定している
+    indices_t label(n);
+    parallel_for(n, threads, [&](std::size_t v) { label[v] = ds.find_set(static_cast<index_t>(v)); });
+    return label;
+}
+
+
+/**< @brief CSR表現のグラフGの連結成分を求める */
+indices_t connected_components(const csr_graph& G, unsigned threads)
+{
+    return connected_components_impl(G, threads);
+}
+
+
+/**< @brief 隣接リスト表現のグラフGの連結成分を求める */
+indices_t connected_components(const graph_t& G, unsigned threads)
+{
+    return connected_components_impl(G, threads);
+}
+
+
+/**< @brief 圧縮表現のグラフGの連結成分をthreads本のスレッドで求める */
+indices_t connected_components(const compressed_graph& G, unsigned threads)
+{
+    return connected_components_impl(G, threads);
+}
+
+
+/**< @brief 連結成分の番号labelから連結成分の数を数える. 番号は成分の最小の添字なので、label[v] = vである頂点を数えればよい */
+index_t count_components(const indices_t& label)
+{
+    index_t k = 0;
+    for (index_t v = 0; v < static_cast<index_t>(label.size()); ++v) { if (label[v] == v) { ++k; } }
+    return k;
+}
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
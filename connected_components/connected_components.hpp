@@ -0,0 +1,74 @@
+/**
+ * @brief  無向グラフの連結成分(connected components)を並行素集合森を用いて並列に求める
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef CONNECTED_COMPONENTS_HPP
+#define CONNECTED_COMPONENTS_HPP
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "../graph/graph.hpp"
+#include "../graph/csr.hpp"
+#include "../graph/compressed.hpp"
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 関数の宣言
+//****************************************
+
+/**
+ * @brief  グラフGの連結成分をthreads本のスレッドで求める
+ *
+ * @note   各頂点を唯一の要素とする集合から始め、各辺(u, v)についてuを含む集合とvを含む集合を合併する
+ *         すべての辺を調べ終えたとき、各集合がひとつの連結成分の頂点集合である. 辺は互いに独立に調べられるので、頂点を区間に分けてスレッドで分担する
+ *         集合は並行素集合森(concurrent_disjoint_sets)で表すので、合併はロックを用いずに比較交換で行う
+ *
+ * @note   有向グラフGを与えた場合は、辺の向きを無視した連結成分(弱連結成分)を求める. 無向グラフの各辺は両方向の辺として格納してあればよく、片方向だけでもよい
+ *         全体の仕事量はΟ((V + E)α(V))であり、スレッドの間の同期は最後の待ち合わせだけである
+ *
+ * @param  const csr_graph& G グラフG
+ * @param  unsigned threads  スレッド数(0ならばハードウェアの並列度)
+ * @return 各頂点vの連結成分の番号. 成分に属する頂点の最小の添字を番号とするので、スレッド数によらず同じ結果になる
+ */
+indices_t connected_components(const csr_graph& G, unsigned threads = 0);
+indices_t connected_components(const graph_t& G, unsigned threads = 0);
+indices_t connected_components(const compressed_graph& G, unsigned threads = 0);
+
+
+
+/**
+ * @brief  連結成分の番号labelから連結成分の数を数える
+ */
+index_t count_components(const indices_t& label);
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
+
+
+
+#endif  // end of CONNECTED_COMPONENTS_HPP
@@ -0,0 +1,299 @@
+/**
+ * @brief  2頂点間の最短路問題における縮約階層(contraction hierarchies)の実装を行う
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <queue>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include "../graph/relax.hpp"
+#include "../graph/workspace.hpp"
+#include "contraction_hierarchies.hpp"
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+namespace {
+
+    /**
+     * @brief 縮約の途中のグラフの辺. 隣接頂点v、重みw、中間頂点mid(元の辺ならばNIL)
+     */
+    struct arc {
+        index_t  v;
+        weight_t w;
+        index_t  mid;
+    };
+
+
+    /**
+     * @brief  まだ縮約していない頂点だけからなる、縮約の途中のグラフ
+     * @note   各頂点の出る辺out[u]と入る辺in[u]を持つ. 同じ頂点対の辺は最小の重みのものを1本だけ持つ
+     */
+    struct overlay {
+        std::vector<std::vector<arc>> out, in;
+
+        explicit overlay(const csr_graph& G) : out(G.size()), in(G.size())
+        {
+            for (index_t u = 0; u < G.size(); ++u) {
+                for (auto&& e : G[u]) { if (e.dst != u) { add(u, e.dst, e.w, limits::nil); } }
+            }
+        }
+
+        /**< @brief 辺(u, x)を重みwで加える. すでにあれば、重みがwより大きいときだけ置き換える */
+        void add(index_t u, index_t x, weight_t w, index_t mid)
+        {
+            for (auto&& a : out[u]) {
+                if (a.v != x) { continue; }
+                if (w < a.w) {
+                    a.w = w; a.mid = mid;
+                    for (auto&& b : in[x]) { if (b.v == u) { b.w = w; b.mid = mid; break; } }
+                }
+                return;
+            }
+            out[u].push_back({ x, w, mid });
+            in[x].push_back({ u, w, mid });
+        }
+
+        /**< @brief 辺の列Aから頂点vへの辺を取り除く */
+        static void erase(std::vector<arc>& A, index_t v)
+        {
+            for (std::size_t i = 0; i < A.size(); ++i) {
+                if (A[i].v == v) { A[i] = A.back(); A.pop_back(); return; }
+            }
+        }
+    };
+
+
+    /**
+     * @brief 頂点を1つずつ縮約し、縮約階層の辺を集める
+     */
+    struct contractor {
+        overlay          H;         /**< 縮約の途中のグラフ */
+        indices_t        deleted;   /**< すでに縮約した隣接頂点の数 */
+        search_workspace W;         /**< 証人探索の作業領域 */
+        epoch_marks      target;    /**< 証人探索で距離を確かめる頂点(vから出る辺の終点) */
+        index_t          limit;     /**< 1回の証人探索で取り出す頂点の数の上限 */
+        edges_t          shortcut;  /**< 頂点vを縮約するときに加える近道(u, x) */
+
+        contractor(const csr_graph& G, index_t limit) : H(G), deleted(G.size(), 0), W(G.size()), target(G.size()), limit(limit) {}
+
+        /**
+         * @brief  uから頂点vを通らずに、重みmaxw以下の道を局所的なDijkstraのアルゴリズムで探す
+         * @note   targets個の目標頂点をすべて取り出すか、取り出した頂点の数が上限に達したら打ち切る
+         *         打ち切った時点のW.dist(x)も、vを通らない道の重みだから証人として使える
+         */
+        void witness(index_t u, index_t v, weight_t maxw, index_t targets)
+        {
+            W.resize(H.out.size());
+            W.touch(u); W.d[u] = 0;
+            W.Q.push(u, 0);
+            for (index_t settled = 0; targets > 0 && !W.Q.empty() && W.Q.top().d <= maxw && settled < limit; ++settled) {
+                index_t p = W.Q.top().u; W.Q.pop();
+                if (target[p]) { --targets; }
+                for (auto&& a : H.out[p]) {
+                    if (a.v == v) { continue; }
+                    weight_t d = W.d[p] + a.w;
+                    if (d < W.dist(a.v)) {
+                        W.touch(a.v);
+                        W.d[a.v] = d; W.pi[a.v] = p;
+                        W.Q.push(a.v, d);
+                    }
+                }
+            }
+        }
+
+        /**< @brief 頂点vを縮約するときに必要な近道をshortcutに求め、その数を返す */
+        index_t shortcuts(index_t v)
+        {
+            shortcut.clear();
+            weight_t maxout = 0;
+            target.clear();
+            for (auto&& b : H.out[v]) { maxout = std::max(maxout, b.w); target.insert(b.v); }
+            const index_t targets = static_cast<index_t>(H.out[v].size());
+            for (auto&& a : H.in[v]) {
+                witness(a.v, v, a.w + maxout, targets);
+                for (auto&& b : H.out[v]) {
+                    if (b.v == a.v) { continue; }
+                    weight_t need = a.w + b.w;
+                    if (W.dist(b.v) > need) { shortcut.emplace_back(a.v, b.v, need); }
+                }
+            }
+            return static_cast<index_t>(shortcut.size());
+        }
+
+        /**< @brief 頂点vの優先度(辺差分 + 縮約した隣接頂点の数). 小さいものから縮約する */
+        index_t priority(index_t v)
+        {
+            index_t incident = static_cast<index_t>(H.out[v].size() + H.in[v].size());
+            return shortcuts(v) - incident + deleted[v];
+        }
+
+        /**
+         * @brief  頂点vを縮約する
+         * @note   vの辺はすべてまだ縮約していない頂点と結ばれているので、そのままupG[v]とdownG[v]に移す
+         *         その後、vとその辺を取り除き、必要な近道を加える. 近道は直前のpriority(v)がshortcutに求めたものを用いる
+         */
+        void contract(index_t v, graph_t& upG, std::vector<indices_t>& upM, graph_t& downG, std::vector<indices_t>& downM)
+        {
+            for (auto&& a : H.out[v]) { upG[v].emplace_back(v, a.v, a.w);   upM[v].push_back(a.mid); }
+            for (auto&& a : H.in[v])  { downG[v].emplace_back(v, a.v, a.w); downM[v].push_back(a.mid); }
+            for (auto&& a : H.out[v]) { overlay::erase(H.in[a.v], v);  ++deleted[a.v]; }
+            for (auto&& a : H.in[v])  { overlay::erase(H.out[a.v], v); ++deleted[a.v]; }
+            std::vector<arc>().swap(H.out[v]);
+            std::vector<arc>().swap(H.in[v]);
+            for (auto&& e : shortcut) { H.add(e.src, e.dst, e.w, v); }
+        }
+    };
+
+
+    /**< @brief 隣接リストGをCSR表現に変換し、各辺の中間頂点Mを同じ順に並べる */
+    void flatten(const graph_t& G, const std::vector<indices_t>& M, csr_graph& C, indices_t& mid)
+    {
+        C = csr_graph(G);
+        mid.clear();
+        mid.reserve(C.edge_count());
+        for (auto&& m : M) { mid.insert(mid.end(), m.begin(), m.end()); }
+    }
+
+}
+
+
+/**
+ * @brief  縮約階層を求める
+ * @note   優先度のmin優先度付きキューから頂点vを取り出すたびにvの優先度を計算し直し、キューの次の頂点の優先度より大きければ
+ *         キューに戻す(遅延更新). そうでなければvを縮約する. 各頂点は常に高々1つしかキューに置かれない
+ */
+contraction_hierarchy::contraction_hierarchy(const csr_graph& G, const ch_params& params)
+{
+    const index_t n = G.size();
+    contractor C(G, params.settle_limit);
+    graph_t upG(n), downG(n);
+    std::vector<indices_t> upM(n), downM(n);
+
+    using entry = std::pair<index_t, index_t>;  // (優先度, 頂点)
+    std::priority_queue<entry, std::vector<entry>, std::greater<entry>> Q;
+    for (index_t v = 0; v < n; ++v) { Q.emplace(C.priority(v), v); }
+
+    rank.assign(n, limits::nil);
+    for (index_t next = 0; !Q.empty(); ) {
+        index_t v = Q.top().second; Q.pop();
+        index_t p = C.priority(v);
+        if (!Q.empty() && p > Q.top().first) { Q.emplace(p, v); continue; }  // 優先度が上がっていれば後回しにする
+        rank[v] = next++;
+        C.contract(v, upG, upM, downG, downM);
+    }
+
+    flatten(upG, upM, up, up_mid);
+    flatten(downG, downM, down, down_mid);
+}
+
+
+contraction_hierarchy::contraction_hierarchy(const graph_t& G, const ch_params& params)
+    : contraction_hierarchy(csr_graph(G), params)
+{
+}
+
+
+/**
+ * @brief  縮約階層を用いて、始点sから終点tへの最短路重みδ(s, t)を求める
+ * @note   両方向の探索のうち、止めていない方で最小キーの小さい方を進める. 取り出した頂点uに反対側の探索が触れていれば、μを更新する
+ *         上りの後に下りの最短路の最高点は両方の探索で取り出されるので、両方の探索が止まった時点でμ = δ(s, t)である
+ */
+weight_t contraction_hierarchy::query(index_t s, index_t t, bidirectional_workspace& W) const
+{
+    const index_t n = size();
+    search_workspace* X[2] = { &W.forward, &W.backward };
+    const csr_graph*  H[2] = { &up, &down };
+    W.meet = limits::nil;
+    for (int k = 0; k < 2; ++k) { X[k]->resize(n); }
+    initialize_single_source_with_color(W.forward,  s); W.forward.Q.push(s, 0);
+    initialize_single_source_with_color(W.backward, t); W.backward.Q.push(t, 0);
+    if (s == t) { W.meet = s; return 0; }
+
+    weight_t mu = limits::inf;
+    bool done[2] = { false, false };
+    while (true) {
+        for (int k = 0; k < 2; ++k) {
+            if (!done[k] && (X[k]->Q.empty() || X[k]->Q.top().d >= mu)) { done[k] = true; }  // この方向の探索を止める
+        }
+        if (done[0] && done[1]) { break; }
+        int k = done[0] ? 1 : done[1] ? 0 : (W.forward.Q.top().d <= W.backward.Q.top().d ? 0 : 1);
+        search_workspace& A = *X[k];
+        const search_workspace& O = *X[1 - k];
+
+        index_t u = A.Q.top().u; A.Q.pop();
+        if (O.color(u) != vcolor::white && A.d[u] + O.d[u] < mu) {  // 反対側の探索が触れた頂点を取り出した
+            mu = A.d[u] + O.d[u];
+            W.meet = u;
+        }
+        for (auto&& e : (*H[k])[u]) { relax_with_heap(A, e, A.Q); }
+        A.paint(u, vcolor::black);
+    }
+    return mu;
+}
+
+
+/**
+ * @brief  階層の辺(u, x)の中間頂点を返す
+ */
+index_t contraction_hierarchy::middle(index_t u, index_t x) const
+{
+    if (rank[u] < rank[x]) {
+        for (index_t i = up.offset[u]; i < up.offset[u + 1]; ++i) { if (up.dst[i] == x) { return up_mid[i]; } }
+    }
+    else {
+        for (index_t i = down.offset[x]; i < down.offset[x + 1]; ++i) { if (down.dst[i] == u) { return down_mid[i]; } }
+    }
+    return limits::nil;
+}
+
+
+/**
+ * @brief  直前の問い合わせで求めた最短路を、元のグラフの頂点の列に展開する
+ * @note   近道の入れ子は深くなりうるので、再帰の代わりに展開を待つ辺のスタックを用いる
+ */
+indices_t contraction_hierarchy::path(const bidirectional_workspace& W) const
+{
+    indices_t P = W.path();
+    if (P.empty()) { return P; }
+
+    indices_t p(1, P[0]);
+    std::vector<std::pair<index_t, index_t>> stack;
+    for (std::size_t i = 0; i + 1 < P.size(); ++i) {
+        stack.emplace_back(P[i], P[i + 1]);
+        while (!stack.empty()) {
+            index_t u = stack.back().first, x = stack.back().second; stack.pop_back();
+            index_t v = middle(u, x);
+            if (v == limits::nil) { p.push_back(x); continue; }  // 元の辺(u, x)
+            stack.emplace_back(v, x);                            // 近道(u, x)を(u, v)と(v, x)に置き換える
+            stack.emplace_back(u, v);
+        }
+    }
+    return p;
+}
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
@@ -0,0 +1,114 @@
+/**
+ * @brief  2頂点間の最短路問題における縮約階層(contraction hierarchies)の宣言を行う
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef CONTRACTION_HIERARCHIES_HPP
+#define CONTRACTION_HIERARCHIES_HPP
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "../graph/graph.hpp"
+#include "../graph/csr.hpp"
+#include "../dijkstra/dijkstra.hpp"
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief 縮約階層の前処理の設定
+ */
+struct ch_params {
+    index_t settle_limit = 500;  /**< 1回の証人探索で取り出す頂点の数の上限. 上限に達すると証人がなくても近道を加える */
+};
+
+
+/**
+ * @brief  縮約階層(contraction hierarchies)
+ *
+ * @note   前処理では頂点を重要でないものから順に1つずつ縮約(contract)する. 頂点vを縮約するときは、vに入る辺(u, v)と出る辺(v, x)の
+ *         各組について、vを通らないuからxへのw(u, v) + w(v, x)以下の道(証人, witness)を局所的なDijkstraのアルゴリズムで探し、
+ *         見つからなければ近道(shortcut)(u, x)を重みw(u, v) + w(v, x)で加える. 近道は中間頂点vを覚えておく
+ *         縮約した順番をrank[v]とすると、Gのどの最短路にも、rankが増えてから減る(上りの後に下りの)道で同じ重みのものが存在する
+ *
+ * @note   縮約する順番は辺差分(edge difference) = (加える近道の数) - (vに接続する辺の数)に、すでに縮約した隣接頂点の数を加えた値で決める
+ *         この値は縮約が進むと変わるので、キューから取り出すたびに計算し直し、次の頂点の値より大きくなっていればキューに戻す(遅延更新, lazy update)
+ *
+ * @note   縮約した頂点vの辺は、その時点でまだ縮約していない(rankの大きい)頂点とだけ結ばれている
+ *           up[v]   : vから出る辺(v, x)  (rank[x] > rank[v])
+ *           down[v] : vに入る辺(u, v)を逆向きにしたもの(v, u)  (rank[u] > rank[v])
+ *         をCSR表現で持ち、up_mid, down_midに各辺の中間頂点(元の辺ならばNIL)を持つ
+ *         問い合わせでは、sからupだけを、tからdownだけを辿る双方向のDijkstraのアルゴリズムを行う. どちらの探索も上りの辺しか辿らないので、
+ *         調べる頂点の数はdijkstraよりはるかに少ない
+ */
+struct contraction_hierarchy {
+    indices_t rank;      /**< 頂点vを縮約した順番 */
+    csr_graph up;        /**< rankの大きい頂点へ向かう辺 */
+    csr_graph down;      /**< rankの大きい頂点から入る辺を逆向きにしたもの */
+    indices_t up_mid;    /**< upの各辺の中間頂点(元の辺ならばNIL) */
+    indices_t down_mid;  /**< downの各辺の中間頂点(元の辺ならばNIL) */
+
+    contraction_hierarchy() = default;
+
+    /**< @brief 非負の重み付き有向グラフGの縮約階層を求める */
+    explicit contraction_hierarchy(const csr_graph& G, const ch_params& params = ch_params());
+    explicit contraction_hierarchy(const graph_t& G, const ch_params& params = ch_params());
+
+    /**< @brief 頂点数|V|を返す */
+    index_t size() const { return static_cast<index_t>(rank.size()); }
+
+    /**< @brief 近道を含む辺の数を返す */
+    index_t edge_count() const { return up.edge_count() + down.edge_count(); }
+
+    /**
+     * @brief  始点sから終点tへの最短路重みδ(s, t)を求める
+     * @note   sからupを、tからdownを辿る探索を交互に進め、両方が触れた頂点vについてF.d[v] + B.d[v]の最小値μを求める
+     *         各方向の探索は、キューの最小キーがμ以上になったところで止める. tに到達できなければlimits::infを返す
+     *         W.forward, W.backwardのπ値は階層の辺に沿った先行点であり、元のグラフの道はpath(W)で得られる
+     */
+    weight_t query(index_t s, index_t t, bidirectional_workspace& W) const;
+
+    /**
+     * @brief  直前のquery(s, t, W)で求めたsからtへの最短路上の頂点を、元のグラフの頂点の列としてsから順に返す(道がなければ空)
+     * @note   階層の道をW.path()で求め、各近道(u, x)を中間頂点vによって(u, v)と(v, x)に置き換えることを、元の辺だけになるまで繰り返す
+     *         printpathのようにπ値を辿る代わりにこれを用いる
+     */
+    indices_t path(const bidirectional_workspace& W) const;
+
+private:
+    /**< @brief 階層の辺(u, x)の中間頂点を返す. rank[u] < rank[x]ならばup[u]を、そうでなければdown[x]を探す */
+    index_t middle(index_t u, index_t x) const;
+};
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
+
+
+
+#endif  // end of CONTRACTION_HIERARCHIES_HPP
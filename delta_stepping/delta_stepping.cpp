@@ -0,0 +1,178 @@
+/**
+ * @brief  単一始点最短路問題におけるΔ-ステッピング法(delta-stepping)の実装
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <atomic>
+#include <algorithm>
+#include <cstdint>
+#include "../graph/parallel.hpp"
+#include "../graph/atomic_relax.hpp"
+#include "delta_stepping.hpp"
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**
+ * @brief  Δ-ステッピング法により単一始点最短路問題をthreads本のスレッドで解く
+ *
+ * @note   ある時点でバケットに置かれている頂点の最短路推定値は、処理中のバケットiの下端からC + Δの範囲にあるので、
+ *         K = floor(C / Δ) + 2個のバケットを循環させれば十分である. 頂点のd値が減ると古い位置の要素は残ったままになるが、
+ *         取り出したときにfloor(v.d / Δ) != iであれば捨てる(遅延削除)
+ *
+ * @note   各スレッドtidは自分のバケットlocal[tid][0..K)に挿入する. バケットiの取り出しと次の段の準備はスレッド0が行い、
+ *         各段の緩和はフロンティアをchunk個ずつ取ってすべてのスレッドで分担する. 段の区切りでは待ち合わせる
+ */
+void delta_stepping(const csr_graph& G, index_t s, vertices_soa& S, weight_t delta, unsigned threads)
+{
+    constexpr std::size_t chunk = 64;  // 1回に取るフロンティアの頂点の数
+    index_t n = G.size(), m = G.edge_count();
+    threads = resolve_threads(threads);
+
+    weight_t C = 0;
+    for (index_t i = 0; i < m; ++i) { C = std::max(C, G.w[i]); }
+    if (delta <= 0) { delta = std::max<weight_t>(1, static_cast<weight_t>(static_cast<std::int64_t>(C) * n / std::max<index_t>(m, 1))); }
+    const std::size_t K = static_cast<std::size_t>(C / delta) + 2;
+
+    std::vector<std::atomic<std::uint64_t>> D(n);
+    for (auto&& x : D) { x.store(pack_relax(limits::inf, limits::nil), std::memory_order_relaxed); }
+    D[s].store(pack_relax(0, limits::nil), std::memory_order_relaxed);
+
+    std::vector<std::vector<indices_t>> local(threads, std::vector<indices_t>(K));
+    local[0][0].push_back(s);
+
+    enum struct phase { select, light, heavy } ph = phase::select;
+    std::size_t b = 0, pending = 1, iter = 0;   // 処理中のバケット, バケットに置かれている要素の数, 取り出しの回数
+    std::vector<std::size_t> taken(n, 0), settled(n, 0);
+    indices_t frontier, R;                      // 緩和する頂点, バケットbから取り出したすべての頂点
+    bool done = false;
+    std::atomic<std::size_t> cursor(0), inserted(0);
+    barrier sync(threads);
+
+    auto bucket_of = [&](index_t v) { return static_cast<std::size_t>(unpack_d(D[v].load(std::memory_order_relaxed)) / delta); };
+    auto empty_slot = [&](std::size_t i) {
+        for (auto&& B : local) { if (!B[i % K].empty()) { return false; } }
+        return true;
+    };
+
+    // バケットbの要素を取り出し、古い要素と重複を捨ててフロンティアにする
+    auto gather = [&] {
+        ++iter;
+        for (auto&& B : local) {
+            for (auto&& v : B[b % K]) {
+                if (bucket_of(v) != b || taken[v] == iter) { continue; }
+                taken[v] = iter;
+                frontier.push_back(v);
+                if (settled[v] != b + 1) { settled[v] = b + 1; R.push_back(v); }
+            }
+            pending -= B[b % K].size();
+            B[b % K].clear();
+        }
+    };
+
+    // 次の段で緩和するフロンティアを決める(スレッド0だけが実行する)
+    auto prepare = [&] {
+        pending += inserted.exchange(0, std::memory_order_relaxed);
+        cursor.store(0, std::memory_order_relaxed);
+        frontier.clear();
+        if (ph == phase::heavy) { ++b; ph = phase::select; }
+        while (true) {
+            if (ph == phase::select) {
+                if (pending == 0) { done = true; return; }
+                while (empty_slot(b)) { ++b; }
+                R.clear();
+                ph = phase::light;
+            }
+            gather();
+            if (!frontier.empty()) { return; }      // 軽い辺を緩和する
+            frontier.swap(R); ph = phase::heavy;    // バケットbが空になったので、取り出したすべての頂点から出る重い辺を緩和する
+            if (!frontier.empty()) { return; }
+            ++b; ph = phase::select;
+        }
+    };
+
+    parallel_run(threads, [&](unsigned tid) {
+        while (true) {
+            if (tid == 0) { prepare(); }
+            sync.arrive_and_wait();
+            if (done) { break; }
+
+            bool light = ph == phase::light;
+            std::size_t count = 0;
+            for (std::size_t i; (i = cursor.fetch_add(chunk, std::memory_order_relaxed)) < frontier.size(); ) {
+                std::size_t last = std::min(i + chunk, frontier.size());
+                for (; i < last; ++i) {
+                    index_t  u  = frontier[i];
+                    weight_t du = unpack_d(D[u].load(std::memory_order_relaxed));
+                    for (auto&& e : G[u]) {
+                        if ((e.w <= delta) != light) { continue; }
+                        weight_t d = du + e.w;
+                        if (relax_atomic(D[e.dst], d, u)) {
+                            local[tid][static_cast<std::size_t>(d / delta) % K].push_back(e.dst);
+                            ++count;
+                        }
+                    }
+                }
+            }
+            inserted.fetch_add(count, std::memory_order_relaxed);
+            sync.arrive_and_wait();
+        }
+    });
+
+    S.resize(n);
+    for (index_t v = 0; v < n; ++v) {
+        std::uint64_t x = D[v].load(std::memory_order_relaxed);
+        S.d[v]  = unpack_d(x);
+        S.pi[v] = unpack_pi(x);
+        if (S.d[v] != limits::inf) { S.paint(v, vcolor::black); }
+    }
+}
+
+
+/**< @brief 隣接リスト表現のグラフGをCSR表現に変換してからΔ-ステッピング法を実行する */
+void delta_stepping(const graph_t& G, index_t s, vertices_soa& S, weight_t delta, unsigned threads)
+{
+    delta_stepping(csr_graph(G), s, S, delta, threads);
+}
+
+
+/**< @brief Δ-ステッピング法により単一始点最短路問題を解き、結果をvertices_tで返す */
+vertices_t delta_stepping(const csr_graph& G, index_t s, weight_t delta, unsigned threads)
+{
+    vertices_soa S;
+    delta_stepping(G, s, S, delta, threads);
+    return S.to_vertices();
+}
+
+
+vertices_t delta_stepping(const graph_t& G, index_t s, weight_t delta, unsigned threads)
+{
+    vertices_soa S;
+    delta_stepping(G, s, S, delta, threads);
+    return S.to_vertices();
+}
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
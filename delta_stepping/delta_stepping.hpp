@@ -0,0 +1,79 @@
+/**
+ * @brief  単一始点最短路問題におけるΔ-ステッピング法(delta-stepping)を扱う
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef DELTA_STEPPING_HPP
+#define DELTA_STEPPING_HPP
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "../graph/graph.hpp"
+#include "../graph/csr.hpp"
+#include "../graph/soa.hpp"
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 関数の宣言
+//****************************************
+
+/**
+ * @brief  すべての辺重みが非負であるという仮定の下で、Δ-ステッピング法により単一始点最短路問題をthreads本のスレッドで解く
+ *
+ * @note   Δ-ステッピング法は、最短路推定値dの頂点を幅Δのバケットfloor(d / Δ)に置き、添字の小さいバケットから順に処理する
+ *         重みがΔ以下の辺を軽い辺(light edge)、Δより大きい辺を重い辺(heavy edge)と呼ぶ
+ *         バケットiの処理では、バケットiが空になるまで、取り出した頂点から出る軽い辺を緩和することを繰り返す
+ *         軽い辺の緩和で改善された頂点は再びバケットiに入りうる. バケットiが空になると、その間に取り出したすべての頂点から出る重い辺を1度だけ緩和する
+ *         重い辺の緩和でバケットiに戻る頂点はないので、バケットiの頂点の最短路重みはこの時点で確定する
+ *
+ *         同じバケットに属する頂点の緩和は互いに独立に行えるので、各段をスレッドで分担する
+ *         Δ = 1(かつ重みが正)ならばDijkstraのアルゴリズムに、Δ = ∞ならばBellman-Fordアルゴリズムに近い振る舞いになる
+ *
+ * @note   各頂点のd値とπ値は1つの64ビット整数に詰め、d値が減る場合にだけ比較交換で書き換える. したがって、d値とπ値は常に対応している
+ *         d値はdijkstraと一致する. 同じ重みの最短路が複数あるとき、π値はdijkstraと異なりうるが、Gπは最短路木である
+ *
+ * @param  const csr_graph& G    非負の重み付き有向グラフG
+ * @param  index_t        s      始点s
+ * @param  vertices_soa&  S      始点sからの最短路木
+ * @param  weight_t       delta  バケットの幅Δ(0ならば最大の辺重みCと平均次数から決める)
+ * @param  unsigned       threads  スレッド数(0ならばハードウェアの並列度)
+ */
+void delta_stepping(const csr_graph& G, index_t s, vertices_soa& S, weight_t delta = 0, unsigned threads = 0);
+void delta_stepping(const graph_t& G, index_t s, vertices_soa& S, weight_t delta = 0, unsigned threads = 0);
+
+
+
+/**< @brief Δ-ステッピング法により単一始点最短路問題を解き、結果をdijkstraと同じvertices_tで返す */
+vertices_t delta_stepping(const csr_graph& G, index_t s, weight_t delta = 0, unsigned threads = 0);
+vertices_t delta_stepping(const graph_t& G, index_t s, weight_t delta = 0, unsigned threads = 0);
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
+
+
+
+#endif  // end of DELTA_STEPPING_HPP
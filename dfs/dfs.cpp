@@ -11,7 +11,6 @@
 
 
 #include <iterator>
-#include <functional>
 #include <utility>
 #include <algorithm>
 #include <vector>
@@ -34,6 +33,81 @@ GRAPH_BEGIN
 // 関数の定義
 //****************************************
 
+namespace {
+
+/**
+ * @brief 再帰的に白頂点uを訪問する方策
+ * @note  std::functionを介さずに自身を直接呼び出すので、再帰呼び出しは間接呼び出しにならない
+ */
+template<class Graph>
+struct recursive_visit {
+    const Graph& G; vertices_t& vs; array_t& f; weight_t& time;
+
+    void operator () (index_t u)  // 白頂点を発見した...
+    {
+        time = time + 1;             // timeを1進め、
+        vs[u].d = time;              // timeの値を発見時刻u.dとして記録し、
+        vs[u].color = vcolor::gray;  // uを灰に彩色する
+        // 各頂点v ∈ Adj[u]を吟味するので、深さ優先探索は辺(u, v)を探索する(explore)という
+        for (auto&& e : G[u]) {                  // uと隣接する各頂点vを調べ、
+            index_t v = e.dst;
+            if (vs[v].color == vcolor::white) {  // vが白なら再帰的にvを訪問する
+                vs[v].pi = u;
+                (*this)(v);
+            }
+        }
+        // uから出るすべての辺の探索が終了すると、
+        vs[u].color = vcolor::black;  // uを黒に彩色し、
+        time = time + 1;              // timeを進め、
+        f[u] = time;                  // 終了時刻をu.fに記録する
+    }
+};
+
+
+/**
+ * @brief スタックを用いて白頂点uを訪問する方策
+ */
+template<class Graph>
+struct iterative_visit {
+    const Graph& G; vertices_t& vs; array_t& f; weight_t& time;
+
+    void operator () (index_t u)
+    {
+        // NOTE : スタックには頂点と、その隣接リストのまだ調べていない位置の組を積む. 一度白でなくなった頂点は白に戻らないので、
+        //        前回の位置から走査を再開しても、先頭から調べ直すのと同じ頂点が見つかる
+        //        隣接リストを添字で読み直さないので、前から順にしか読めない表現(compressed_graph)でも隣接リストの長さに比例する時間で済む
+        using position = decltype(G[u].begin());
+        std::stack<std::pair<index_t, position>> S; S.emplace(u, G[u].begin());
+        time = time + 1;             // timeを1進め、
+        vs[u].d = time;              // timeの値を発見時刻u.dとして記録し、
+        vs[u].color = vcolor::gray;  // uを灰に彩色する
+        // 各頂点v ∈ Adj[u]を吟味するので、深さ優先探索は辺(u, v)を探索する(explore)という
+        while (!S.empty()) {
+            u = S.top().first;       // スタックの先頭の要素を取得
+            position& i = S.top().second;       // 隣接リストの走査
+            const position last = G[u].end();
+            while (i != last && vs[(*i).dst].color != vcolor::white) { ++i; }
+            if (i != last) {  // uの隣接リストの中でまだ調べていない頂点が存在する場合、
+                index_t v = (*i).dst;
+                S.emplace(v, G[v].begin());   // vをスタックにプッシュし、
+                time = time + 1;              // timeを1進め、 
+                vs[v].d = time;               // timeの値を発見時刻u.dとして記録し、
+                vs[v].color = vcolor::gray ;  // vを灰に彩色する
+            }
+            else { // uの隣接リストを全て調べている場合、
+                S.pop();                      // スタックから先頭の要素をポップし、
+                time = time + 1;              // timeを進め、
+                f[u] = time;                  // 終了時刻をu.fに記録する
+                vs[u].color = vcolor::black;  // uを黒に彩色する
+            }
+        }
+    }
+};
+
+}  // 無名名前空間の終端
+
+
+
 /**
  * @brief  深さ優先探索を行います
  * 
@@ -92,63 +166,19 @@ GRAPH_BEGIN
  *         3. BLACKは前進辺あるいは横断辺であることを示す
  *
  *
+ * @tparam Visit 白頂点を訪問する方策(recursive_visitまたはiterative_visit)
+ * @tparam Graph グラフGの表現(graph_t, csr_graphまたはcompressed_graph)
  * @param  グラフG(無向でも有向でもよい)
  * @return 深さ優先森
  */
-std::pair<vertices_t, array_t> dfs(const graph_t& G)
+template<template<class> class Visit, class Graph>
+static std::pair<vertices_t, array_t> dfs_impl(const Graph& G)
 {
     index_t n = G.size();
     vertices_t vs(n);
     array_t  f(n);
     weight_t time;
-
-    // 再帰的に白頂点uを訪問する
-    std::function <void(index_t)> recursive_visit = [&] (index_t u) {  // 白頂点を発見した...
-        time = time + 1;             // timeを1進め、
-        vs[u].d = time;              // timeの値を発見時刻u.dとして記録し、
-        vs[u].color = vcolor::gray;  // uを灰に彩色する
-        // 各頂点v ∈ Adj[u]を吟味するので、深さ優先探索は辺(u, v)を探索する(explore)という
-        for (auto&& e : G[u]) {                  // uと隣接する各頂点vを調べ、
-            index_t v = e.dst;
-            if (vs[v].color == vcolor::white) {  // vが白なら再帰的にvを訪問する
-                vs[v].pi = u;
-                recursive_visit(v);
-            }
-        }
-        // uから出るすべての辺の探索が終了すると、
-        vs[u].color = vcolor::black;  // uを黒に彩色し、
-        time = time + 1;              // timeを進め、
-        f[u] = time;                  // 終了時刻をu.fに記録する
-    };
-
-
-    // スタックを用いて白頂点uを訪問する
-    auto iterative_visit = [&](index_t u) -> void {
-        std::stack<index_t> S; S.push(u);
-        time = time + 1;             // timeを1進め、
-        vs[u].d = time;              // timeの値を発見時刻u.dとして記録し、
-        vs[u].color = vcolor::gray;  // uを灰に彩色する
-        // 各頂点v ∈ Adj[u]を吟味するので、深さ優先探索は辺(u, v)を探索する(explore)という
-        while (!S.empty()) {
-            u = S.top();             // スタックの先頭の要素を取得
-            std::size_t i = 0, m = G[u].size();  // 隣接リストの走査
-            while (i < m && vs[G[u][i].dst].color != vcolor::white) { i++; }
-            if (i != m) {  // uの隣接リストの中でまだ調べていない頂点が存在する場合、
-                index_t v = G[u][i].dst;
-                S.push(v);                    // vをスタックにプッシュし、
-                time = time + 1;              // timeを1進め、 
-                vs[v].d = time;               // timeの値を発見時刻u.dとして記録し、
-                vs[v].color = vcolor::gray ;  // vを灰に彩色する
-            }
-            else { // uの隣接リストを全て調べている場合、
-                S.pop();                      // スタックから先頭の要素をポップし、
-                time = time + 1;              // timeを進め、
-                f[u] = time;                  // 終了時刻をu.fに記録する
-                vs[u].color = vcolor::black;  // uを黒に彩色する
-            }
-        }
-    };
-    
+    Visit<Graph> visit { G, vs, f, time };  // 白頂点を訪問する手続き
 
     for (auto&& u : vs) {
         u.color = vcolor::white;                // 頂点をすべて白に彩色し、
@@ -157,7 +187,7 @@ std::pair<vertices_t, array_t> dfs(const graph_t& G)
     time = 0;                                   // 時刻カウンターを初期化
     for (auto u = 0; u < n; ++u) {              // Vの各頂点を順番に調べ、
         if (vs[u].color == vcolor::white) {     // 白頂点を発見すると、
-            iterative_visit(u);                 // visitを呼び出して訪問する
+            visit(u);                           // visitを呼び出して訪問する
             // visitを呼び出すたびに、頂点uが深さ優先森の新しい木の根になる
         }
     }
@@ -167,6 +197,27 @@ std::pair<vertices_t, array_t> dfs(const graph_t& G)
 }
 
 
+/**< @brief 隣接リスト表現のグラフGに対して深さ優先探索を行います */
+std::pair<vertices_t, array_t> dfs(const graph_t& G)
+{
+    return dfs_impl<iterative_visit>(G);
+}
+
+
+/**< @brief CSR表現のグラフGに対して深さ優先探索を行います */
+std::pair<vertices_t, array_t> dfs(const csr_graph& G)
+{
+    return dfs_impl<iterative_visit>(G);
+}
+
+
+/**< @brief 圧縮表現のグラフGに対して深さ優先探索を行います */
+std::pair<vertices_t, array_t> dfs(const compressed_graph& G)
+{
+    return dfs_impl<iterative_visit>(G);
+}
+
+
 
 //****************************************
 // 名前空間の終端
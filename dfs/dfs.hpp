@@ -19,6 +19,8 @@
 //****************************************
 
 #include "../graph/graph.hpp"
+#include "../graph/csr.hpp"
+#include "../graph/compressed.hpp"
 
 
 
@@ -72,6 +74,28 @@ std::pair<vertices_t, array_t> dfs(const graph_t& G);
 
 
 
+/**
+ * @brief  CSR表現のグラフGに対して深さ優先探索を行います
+ * @note   結果はgraph_tに対するdfsと同じである
+ *
+ * @param  グラフG(無向でも有向でもよい)
+ * @param  深さ優先森
+ */
+std::pair<vertices_t, array_t> dfs(const csr_graph& G);
+
+
+
+/**
+ * @brief  圧縮表現のグラフGに対して深さ優先探索を行います
+ * @note   隣接リストは終点の昇順に並び直されているので、発見時刻と深さ優先森は、同じ順に並べたgraph_tに対するdfsと同じである
+ *
+ * @param  グラフG(無向でも有向でもよい)
+ * @param  深さ優先森
+ */
+std::pair<vertices_t, array_t> dfs(const compressed_graph& G);
+
+
+
 //****************************************
 // 名前空間の終端
 //****************************************
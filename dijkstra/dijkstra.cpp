@@ -13,7 +13,9 @@
 #include <queue>
 #include <iostream>
 #include "../graph/greedy.hpp"
+#include "../graph/heap.hpp"
 #include "../graph/relax.hpp"
+#include "../graph/matrix.hpp"
 #include "dijkstra.hpp"
 
 
@@ -26,23 +28,6 @@ GRAPH_BEGIN
 
 
 
-//****************************************
-// 構造体の定義
-//****************************************
-
-struct state {
-    index_t  u;  /**< G.Vに属する頂点u */
-    weight_t d;  /**< 始点sからの距離d */
-
-    /**< @brief <演算子オーバーロード */
-    bool operator < (const state& s) const { return d > s.d; } // NOTE : min優先度付きキューのためにREVERSE
-
-    state() = default;
-    state(index_t u, weight_t d) : u(u), d(d) {}
-};
-
-
-
 //****************************************
 // 関数の定義
 //****************************************
@@ -55,34 +40,302 @@ struct state {
  *         アルゴリズムは繰り返し、最小の最短路推定値を持つ頂点u ∈ V - Sを選択し、uをSに追加し、
  *         uから出るすべての辺を緩和する. ここではd値をキーとする頂点のmin優先度付きキューQを用いる
  *
- * @note   優先度付きキューの優先度更新を行わないため、優先度付きキューが空になるまでに行われる挿入の数はΟ(E)であるが、
+ * @note   min優先度付きキューQには既定でDECREASE-KEY操作を持つ添字付き4分ヒープを用いる. 各頂点は高々1回しかQに置かれないので、
+ *         Qの大きさは|V|で抑えられ、全体としての実行時間はΟ((V + E)lgV)である
+ *         std::priority_queue<state>を渡した場合は優先度更新を行わないため、挿入の数はΟ(E)になるが、
  *         EXTRACT-MIN呼び出し時に、最短路の更新が行われないならば、無視をすることで、全体としての実行時間をΟ(ElgV)としている
  *
- * @param  const graph_t& G    非負の重み付き有向グラフG
- * @param  index_t        s    始点s
- * @return 始点sからの最短路重みが最終的に決定された頂点の集合S
+ * @note   辺重みが非負の整数であることを利用する単調な優先度付きキュー(radix_heap, bucket_queue)を渡すこともできる
+ *
+ * @tparam PriorityQueue      min優先度付きキューの型(dary_heap<D>, std::priority_queue<state>, radix_heap, bucket_queue)
+ * @tparam Graph              グラフGの表現(graph_tまたはcsr_graph)
+ * @tparam Vertices           頂点集合の表現(basic_vertices_soa<Traits>またはsearch_workspace). 添字と重みの型はその特性Traitsから定まる
+ * @param  const Graph&  G    非負の重み付き有向グラフG
+ * @param  index_type    s    始点s
+ * @param  Vertices&     S    始点sからの最短路重みが最終的に決定された頂点の集合S
+ * @param  PriorityQueue& Q   空のmin優先度付きキューQ
+ * @param  index_type    t    終点t. tをSに加えた時点で打ち切る(NILならばすべての頂点を処理する)
  */
-vertices_t dijkstra(const graph_t& G, index_t s)
+template<class PriorityQueue, class Graph, class Vertices>
+static void dijkstra_impl(const Graph& G, typename Vertices::index_type s, Vertices& S, PriorityQueue& Q,
+                          typename Vertices::index_type t = Vertices::traits_type::nil())
 {
-    index_t n = G.size();
-    vertices_t S(n);
-    std::priority_queue<state> Q;
+    using index_type  = typename Vertices::index_type;
+    using weight_type = typename Vertices::weight_type;
+    index_type n = G.size();
+    {
+        GRAPH_STAT_PHASE("initialize");
+        S.resize(n);
+        initialize_single_source_with_color(S, s);  // すべての頂点のd値とπ値を初期化する
+    }
 
-    
-    initialize_single_source_with_color(S, s);     // すべての頂点のd値とπ値を初期化する
-    Q.emplace(s, S[s].d);                          // このループの最初の実行ではu = sである
+    GRAPH_STAT_PHASE("search");
+    Q.emplace(s, S.d[s]);                          // このループの最初の実行ではu = sである
     while (!Q.empty()) {
-        state p = Q.top(); Q.pop();
-        index_t u = p.u; weight_t d = p.d;
-        if (S[u].d < d) { continue; }
+        auto p = Q.top(); Q.pop();
+        index_type u = p.u; weight_type d = p.d;
+        if (S.d[u] < d) { continue; }
+        if (u == t) { S.paint(u, vcolor::black); break; }  // tのd値は確定したので、残りの頂点を処理する必要はない
         for (auto&& e : G[u]) {        // 頂点uからでる辺(u, v)をそれぞれ緩和し、
             relax_with_heap(S, e, Q);  // uを経由することでvへの最短路が改善できる場合には、推定値v.dと先行点v.piを更新する
         }
-        S[u].color = vcolor::black;    // 黒頂点は集合Sに属す
+        S.paint(u, vcolor::black);     // 黒頂点は集合Sに属す
     }
     // 終了時点ではQ = φである. S = Vなので、すべての頂点u ∈ Vに対してu.d = δ(s, u)である
     // また、このとき、先行点部分グラフGπはsを根とする最短路木である
-    return S;
+}
+
+
+/**< @brief min優先度付きキューQ(省略すればdary_heap<4, Traits>)を生成してDijkstraのアルゴリズムを実行する */
+template<class PriorityQueue = void, class Graph, class Traits>
+static void dijkstra_impl(const Graph& G, typename Traits::index_type s, basic_vertices_soa<Traits>& S)
+{
+    using queue_type = std::conditional_t<std::is_void_v<PriorityQueue>, dary_heap<4, Traits>, PriorityQueue>;
+    queue_type Q = make_priority_queue<queue_type>(G.size());
+    dijkstra_impl(G, s, S, Q);
+}
+
+
+/**< @brief グラフGの最大の辺重みCを返す */
+template<class Graph>
+static weight_t max_weight(const Graph& G)
+{
+    weight_t C = 0;
+    index_t n = G.size();
+    for (index_t u = 0; u < n; ++u) {
+        for (auto&& e : G[u]) { C = std::max(C, e.w); }
+    }
+    return C;
+}
+
+
+/**
+ * @brief  非負整数の辺重みを持つグラフGに対して、キューの種類qを指定してDijkstraのアルゴリズムを実行する
+ * @note   q = queue_kind::automaticのときは、最大の辺重みCがdial_max_weight以下ならばDialのバケットを、そうでなければ基数ヒープを用いる
+ */
+template<class Graph>
+static void dijkstra_select(const Graph& G, index_t s, vertices_soa& S, queue_kind q)
+{
+    weight_t C = 0;
+    if (q == queue_kind::automatic || q == queue_kind::bucket_queue) {
+        C = max_weight(G);
+    }
+    if (q == queue_kind::automatic) {
+        q = C <= dial_max_weight ? queue_kind::bucket_queue : queue_kind::radix_heap;
+    }
+
+    switch (q) {
+    case queue_kind::radix_heap:   { radix_heap   Q;    dijkstra_impl(G, s, S, Q); break; }
+    case queue_kind::bucket_queue: { bucket_queue Q(C); dijkstra_impl(G, s, S, Q); break; }
+    default:                       { dijkstra_impl(G, s, S); break; }
+    }
+}
+
+
+/**< @brief 隣接リスト表現のグラフGに対してDijkstraのアルゴリズムを実行する */
+vertices_t dijkstra(const graph_t& G, index_t s)
+{
+    vertices_soa S;
+    dijkstra_impl(G, s, S);
+    return S.to_vertices();
+}
+
+
+/**< @brief CSR表現のグラフGに対してDijkstraのアルゴリズムを実行する */
+vertices_t dijkstra(const csr_graph& G, index_t s)
+{
+    vertices_soa S;
+    dijkstra_impl(G, s, S);
+    return S.to_vertices();
+}
+
+
+/**< @brief 隣接リスト表現のグラフGに対してDijkstraのアルゴリズムを実行し、結果を配列の構造体Sに格納する */
+void dijkstra(const graph_t& G, index_t s, vertices_soa& S)
+{
+    dijkstra_impl(G, s, S);
+}
+
+
+/**< @brief CSR表現のグラフGに対してDijkstraのアルゴリズムを実行し、結果を配列の構造体Sに格納する */
+void dijkstra(const csr_graph& G, index_t s, vertices_soa& S)
+{
+    dijkstra_impl(G, s, S);
+}
+
+
+/**< @brief 隣接リスト表現のグラフGに対して、キューの種類qを指定してDijkstraのアルゴリズムを実行する */
+void dijkstra(const graph_t& G, index_t s, vertices_soa& S, queue_kind q)
+{
+    dijkstra_select(G, s, S, q);
+}
+
+
+/**< @brief CSR表現のグラフGに対して、キューの種類qを指定してDijkstraのアルゴリズムを実行する */
+void dijkstra(const csr_graph& G, index_t s, vertices_soa& S, queue_kind q)
+{
+    dijkstra_select(G, s, S, q);
+}
+
+
+/**< @brief 隣接リスト表現のグラフGに対して、呼び出し側が用意したヒープQを用いてDijkstraのアルゴリズムを実行する */
+void dijkstra(const graph_t& G, index_t s, vertices_soa& S, dary_heap<4>& Q)
+{
+    if (Q.pos.size() != G.size()) { Q.resize(G.size()); }
+    dijkstra_impl(G, s, S, Q);
+}
+
+
+/**< @brief CSR表現のグラフGに対して、呼び出し側が用意したヒープQを用いてDijkstraのアルゴリズムを実行する */
+void dijkstra(const csr_graph& G, index_t s, vertices_soa& S, dary_heap<4>& Q)
+{
+    if (Q.pos.size() != static_cast<std::size_t>(G.size())) { Q.resize(G.size()); }
+    dijkstra_impl(G, s, S, Q);
+}
+
+
+/**< @brief 特性Traitsによる隣接リスト表現のグラフGに対してDijkstraのアルゴリズムを実行する */
+template<class Traits>
+void dijkstra(const basic_graph_t<Traits>& G, typename Traits::index_type s, basic_vertices_soa<Traits>& S)
+{
+    dijkstra_impl(G, s, S);
+}
+
+
+/**< @brief 特性TraitsによるCSR表現のグラフGに対してDijkstraのアルゴリズムを実行する */
+template<class Traits>
+void dijkstra(const basic_csr_graph<Traits>& G, typename Traits::index_type s, basic_vertices_soa<Traits>& S)
+{
+    dijkstra_impl(G, s, S);
+}
+
+
+/**< @brief 特性TraitsによるCSR表現のグラフGに対して、呼び出し側が用意したヒープQを用いてDijkstraのアルゴリズムを実行する */
+template<class Traits>
+void dijkstra(const basic_csr_graph<Traits>& G, typename Traits::index_type s, basic_vertices_soa<Traits>& S, dary_heap<4, Traits>& Q)
+{
+    if (Q.pos.size() != static_cast<std::size_t>(G.size())) { Q.resize(G.size()); }
+    dijkstra_impl(G, s, S, Q);
+}
+
+
+// 既定以外の特性による版の明示的な実体化. 既定の特性の版と同じdijkstra_implを用いる
+#define GRAPH_INSTANTIATE_DIJKSTRA(Traits)                                                                                         \
+    template void dijkstra<Traits>(const basic_graph_t<Traits>&, Traits::index_type, basic_vertices_soa<Traits>&);                 \
+    template void dijkstra<Traits>(const basic_csr_graph<Traits>&, Traits::index_type, basic_vertices_soa<Traits>&);               \
+    template void dijkstra<Traits>(const basic_csr_graph<Traits>&, Traits::index_type, basic_vertices_soa<Traits>&, dary_heap<4, Traits>&);
+
+GRAPH_INSTANTIATE_DIJKSTRA(wide_traits)
+GRAPH_INSTANTIATE_DIJKSTRA(narrow_traits)
+GRAPH_INSTANTIATE_DIJKSTRA(real_traits)
+
+#undef GRAPH_INSTANTIATE_DIJKSTRA
+
+
+/**< @brief 隣接リスト表現のグラフGに対して、作業領域Wを使い回してDijkstraのアルゴリズムを実行する */
+void dijkstra(const graph_t& G, index_t s, search_workspace& W)
+{
+    dijkstra_impl(G, s, W, W.Q);
+}
+
+
+/**< @brief CSR表現のグラフGに対して、作業領域Wを使い回してDijkstraのアルゴリズムを実行する */
+void dijkstra(const csr_graph& G, index_t s, search_workspace& W)
+{
+    dijkstra_impl(G, s, W, W.Q);
+}
+
+
+/**< @brief 隣接リスト表現のグラフGに対して、終点tを取り出した時点で打ち切るDijkstraのアルゴリズムを実行する */
+weight_t dijkstra(const graph_t& G, index_t s, index_t t, search_workspace& W)
+{
+    dijkstra_impl(G, s, W, W.Q, t);
+    return W.dist(t);
+}
+
+
+/**< @brief CSR表現のグラフGに対して、終点tを取り出した時点で打ち切るDijkstraのアルゴリズムを実行する */
+weight_t dijkstra(const csr_graph& G, index_t s, index_t t, search_workspace& W)
+{
+    dijkstra_impl(G, s, W, W.Q, t);
+    return W.dist(t);
+}
+
+
+weight_t dijkstra(const graph_t& G, index_t s, index_t t)
+{
+    search_workspace W;
+    return dijkstra(G, s, t, W);
+}
+
+
+weight_t dijkstra(const csr_graph& G, index_t s, index_t t)
+{
+    search_workspace W;
+    return dijkstra(G, s, t, W);
+}
+
+
+/**
+ * @brief  双方向Dijkstraのアルゴリズム
+ *
+ * @note   前向きの探索FはGの上でsから、後ろ向きの探索BはG^Tの上でtから、それぞれDijkstraのアルゴリズムを進める
+ *         各段では、キューの小さい方の探索から1頂点uを取り出しuから出る辺を緩和する. 緩和した辺(u, v)の終点vに反対側の探索が
+ *         すでに触れていれば、sからvを経てtに至る道の重みF.d[v] + B.d[v]で、これまでに見つけた最短の道の重みμを更新する
+ *
+ *         両方のキューの最小キーの和がμ以上になれば、まだ取り出していない頂点を通る道はμより短くならないので、μ = δ(s, t)である
+ *         μを与えた頂点vをmeetに記録しておけば、道はF上のs ~> vとB上のv ~> tをつないだものである
+ */
+template<class Graph>
+static weight_t dijkstra_bidirectional_impl(const Graph& G, const Graph& GT, index_t s, index_t t, bidirectional_workspace& W)
+{
+    index_t n = G.size();
+    search_workspace* X[2] = { &W.forward, &W.backward };
+    const Graph*      H[2] = { &G, &GT };
+    W.meet = limits::nil;
+    for (int k = 0; k < 2; ++k) { X[k]->resize(n); }
+    initialize_single_source_with_color(W.forward,  s); W.forward.Q.push(s, 0);
+    initialize_single_source_with_color(W.backward, t); W.backward.Q.push(t, 0);
+
+    weight_t mu = limits::inf;
+    if (s == t) { W.meet = s; return 0; }
+    while (!W.forward.Q.empty() && !W.backward.Q.empty()) {
+        if (W.forward.Q.top().d + W.backward.Q.top().d >= mu) { break; }  // これ以上短い道は見つからない
+        int k = W.forward.Q.size() <= W.backward.Q.size() ? 0 : 1;     // キューの小さい方の探索を進める
+        search_workspace& A = *X[k];
+        const search_workspace& O = *X[1 - k];
+
+        index_t u = A.Q.top().u; A.Q.pop();
+        for (auto&& e : (*H[k])[u]) {
+            relax_with_heap(A, e, A.Q);
+            index_t v = e.dst;
+            if (O.color(v) != vcolor::white && A.d[v] + O.d[v] < mu) {  // 反対側の探索が触れた頂点に出会った
+                mu = A.d[v] + O.d[v];
+                W.meet = v;
+            }
+        }
+        A.paint(u, vcolor::black);
+    }
+    return mu;
+}
+
+
+weight_t dijkstra_bidirectional(const csr_graph& G, const csr_graph& GT, index_t s, index_t t, bidirectional_workspace& W)
+{
+    return dijkstra_bidirectional_impl(G, GT, s, t, W);
+}
+
+
+weight_t dijkstra_bidirectional(const csr_graph& G, index_t s, index_t t)
+{
+    bidirectional_workspace W;
+    return dijkstra_bidirectional(G, transpose(G), s, t, W);
+}
+
+
+weight_t dijkstra_bidirectional(const graph_t& G, index_t s, index_t t)
+{
+    return dijkstra_bidirectional(csr_graph(G), s, t);
 }
 
 
@@ -92,33 +345,65 @@ vertices_t dijkstra(const graph_t& G, index_t s)
  *
  * @note   頂点v ∈ Vに対し、それぞれΟ(V)時間の操作を行うので、全体でΟ(V^2)時間を要す
  *
- * @param  const matrix_t& W    非負の重み付き有向グラフW
+ * @note   頂点の属性は配列の構造体として持つ. qは集合Sに属さない頂点ではv.d、属する頂点では∞であり、extract_minはqだけを走査する
+ *         第u行の緩和は、選択(条件が偽ならば元の値を残す)だけで書いた分岐のないループなので、-O3などでコンパイラが自動でベクトル化できる
+ *         辺の重みが非負ならば、集合Sに属する頂点vではv.d <= u.d <= u.d + w(u, v)なので、vを除外しなくても値は変わらない
+ *         結果(最短路重み、先行点、選ばれる頂点の順序)はvertices_tを直接更新する場合と同じである
+ *
+ * @tparam Matrix               隣接行列の表現(matrix_tまたはdense_matrix)
+ * @param  const Matrix&   W    非負の重み付き有向グラフW
  * @param  index_t         s    始点s
  * @return 始点sからの最短路重みが最終的に決定された頂点の集合S
  */
-vertices_t dijkstra(const matrix_t& W, index_t s)
+template<class Matrix>
+static vertices_t dijkstra_matrix_impl(const Matrix& W, index_t s)
 {
     index_t n = W.size();
-    vertices_t S(n);
-    auto relax_pred = [](const vertices_t& V, index_t u) -> bool { return !V[u].visited; };    
+    array_t   d(n, limits::inf), q(n, limits::inf);
+    indices_t pi(n, limits::nil);
+    stamps_t  visited(n, false);
 
-
-    initialize_single_source_with_visitor(S, s);  // すべての頂点のd値とπ値を初期化する
-    while(true) {     
+    d[s] = q[s] = 0;  // すべての頂点のd値とπ値を初期化する
+    while (true) {
         // 始点sからの最小の最短路推定値を持つ頂点u ∈ V - Sを選択する
-        index_t u = extract_min(S, n);   
+        index_t u = extract_min(q.data(), n);
         if (u == limits::nil) { break; }    // 頂点uがNILを指すならば、探索は終了である
-        for (index_t v = 0; v < n; v++) {
-            relax(S, W, u, v, relax_pred);  // uを経由することでvへの最短路が改善できる場合には、推定値v.dと先行点v.piを更新する
+        const weight_t  du = d[u];
+        const weight_t* w  = W[u].data();
+        GRAPH_STAT_ADD(edges_scanned, n);
+        for (index_t v = 0; v < n; ++v) {  // uを経由することでvへの最短路が改善できる場合には、推定値v.dと先行点v.piを更新する
+            weight_t x = du + w[v];        // w(u, v) = ∞ならばx >= ∞ >= v.dなので更新しない(∞はweight_tの最大値の3分の1なので桁あふれしない)
+            bool     c = x < d[v];
+            GRAPH_STAT_ADD(relaxations, c);
+            d[v]  = c ? x : d[v];
+            q[v]  = c ? x : q[v];
+            pi[v] = c ? u : pi[v];
         }
-        S[u].visited = true;  // 黒頂点は集合Sに属す
+        visited[u] = true;  // 黒頂点は集合Sに属す
+        q[u] = limits::inf;
     }
     // 終了時点では、S = Vなので、すべての頂点u ∈ Vに対してu.d = δ(s, u)である
     // また、このとき、先行点部分グラフGπはsを根とする最短路木である
+    vertices_t S(n);
+    for (index_t v = 0; v < n; ++v) { S[v].d = d[v]; S[v].pi = pi[v]; S[v].visited = visited[v]; }
     return S;
 }
 
 
+/**< @brief 隣接行列Wで表されたグラフに対してDijkstraのアルゴリズムを実行する */
+vertices_t dijkstra(const matrix_t& W, index_t s)
+{
+    return dijkstra_matrix_impl(W, s);
+}
+
+
+/**< @brief 密な行列Wで表されたグラフに対してDijkstraのアルゴリズムを実行する */
+vertices_t dijkstra(const dense_matrix& W, index_t s)
+{
+    return dijkstra_matrix_impl(W, s);
+}
+
+
 
 //****************************************
 // 名前空間の終端
@@ -19,6 +19,12 @@
 //****************************************
 
 #include "../graph/graph.hpp"
+#include "../graph/csr.hpp"
+#include "../graph/soa.hpp"
+#include "../graph/matrix.hpp"
+#include "../graph/heap.hpp"
+#include "../graph/workspace.hpp"
+#include "../graph/stats.hpp"
 
 
 
@@ -30,6 +36,51 @@ GRAPH_BEGIN
 
 
 
+//****************************************
+// 列挙型の定義
+//****************************************
+
+/**
+ * @brief  Dijkstraのアルゴリズムで用いるmin優先度付きキューの種類
+ * @note   radix_heapとbucket_queueは辺重みが非負の整数であることを利用する単調な優先度付きキューである(graph/heap.hpp)
+ */
+enum struct queue_kind : std::int32_t {
+    dary_heap,     /**< 添字付き4分ヒープ(比較に基づく. Ο((V + E)lgV)) */
+    radix_heap,    /**< 基数ヒープ(Ο(E + VlgC). Cは最大の辺重み) */
+    bucket_queue,  /**< Dialのバケット(Ο(E + V + D). Dは最大の最短路重み) */
+    automatic,     /**< 最大の辺重みCに応じて基数ヒープとDialのバケットから選ぶ */
+};
+
+
+/**< @brief queue_kind::automaticのとき、Dialのバケットを選ぶ最大の辺重みCの上限 */
+constexpr weight_t dial_max_weight = 1 << 8;
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief 双方向Dijkstraのアルゴリズムの作業領域
+ */
+struct bidirectional_workspace {
+    search_workspace forward;             /**< Gの上で始点sから進める探索 */
+    search_workspace backward;            /**< G^Tの上で終点tから進める探索 */
+    index_t          meet = limits::nil;  /**< 最短路上で両方の探索が出会った頂点(道がなければNIL) */
+
+    /**< @brief 直前の問い合わせで求めたsからtへの最短路上の頂点を、sから順に並べて返す(道がなければ空) */
+    indices_t path() const
+    {
+        if (meet == limits::nil) { return indices_t(); }
+        indices_t p = forward.path_to(meet);
+        for (index_t v = backward.pred(meet); v != limits::nil; v = backward.pred(v)) { p.push_back(v); }
+        return p;
+    }
+};
+
+
+
 //****************************************
 // 関数の宣言
 //****************************************
@@ -42,8 +93,8 @@ GRAPH_BEGIN
  *         アルゴリズムは、繰り返し、最小の最短路推定値を持つ頂点u ∈ V - Sを選択し、uをSに追加し、
  *         uから出るすべての辺を緩和する. ここではd値をキーとする頂点のmin優先度付きキューQを用いる
  *
- * @note   優先度付きキューの優先度更新を行わないため、優先度付きキューが空になるまでに行われる挿入の数はΟ(E)であるが、
- *         EXTRACT-MIN呼び出し時に、最短路の更新が行われないならば、無視をすることで、全体としての実行時間をΟ(ElgV)としている
+ * @note   min優先度付きキューQにはDECREASE-KEY操作を持つ添字付き4分ヒープを用いる(graph/heap.hpp)
+ *         各頂点は高々1回しかQに置かれないので、Qの大きさは|V|で抑えられ、全体としての実行時間はΟ((V + E)lgV)である
  *
  * @param  const graph_t& G    非負の重み付き有向グラフG
  * @param  index_t        s    始点s
@@ -53,6 +104,121 @@ vertices_t dijkstra(const graph_t& G, index_t s);
 
 
 
+/**
+ * @brief  CSR表現の非負の重み付き有向グラフG = (V, E)に対してDijkstraのアルゴリズムを実行する
+ * @note   結果はgraph_tに対するdijkstraと同じである
+ *
+ * @param  const csr_graph& G    非負の重み付き有向グラフG
+ * @param  index_t          s    始点s
+ * @return 始点sからの最短路重みが最終的に決定された頂点の集合S
+ */
+vertices_t dijkstra(const csr_graph& G, index_t s);
+
+
+
+/**
+ * @brief  Dijkstraのアルゴリズムを実行し、結果を配列の構造体Sに格納する
+ * @note   d値、π値、色を別々の配列に格納するので、緩和の内側のループが触れるメモリが少ない
+ *         Sは頂点数|V|に合わせて初期化される. vertices_tが必要ならばS.to_vertices()で変換できる
+ *
+ * @param  const graph_t& G    非負の重み付き有向グラフG
+ * @param  index_t        s    始点s
+ * @param  vertices_soa&  S    始点sからの最短路重みが最終的に決定された頂点の集合S
+ */
+void dijkstra(const graph_t& G, index_t s, vertices_soa& S);
+void dijkstra(const csr_graph& G, index_t s, vertices_soa& S);
+
+
+
+/**
+ * @brief  非負整数の辺重みを持つグラフGに対して、min優先度付きキューの種類qを指定してDijkstraのアルゴリズムを実行する
+ *
+ * @note   辺重みが非負の整数ならば、Dijkstraのアルゴリズムが取り出すキーは単調非減少なので、比較に基づくヒープの代わりに
+ *         キーの値そのものを使う基数ヒープやDialのバケットを用いることができ、EXTRACT-MINのlgVの比較のコストがなくなる
+ *         q = queue_kind::automaticのときは、最大の辺重みCを調べ、Cがdial_max_weight以下ならばDialのバケットを、
+ *         そうでなければ基数ヒープを用いる
+ *
+ * @param  const graph_t& G    非負の整数重み付き有向グラフG
+ * @param  index_t        s    始点s
+ * @param  vertices_soa&  S    始点sからの最短路重みが最終的に決定された頂点の集合S
+ * @param  queue_kind     q    min優先度付きキューの種類
+ */
+void dijkstra(const graph_t& G, index_t s, vertices_soa& S, queue_kind q);
+void dijkstra(const csr_graph& G, index_t s, vertices_soa& S, queue_kind q);
+
+
+
+/**
+ * @brief  呼び出し側が用意した添字付き4分ヒープQを用いてDijkstraのアルゴリズムを実行する
+ * @note   終了時にQは空に戻るので、同じSとQを始点を変えて繰り返し渡せば、作業領域を確保し直す必要がない
+ *         Qに置くことのできる頂点の数が|V|でなければ、Q.resize(|V|)を行う
+ *
+ * @param  const graph_t& G    非負の重み付き有向グラフG
+ * @param  index_t        s    始点s
+ * @param  vertices_soa&  S    始点sからの最短路重みが最終的に決定された頂点の集合S
+ * @param  dary_heap<4>&  Q    空のmin優先度付きキューQ
+ */
+void dijkstra(const graph_t& G, index_t s, vertices_soa& S, dary_heap<4>& Q);
+void dijkstra(const csr_graph& G, index_t s, vertices_soa& S, dary_heap<4>& Q);
+
+
+
+/**
+ * @brief  作業領域Wを使い回してDijkstraのアルゴリズムを実行する
+ * @note   Wの頂点属性は触れた頂点だけが初期化されるので、1回の呼び出しの時間はsから到達できる頂点と辺の数だけで決まり、|V|には依存しない
+ *         結果はW.dist(v), W.pred(v)で読む. 到達した頂点はW.touched()に並ぶ
+ *
+ * @param  const graph_t&     G    非負の重み付き有向グラフG
+ * @param  index_t            s    始点s
+ * @param  search_workspace&  W    作業領域(ヒープW.Qも使い回す)
+ */
+void dijkstra(const graph_t& G, index_t s, search_workspace& W);
+void dijkstra(const csr_graph& G, index_t s, search_workspace& W);
+
+
+
+/**
+ * @brief  始点sから終点tへの最短路重みδ(s, t)をDijkstraのアルゴリズムで求める
+ * @note   tをSに加えた時点でt.d = δ(s, t)が確定するので、そこで打ち切る. sよりtに近い頂点だけを処理すればよい
+ *         道が必要ならばW.path_to(t)で得られる. tに到達できなければlimits::infを返す
+ *
+ * @param  const graph_t&     G    非負の重み付き有向グラフG
+ * @param  index_t            s    始点s
+ * @param  index_t            t    終点t
+ * @param  search_workspace&  W    作業領域
+ * @return 最短路重みδ(s, t)
+ */
+weight_t dijkstra(const graph_t& G, index_t s, index_t t, search_workspace& W);
+weight_t dijkstra(const csr_graph& G, index_t s, index_t t, search_workspace& W);
+weight_t dijkstra(const graph_t& G, index_t s, index_t t);
+weight_t dijkstra(const csr_graph& G, index_t s, index_t t);
+
+
+
+/**
+ * @brief  双方向Dijkstraのアルゴリズム(bidirectional Dijkstra's algorithm)により、最短路重みδ(s, t)を求める
+ *
+ * @note   sからGの上を前向きに、tからG^Tの上を後ろ向きに、2つの探索を交互に進める. 緩和した辺の終点に反対側の探索がすでに触れていれば、
+ *         その頂点を経由する道の重みでこれまでの最短の重みμを更新し、両方のキューの最小キーの和がμ以上になった時点で打ち切る
+ *         それぞれの探索は半径がおよそδ(s, t) / 2の範囲しか調べないので、処理する頂点の数は片方向の場合より大きく減る
+ *
+ * @note   道はW.path()で得られる. tに到達できなければlimits::infを返す
+ *
+ * @param  const csr_graph&          G    非負の重み付き有向グラフG
+ * @param  const csr_graph&          GT   Gの転置G^T
+ * @param  index_t                   s    始点s
+ * @param  index_t                   t    終点t
+ * @param  bidirectional_workspace&  W    作業領域
+ * @return 最短路重みδ(s, t)
+ */
+weight_t dijkstra_bidirectional(const csr_graph& G, const csr_graph& GT, index_t s, index_t t, bidirectional_workspace& W);
+
+/**< @brief G^Tを計算してから双方向Dijkstraのアルゴリズムを実行する. 問い合わせを繰り返すときは、G^TとWを用意して上の版を用いること */
+weight_t dijkstra_bidirectional(const csr_graph& G, index_t s, index_t t);
+weight_t dijkstra_bidirectional(const graph_t& G, index_t s, index_t t);
+
+
+
 /**
  * @brief  すべての辺重みが非負であるという仮定の下で、Dijkstra(ダイクストラ)のアルゴリズム(Dijkstra's algorithm)は
  *         重み付き有向グラフG = (V, E)上の単一始点最短路問題を解く. ここでは各辺(u, v) ∈ Eについてw(u, v) >= 0を仮定する
@@ -67,6 +233,35 @@ vertices_t dijkstra(const matrix_t& W, index_t s);
 
 
 
+/**
+ * @brief  1本の整列された領域に格納した密な行列Wで表されたグラフに対してDijkstraのアルゴリズムを実行する
+ * @note   結果はmatrix_tに対するdijkstraと同じである. 各行が連続しているので、第u行の走査はキャッシュに優しい
+ */
+vertices_t dijkstra(const dense_matrix& W, index_t s);
+
+
+
+/**
+ * @brief  添字と重みの型を特性Traitsで選んだグラフGに対してDijkstraのアルゴリズムを実行する
+ *
+ * @note   既定の特性の版と同じdijkstra_impl(dijkstra.cpp)を実体化したものであり、異なるのは添字と重みの型だけである
+ *         重みの配列G.wとS.dの大きさは重みの型に比例するので、狭い型(narrow_traits)を選べばメモリ帯域を節約できる
+ *         dijkstra.cppでwide_traits, narrow_traits, real_traitsについて実体化する. 既定の特性による呼び出しには非テンプレートの版が選ばれる
+ *
+ * @param  const basic_csr_graph<Traits>& G    非負の重み付き有向グラフG
+ * @param  index_type                     s    始点s
+ * @param  basic_vertices_soa<Traits>&    S    始点sからの最短路重みが最終的に決定された頂点の集合S
+ * @param  dary_heap<4, Traits>&          Q    min優先度付きキューQ(頂点数が異なれば大きさを変更する)
+ */
+template<class Traits>
+void dijkstra(const basic_graph_t<Traits>& G, typename Traits::index_type s, basic_vertices_soa<Traits>& S);
+template<class Traits>
+void dijkstra(const basic_csr_graph<Traits>& G, typename Traits::index_type s, basic_vertices_soa<Traits>& S);
+template<class Traits>
+void dijkstra(const basic_csr_graph<Traits>& G, typename Traits::index_type s, basic_vertices_soa<Traits>& S, dary_heap<4, Traits>& Q);
+
+
+
 //****************************************
 // 名前空間の終端
 //****************************************
@@ -0,0 +1,144 @@
+/**
+ * @brief  最大フローを求めるDinicのアルゴリズムを扱う
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef DINIC_HPP
+#define DINIC_HPP
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "../graph/graph.hpp"
+#include "../graph/residual.hpp"
+#include <queue>
+#include <algorithm>
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief Dinicのアルゴリズム
+ * @note  Edmonds-Karpのアルゴリズムは最短の増加可能経路を1本見つけるたびに幅優先探索をやり直す
+ *        Dinicのアルゴリズムは、幅優先探索で残余ネットワークGfの各頂点vの入口sからの距離level[v]を求め、
+ *        level[v] = level[u] + 1を満たす残余辺(u, v)だけからなるレベルグラフ(level graph)を作る
+ *        そして、レベルグラフにsからtへの道がなくなるまで(阻止フロー(blocking flow)を求めるまで)深さ優先探索で増加可能経路を探す
+ *
+ *        各頂点uは現在の弧(current arc)iter[u]を持ち、これ以上フローを流せないと分かった残余辺は同じ段では二度と調べない
+ *        したがって、1つの段の阻止フローはΟ(VE)時間で求まり、sからtへの距離は段ごとに真に増えるので、全体の実行時間はΟ(V^2E)である
+ *        容量がすべて1のネットワーク(2部グラフの最大マッチングなど)では、Ο(E√V)時間で走る
+ *
+ * @note  残余ネットワークGfは対になった残余辺の配列(residual_network)で表す. 記憶量はΘ(V + E)である
+ */
+struct dinic {
+    residual_network Gf;  /**< 残余ネットワークGf */
+    indices_t level;      /**< 入口sからの距離(到達できなければ-1) */
+    indices_t iter;       /**< 現在の弧 */
+    index_t n;            /**< 頂点v ∈ Vの数 */
+
+    explicit dinic(std::size_t size) : Gf(size), level(size), iter(size), n(size) { }
+    explicit dinic(const graph_t& G) : dinic(G.size())
+    {
+        for (index_t i = 0; i < n; ++i) { for (auto&& e : G[i]) { add_edge(e.src, e.dst, e.c); } }
+    }
+
+    /**
+     * @brief  容量capの辺(u, v)を加える
+     * @return 加えた辺の番号(flowで辺のフローを調べるときに用いる)
+     */
+    index_t add_edge(index_t u, index_t v, capacity_t cap) { return Gf.add_edge(u, v, cap); }
+
+    /**
+     * @brief  Dinicのアルゴリズムを実行する
+     * @param  index_t s フローネットワークの入口(source) s
+     * @param  index_t t フローネットワークの出口(sink) t
+     * @return フローネットワークの最大フロー
+     */
+    capacity_t compute(index_t s, index_t t)
+    {
+        capacity_t flow = 0;
+        Gf.build();
+        while (bfs(s, t)) {  // レベルグラフにsからtへの道がある間、
+            std::copy(Gf.offset.begin(), Gf.offset.end() - 1, iter.begin());
+            for (capacity_t f; (f = dfs(s, t, limits::inf)) > 0; ) { flow += f; }  // 阻止フローを求める
+        }
+        return flow;
+    }
+
+    /**
+     * @brief  幅優先探索を用いて、残余ネットワークGfの各頂点の入口sからの距離levelを求める
+     * @return 出口tに到達できるか？
+     */
+    bool_t bfs(index_t s, index_t t)
+    {
+        level.assign(n, -1);
+        std::queue<index_t> Q;
+        level[s] = 0;
+        Q.push(s);
+        while (!Q.empty()) {
+            index_t u = Q.front(); Q.pop();
+            for (index_t a = Gf.offset[u]; a < Gf.offset[u + 1]; ++a) {
+                index_t v = Gf.dst[a];
+                if (Gf.cf[a] == 0 || level[v] >= 0) { continue; }
+                level[v] = level[u] + 1;
+                Q.push(v);
+            }
+        }
+        return level[t] >= 0;
+    }
+
+    /**
+     * @brief  レベルグラフの中で頂点uから出口tへの増加可能経路を深さ優先探索で探し、フローを流す
+     * @param  capacity_t flow 入口sから頂点uまでの道の残余容量
+     * @return 流したフローの量(道がなければ0)
+     */
+    capacity_t dfs(index_t u, index_t t, capacity_t flow)
+    {
+        if (u == t) { return flow; }
+        for (index_t& a = iter[u]; a < Gf.offset[u + 1]; ++a) {
+            index_t v = Gf.dst[a];
+            if (Gf.cf[a] == 0 || level[v] != level[u] + 1) { continue; }
+            capacity_t d = dfs(v, t, std::min(flow, Gf.cf[a]));
+            if (d > 0) {
+                Gf.push(a, d);
+                return d;
+            }
+        }
+        return 0;  // uからtへの道はこの段ではもう存在しない
+    }
+
+    /**< @brief k番目に加えた辺のフローを返す */
+    capacity_t flow(index_t k) const { return Gf.flow(k); }
+};
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
+
+
+
+#endif  // end of DINIC_HPP
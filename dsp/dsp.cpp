@@ -10,6 +10,9 @@
 //****************************************
 
 #include <iostream>
+#include <atomic>
+#include <algorithm>
+#include "../graph/parallel.hpp"
 #include "../topological_sort/tsort.hpp"
 #include "dsp.hpp"
 
@@ -59,7 +62,7 @@ std::pair<indices_t, array_t>  dsp(const graph_t& G, index_t s)
     };
 
     
-    array_t sorted = tsort(G);      // Gの頂点をトポロジカルソートする
+    indices_t sorted = tsort(G);    // Gの頂点をトポロジカルソートする
     initsinglesource(pi, d, s, n);  // 最短路推定値と先行点を初期化
     for (auto&& u : sorted) {       // for トポロジカルソート順に、各頂点u(頂点ごとに1回ずつ実行)
         for (auto e : G[u]) {       // for 各頂点 v ∈ G.Adj[u](全体として各辺をちょうど1回ずつ)
@@ -71,6 +74,57 @@ std::pair<indices_t, array_t>  dsp(const graph_t& G, index_t s)
 
 
 
+/**
+ * @brief  重み付き有向非巡回グラフGの単一始点最短路を、段ごとにthreads本のスレッドで計算する
+ * @note   各段の頂点はchunk個ずつ取ってスレッドで分担する. 段の区切りでは待ち合わせる
+ *
+ * @param  const csr_graph& G       重み付き有向非巡回グラフG
+ * @param  index_t          s       始点s
+ * @param  unsigned         threads スレッド数(0ならばハードウェアの並列度)
+ */
+std::pair<indices_t, array_t>  dsp_parallel(const csr_graph& G, index_t s, unsigned threads)
+{
+    constexpr std::size_t chunk = 256;  // 1回に取る頂点の数
+    index_t n = G.size();
+    threads = resolve_threads(threads);
+    indices_t pi(n, limits::nil); array_t d(n, limits::inf);
+    d[s] = 0;
+
+    const dag_levels L = tsort_levels(G, threads);  // Gの頂点を段に分解する
+    const csr_graph GT = transpose(G);              // vに入る辺を調べるためにG^Tを計算する
+    std::atomic<std::size_t> cursor(0);
+    barrier sync(threads);
+
+    parallel_run(threads, [&](unsigned tid) {
+        for (index_t l = 0; l < L.size(); ++l) {  // 段の順に、
+            const std::size_t last = L.offset[l + 1];
+            for (std::size_t i; (i = cursor.fetch_add(chunk, std::memory_order_relaxed)) < last; ) {
+                std::size_t end = std::min(i + chunk, last);
+                for (; i < end; ++i) {   // この段の各頂点vについて、
+                    index_t v = L.order[i];
+                    for (auto&& e : GT[v]) {  // vに入る各辺(u, v)を緩和する
+                        index_t u = e.dst;
+                        if (d[u] != limits::inf && d[v] > d[u] + e.w) { d[v] = d[u] + e.w; pi[v] = u; }
+                    }
+                }
+            }
+            sync.arrive_and_wait();
+            if (tid == 0) { cursor.store(last, std::memory_order_relaxed); }
+            sync.arrive_and_wait();
+        }
+    });
+    return std::make_pair(pi, d);
+}
+
+
+/**< @brief 隣接リスト表現の重み付き有向非巡回グラフGをCSR表現に変換してから、段ごとに並列に単一始点最短路を計算する */
+std::pair<indices_t, array_t>  dsp_parallel(const graph_t& G, index_t s, unsigned threads)
+{
+    return dsp_parallel(csr_graph(G), s, threads);
+}
+
+
+
 //****************************************
 // 名前空間の終端
 //****************************************
@@ -83,6 +137,8 @@ GRAPH_END
 // エントリポイント
 //****************************************
 
+#if !defined(GRAPH_NO_MAIN)  // 他のプログラムにリンクするときはGRAPH_NO_MAINを定義して動作例を除く
+
 int main(void)
 {
     const int n = 6;
@@ -108,3 +164,5 @@ int main(void)
 
     return 0;
 }
+
+#endif  // !defined(GRAPH_NO_MAIN)
@@ -19,6 +19,7 @@
 //****************************************
 
 #include "../graph/graph.hpp"
+#include "../graph/csr.hpp"
 
 
 
@@ -52,6 +53,26 @@ std::pair<indices_t, array_t>  dsp(const graph_t& G, index_t s);
 
 
 
+/**
+ * @brief  重み付き有向非巡回グラフGの単一始点最短路を、段ごとにthreads本のスレッドで計算する
+ *
+ * @note   Gの頂点をKahnのアルゴリズムで段に分解し(tsort_levels)、段の順に処理する. 同じ段の頂点の間には辺がないので、
+ *         各段の頂点vの最短路推定値は互いに独立に決まる. 各頂点vについて、vに入る辺(u, v)をすべて緩和する(引く方向の緩和)
+ *         uはすべてvより前の段にあり、u.dはすでに確定しているので、緩和に不可分操作は必要なく、結果はスレッド数によらない
+ *         入る辺を調べるためにGの転置G^Tを1回だけ生成する
+ *
+ * @note   d値はdspと一致する. 同じ重みの最短路が複数あるとき、π値はdspと異なりうるが、Gπは最短路木である
+ *         このアルゴリズムの仕事量はΘ(V + E)であり、段の数をLとすると、スレッドの待ち合わせはΟ(L)回である
+ *
+ * @param  const csr_graph& G       重み付き有向非巡回グラフG
+ * @param  index_t          s       始点s
+ * @param  unsigned         threads スレッド数(0ならばハードウェアの並列度)
+ */
+std::pair<indices_t, array_t>  dsp_parallel(const csr_graph& G, index_t s, unsigned threads = 0);
+std::pair<indices_t, array_t>  dsp_parallel(const graph_t& G, index_t s, unsigned threads = 0);
+
+
+
 //****************************************
 // 名前空間の終端
 //****************************************
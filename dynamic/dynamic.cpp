@@ -0,0 +1,235 @@
+/**
+ * @brief  辺の挿入と重みの減少を受け付ける動的グラフの実装
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <algorithm>
+#include <vector>
+#include <tuple>
+#include "../graph/stats.hpp"
+#include "../dijkstra/dijkstra.hpp"
+#include "../kruskal/kruskal.hpp"
+#include "dynamic.hpp"
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+namespace {
+
+    /**
+     * @brief  Gに辺(u, v, w)を挿入するか、既存の辺(u, v)の重みをwに減らす
+     * @return Gを変えたか？
+     */
+    bool put_edge(graph_t& G, index_t u, index_t v, weight_t w)
+    {
+        for (auto&& e : G[u]) {
+            if (e.dst != v) { continue; }
+            if (w >= e.w) { return false; }
+            e.w = w;
+            return true;
+        }
+        G[u].emplace_back(u, v, w);
+        return true;
+    }
+
+
+    /**
+     * @brief  親の配列parentで表した根付き木の森で、頂点xを根とするように、xから根までの経路上の親の向きを逆にする
+     * @note   各辺の重みparent_wも辺とともに移す. 実行時間はxの深さに比例する
+     */
+    void evert(indices_t& parent, array_t& parent_w, index_t x)
+    {
+        index_t  c = x, p = parent[x];
+        weight_t w = parent_w[x];
+        parent[x] = limits::nil;
+        while (p != limits::nil) {
+            index_t  q = parent[p];
+            weight_t z = parent_w[p];
+            parent[p] = c; parent_w[p] = w;
+            c = p; p = q; w = z;
+        }
+    }
+
+}
+
+
+/**< @brief n頂点の辺を持たないグラフを生成する */
+dynamic_graph::dynamic_graph(index_t n, bool undirected)
+    : G(n), undirected(undirected), ds(n), components(n)
+{
+}
+
+
+/**< @brief 隣接リスト表現Gから生成する */
+dynamic_graph::dynamic_graph(const graph_t& G, bool undirected)
+    : G(G), undirected(undirected), ds(G.size()), components(static_cast<index_t>(G.size()))
+{
+    for (auto&& es : G) {
+        for (auto&& e : es) { if (ds.merge(e.src, e.dst)) { --components; } }
+    }
+}
+
+
+/**< @brief 始点sからの最短路を計算し、以後の更新で保つ */
+void dynamic_graph::track_shortest_paths(index_t s)
+{
+    source = s;
+    V = dijkstra(G, s);
+    Q.resize(G.size());
+}
+
+
+/**
+ * @brief  最小全域森を計算し、以後の更新で保つ
+ * @note   kruskalで求めた辺集合を、各木で最小の添字の頂点を根とする根付き木の森に直す
+ */
+void dynamic_graph::track_spanning_forest()
+{
+    index_t n = size();
+    forest = true;
+    edges_t T;
+    std::tie(T, forest_weight) = kruskal(G);
+
+    graph_t F(n);
+    for (auto&& e : T) { F[e.src].push_back(e); F[e.dst].emplace_back(e.dst, e.src, e.w); }
+    parent.assign(n, limits::nil);
+    parent_w.assign(n, 0);
+    mark.assign(n, 0);
+    stamp = 0;
+    std::vector<bool> seen(n, false);
+    indices_t S;
+    for (index_t r = 0; r < n; ++r) {
+        if (seen[r]) { continue; }
+        seen[r] = true;
+        S.assign(1, r);
+        while (!S.empty()) {
+            index_t u = S.back(); S.pop_back();
+            for (auto&& e : F[u]) {
+                if (seen[e.dst]) { continue; }
+                seen[e.dst] = true;
+                parent[e.dst] = u; parent_w[e.dst] = e.w;
+                S.push_back(e.dst);
+            }
+        }
+    }
+}
+
+
+/**< @brief 最小全域森の辺集合を返す */
+edges_t dynamic_graph::spanning_forest() const
+{
+    edges_t T;
+    for (index_t v = 0; v < static_cast<index_t>(parent.size()); ++v) {
+        if (parent[v] != limits::nil) { T.emplace_back(parent[v], v, parent_w[v]); }
+    }
+    return T;
+}
+
+
+/**
+ * @brief  辺の列batchをまとめて挿入する
+ * @note   最小全域森は辺を1本ずつ加えて修復する. 異なる木を結ぶかどうかは、その辺を加える前の連結成分dsで判定する
+ */
+std::size_t dynamic_graph::apply(const edges_t& batch)
+{
+    edges_t changed, added;
+    for (auto&& e : batch) {
+        bool forward  = put_edge(G, e.src, e.dst, e.w);
+        bool backward = undirected && e.src != e.dst && put_edge(G, e.dst, e.src, e.w);
+        if (forward)  { changed.push_back(e); }
+        if (backward) { changed.emplace_back(e.dst, e.src, e.w); }
+        if (forward || backward) { added.push_back(e); }
+    }
+    if (added.empty()) { return 0; }
+
+    if (source != limits::nil) { repair_shortest_paths(G, changed, V, Q); }
+    for (auto&& e : added) {
+        index_t u = e.src, v = e.dst;
+        if (u == v) { continue; }
+        if (ds.merge(u, v)) {  // 異なる木を結ぶ辺は、そのまま森に加える
+            --components;
+            if (forest) { evert(parent, parent_w, u); parent[u] = v; parent_w[u] = e.w; forest_weight += e.w; }
+            continue;
+        }
+        if (!forest) { continue; }
+
+        // uの祖先に印を付け、vから印のある頂点まで辿れば、それがuとvの最も近い共通の祖先aである
+        ++stamp;
+        for (index_t x = u; x != limits::nil; x = parent[x]) { mark[x] = stamp; }
+        index_t a = v;
+        while (mark[a] != stamp) { a = parent[a]; }
+
+        // 木の上のuからvへの経路で最も重い辺(x, parent[x])を探す. xはuの側かvの側のどちらかにある
+        index_t x = limits::nil, side = limits::nil;
+        weight_t heaviest = e.w;
+        for (index_t y = u; y != a; y = parent[y]) { if (parent_w[y] > heaviest) { heaviest = parent_w[y]; x = y; side = u; } }
+        for (index_t y = v; y != a; y = parent[y]) { if (parent_w[y] > heaviest) { heaviest = parent_w[y]; x = y; side = v; } }
+        if (x == limits::nil) { continue; }  // (u, v)は閉路で最も重いので、森は変わらない
+
+        // (x, parent[x])を切り離すと、sideはxを根とする木に残る. sideを根にしてから、もう一方の端点の子とする
+        parent[x] = limits::nil;
+        evert(parent, parent_w, side);
+        parent[side] = side == u ? v : u; parent_w[side] = e.w;
+        forest_weight += e.w - heaviest;
+    }
+    return added.size();
+}
+
+
+/**< @brief 辺(u, v, w)を1本だけ挿入する */
+std::size_t dynamic_graph::insert(index_t u, index_t v, weight_t w)
+{
+    return apply(edges_t(1, edge(u, v, w)));
+}
+
+
+/**
+ * @brief  辺の挿入または重みの減少の後に、始点sからの最短路重みVを修復する
+ * @note   Qから取り出した頂点の距離は確定しているので(Dijkstraのアルゴリズムの正当性と同じ理由による)、各頂点は高々1回しか取り出されない
+ */
+std::size_t repair_shortest_paths(const graph_t& G, const edges_t& changed, vertices_t& V, dary_heap<4>& Q)
+{
+    auto relax = [&](index_t u, index_t v, weight_t w) {
+        GRAPH_STAT_ADD(edges_scanned, 1);
+        if (V[u].d == limits::inf || V[u].d + w >= V[v].d) { return; }
+        V[v].d  = V[u].d + w;
+        V[v].pi = u;
+        Q.push(v, V[v].d);
+        GRAPH_STAT_ADD(relaxations, 1);
+    };
+
+    for (auto&& e : changed) { relax(e.src, e.dst, e.w); }
+    std::size_t count = 0;
+    while (!Q.empty()) {
+        index_t u = Q.top().u; Q.pop();
+        ++count;
+        V[u].color = vcolor::black;
+        for (auto&& e : G[u]) { relax(u, e.dst, e.w); }
+    }
+    return count;
+}
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
@@ -0,0 +1,158 @@
+/**
+ * @brief  辺の挿入と重みの減少を受け付ける動的グラフと、その上で最短路、連結性、最小全域森を増分的に保つ処理を扱う
+ *
+ * @note   辺がすこしずつ追加されるグラフで、更新のたびにdijkstraやkruskalを最初から実行し直すと、1回の更新にΘ(E lgV)時間かかる
+ *         辺(u, v)の挿入や重みの減少は距離を増やさないので、影響を受けるのは新しい辺を通ってv.dが減る頂点だけである
+ *         dynamic_graphは更新をまとめて(batch)受け取り、
+ *           最短路     : 始点sからの最短路重みv.dと先行点v.πを、距離が減った頂点だけからDijkstraのアルゴリズムを再開して修復する
+ *           連結性     : 素集合森(disjoint_sets)に新しい辺の端点を合併する
+ *           最小全域森 : kruskalで求めた森を根付き木の森として保ち、新しい辺(u, v)が作る閉路で最も重い辺と入れ替える
+ *         ことで、結果を最初から計算し直さずに保つ
+ *
+ * @note   最小全域森の辺(u, v)の挿入は、uとvから根に向かって親を辿り、その間の経路の長さに比例する時間で済む
+ *         異なる木を結ぶ辺ならば、uを根とするように木の親の向きを付け替えてからvの子とする
+ *         同じ木の2頂点を結ぶ辺ならば、木の上のuからvへの経路で最も重い辺(x, y)を探し、それが(u, v)より重ければ(x, y)を切り離して(u, v)でつなぐ
+ *         (閉路性: 閉路で最も重い辺を含まない最小全域森が存在する)
+ *
+ * @note   辺の削除と重みの増加は扱わない(それらは距離を増やしうるので、影響の範囲が局所的に定まらない)
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef DYNAMIC_HPP
+#define DYNAMIC_HPP
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "../graph/graph.hpp"
+#include "../graph/heap.hpp"
+#include "../kruskal/disjoint_sets/disjoint_sets.hpp"
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief  辺の挿入と重みの減少をまとめて受け付ける動的グラフ
+ *
+ * @note   グラフは隣接リスト表現Gで保持する. 無向グラフ(undirected = true)では、各辺を両方向の辺としてGに格納する
+ *         連結性は常に保つ. 最短路と最小全域森は、それぞれtrack_shortest_paths, track_spanning_forestを呼んだ後から保つ
+ *
+ * @note   使い方
+ *           graph::dynamic_graph D(G);          // 無向グラフGから生成する
+ *           D.track_shortest_paths(s);          // dijkstra(G, s)を計算し、以後保つ
+ *           D.track_spanning_forest();          // kruskal(G)を計算し、以後保つ
+ *           D.apply(batch);                     // 辺(u, v, w)の列をまとめて挿入する
+ *           D.V[v].d, D.connected(u, v), D.forest_weight, ...
+ */
+struct dynamic_graph {
+    graph_t       G;                      /**< 隣接リスト表現 */
+    bool          undirected = true;      /**< 無向グラフか？ */
+    disjoint_sets ds;                     /**< 連結成分(有向グラフでは辺の向きを無視した弱連結成分) */
+    index_t       components = 0;         /**< 連結成分の数 */
+
+    index_t       source = limits::nil;   /**< 最短路の始点s(保っていなければNIL) */
+    vertices_t    V;                      /**< 始点sからの最短路重みv.dと先行点v.π */
+    dary_heap<4>  Q;                      /**< 修復に用いるmin優先度付きキュー(更新の間は空) */
+
+    bool          forest = false;         /**< 最小全域森を保っているか？ */
+    indices_t     parent;                 /**< 最小全域森を根付き木の森として表したときの頂点vの親(根ならばNIL) */
+    array_t       parent_w;               /**< 辺(v, parent[v])の重み */
+    weight_t      forest_weight = 0;      /**< 最小全域森の重み */
+    indices_t     mark;                   /**< 閉路を探すときの印 */
+    index_t       stamp = 0;              /**< いまの印の値 */
+
+
+    /**< @brief n頂点の辺を持たないグラフを生成する */
+    explicit dynamic_graph(index_t n, bool undirected = true);
+
+    /**
+     * @brief 隣接リスト表現Gから生成する
+     * @note  無向グラフでは、Gは各辺を両方向の辺として含んでいること(リポジトリの他のアルゴリズムと同じ規約)
+     */
+    explicit dynamic_graph(const graph_t& G, bool undirected = true);
+
+    /**< @brief 頂点数|V|を返す */
+    index_t size() const { return static_cast<index_t>(G.size()); }
+
+    /**< @brief 始点sからの最短路を計算し、以後の更新で保つ */
+    void track_shortest_paths(index_t s);
+
+    /**< @brief 最小全域森を計算し、以後の更新で保つ */
+    void track_spanning_forest();
+
+    /**< @brief 最小全域森の辺集合を返す */
+    edges_t spanning_forest() const;
+
+    /**
+     * @brief  辺の列batchをまとめて挿入する
+     * @note   辺(u, v, w)について、Gに辺(u, v)がなければ挿入し、あればその重みをmin(w, w(u, v))に減らす
+     *         最短路は、すべての辺をGに反映してから1回だけ修復するので、同じ頂点を何度も取り出さずに済む
+     *
+     * @param  const edges_t& batch 辺(u, v, w)の列
+     * @return Gを変えた辺の数(既存の辺より重い辺は何も変えない)
+     */
+    std::size_t apply(const edges_t& batch);
+
+    /**< @brief 辺(u, v, w)を1本だけ挿入する */
+    std::size_t insert(index_t u, index_t v, weight_t w);
+
+    /**< @brief uとvが同じ連結成分に属するか？ */
+    bool connected(index_t u, index_t v) { return ds.same(u, v); }
+};
+
+
+
+//****************************************
+// 関数の宣言
+//****************************************
+
+/**
+ * @brief  辺の挿入または重みの減少の後に、始点sからの最短路重みVを修復する
+ *
+ * @note   Vは更新前のグラフに対するdijkstraの結果であり、Gにはすでにchangedの辺が反映されているとする
+ *         各辺(u, v, w) ∈ changedを緩和し、v.dが減った頂点vだけをQに置いてDijkstraのアルゴリズムを再開する
+ *         Qから取り出した頂点uの辺を緩和して、さらに距離が減った頂点をQに置く. 距離が変わらない頂点の辺は調べない
+ *
+ * @note   実行時間はΟ(Σ(deg(v) + 1) lgV)であり、和は距離が減った頂点vについてとる. 影響が小さい更新では|V|や|E|によらない
+ *         Qは空であり、頂点数|V|に合わせた大きさであること. 戻ったときには空である
+ *
+ * @param  const graph_t&  G       更新後のグラフ
+ * @param  const edges_t&  changed 挿入した辺と重みを減らした辺(新しい重み)
+ * @param  vertices_t&     V       最短路重みと先行点
+ * @param  dary_heap<4>&   Q       min優先度付きキュー
+ * @return 距離が減った頂点の数
+ */
+std::size_t repair_shortest_paths(const graph_t& G, const edges_t& changed, vertices_t& V, dary_heap<4>& Q);
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
+
+
+
+#endif  // end of DYNAMIC_HPP
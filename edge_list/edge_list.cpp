@@ -0,0 +1,269 @@
+/**
+ * @brief  テキストの辺リストの並列な解析と、並列の計数ソートによるCSR表現の構成の実装を行う
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include "../graph/parallel.hpp"
+#include "../graph/mapped_file.hpp"
+#include "edge_list.hpp"
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+namespace {
+
+    /**< @brief 1本のスレッドが解析する辺リストの区間の最小の長さ[byte]. これより短い入力ではスレッドを減らす */
+    const std::size_t min_chunk = 1 << 16;
+
+
+    inline bool is_space(char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\n'; }
+
+    inline const char* skip_space(const char* p, const char* last)
+    {
+        while (p != last && is_space(*p)) { ++p; }
+        return p;
+    }
+
+
+    /**
+     * @brief  pから始まる整数を読み、xに格納する
+     * @note   符号の後に数字が続き、その後が空白か終端であるものだけを整数とする. index_tに収まらなければ失敗とする
+     * @return 整数の直後の位置(失敗したときはnullptr)
+     */
+    inline const char* parse_int(const char* p, const char* last, index_t& x)
+    {
+        bool neg = false;
+        if (p != last && (*p == '-' || *p == '+')) { neg = *p == '-'; ++p; }
+        if (p == last || static_cast<unsigned>(*p - '0') > 9) { return nullptr; }
+        std::int64_t v = 0;
+        for (; p != last && static_cast<unsigned>(*p - '0') <= 9; ++p) {
+            v = v * 10 + (*p - '0');
+            if (v > std::numeric_limits<index_t>::max()) { return nullptr; }
+        }
+        if (p != last && !is_space(*p)) { return nullptr; }
+        x = static_cast<index_t>(neg ? -v : v);
+        return p;
+    }
+
+
+    /**
+     * @brief  区間[p, last)の辺を解析し、Eに加える
+     * @return 区間のすべての語が正しい辺をなしていたか？
+     */
+    bool parse_chunk(const char* p, const char* last, index_t n, bool weighted, edges_t& E)
+    {
+        while ((p = skip_space(p, last)) != last) {
+            index_t u, v, w = 1;
+            if (!(p = parse_int(p, last, u)) || !(p = parse_int(skip_space(p, last), last, v))) { return false; }
+            if (weighted && !(p = parse_int(skip_space(p, last), last, w))) { return false; }
+            if (u < 0 || u >= n || v < 0 || v >= n) { return false; }
+            E.emplace_back(u, v, w);
+        }
+        return true;
+    }
+
+
+    /**
+     * @brief  各スレッドが解析した辺の列E[0], ..., E[threads-1]から、並列の計数ソートでCSR表現Gを構成する
+     * @note   頂点を[bound[b], bound[b + 1])のthreads個のブロックに分け、ブロックbの頂点を始点とする有向辺(arc)はスレッドbが数えて書き込む
+     *         各スレッドtはまず自分の辺を始点のブロックごとのバケツarcs[t][b]に振り分け、E[t]を解放する
+     *         スレッドbはarcs[0][b], ..., arcs[threads-1][b]をこの順に調べるので、同じ始点を持つ辺の順序はファイルでの順序を保つ
+     *         頂点ごとの数はブロックの持ち主だけが触れるので、スレッドごとに長さnの配列を持たずに済む
+     *
+     * @note   無向グラフならば、自己ループでない各辺(u, v)について(v, u)もバケツに置く. 有向辺の数がindex_tに収まることは呼び出し側で確かめる
+     */
+    void build_csr(index_t n, std::vector<edges_t>& E, bool directed, unsigned threads, csr_graph& G)
+    {
+        indices_t bound(threads + 1);
+        for (unsigned b = 0; b <= threads; ++b) { bound[b] = static_cast<index_t>(static_cast<std::int64_t>(n) * b / threads); }
+        auto block_of = [&](index_t u) {  // 頂点uを含むブロックの番号
+            unsigned b = static_cast<unsigned>(static_cast<std::int64_t>(u) * threads / std::max<index_t>(n, 1));
+            while (bound[b + 1] <= u) { ++b; }
+            while (bound[b] > u) { --b; }
+            return b;
+        };
+
+        std::vector<std::vector<edges_t>> arcs(threads, std::vector<edges_t>(threads));
+        indices_t deg(n, 0);              // ブロックの持ち主が数える頂点uの次数. 書き込むときは次の書き込み位置とする
+        indices_t block(threads + 1, 0);  // block[b] = ブロックbより前の辺の数
+        G.offset.assign(n + 1, 0);
+        index_t* offset = G.offset.mutable_data();
+        index_t* dst = nullptr;
+        weight_t* w = nullptr;
+
+        barrier sync(threads);
+        parallel_run(threads, [&](unsigned tid) {
+            // 1. 自分の辺を始点のブロックごとに振り分ける. 先に数えて確保するので、バケツの大きさはちょうど有向辺の数になる
+            std::vector<edges_t>& A = arcs[tid];
+            std::vector<std::size_t> size(threads, 0);
+            for (auto&& e : E[tid]) {
+                ++size[block_of(e.src)];
+                if (!directed && e.src != e.dst) { ++size[block_of(e.dst)]; }
+            }
+            for (unsigned b = 0; b < threads; ++b) { A[b].reserve(size[b]); }
+            for (auto&& e : E[tid]) {
+                A[block_of(e.src)].push_back(e);
+                if (!directed && e.src != e.dst) { A[block_of(e.dst)].emplace_back(e.dst, e.src, e.w); }
+            }
+            edges_t().swap(E[tid]);
+            sync.arrive_and_wait();
+
+            // 2. 自分のブロックの頂点の次数を数える
+            const index_t first = bound[tid], last = bound[tid + 1];
+            index_t sum = 0;
+            for (unsigned t = 0; t < threads; ++t) {
+                for (auto&& e : arcs[t][tid]) { ++deg[e.src]; }
+                sum += static_cast<index_t>(arcs[t][tid].size());
+            }
+            block[tid + 1] = sum;
+            sync.arrive_and_wait();
+
+            // 3. ブロックの接頭辞和を求めてから、各ブロックの中の接頭辞和を求める
+            if (tid == 0) {
+                for (unsigned t = 0; t < threads; ++t) { block[t + 1] += block[t]; }
+                G.dst.resize(block[threads]); G.w.resize(block[threads]);
+                dst = G.dst.mutable_data(); w = G.w.mutable_data();
+            }
+            sync.arrive_and_wait();
+            for (index_t u = first, i = block[tid]; u < last; ++u) { index_t k = deg[u]; deg[u] = i; i += k; offset[u + 1] = i; }
+
+            // 4. 自分のブロックの辺を、スレッドの順(ファイルでの順)に書き込む
+            for (unsigned t = 0; t < threads; ++t) {
+                for (auto&& e : arcs[t][tid]) { index_t i = deg[e.src]++; dst[i] = e.dst; w[i] = e.w; }
+                edges_t().swap(arcs[t][tid]);
+            }
+        });
+    }
+
+
+    /**
+     * @brief  Gの各隣接リストを終点の昇順に整列し、同じ終点を持つ辺を重みが最小のもの1本にまとめたグラフを返す
+     * @note   頂点をブロックに分けてスレッドで分担し、残す辺の数の接頭辞和をbuild_csrと同じ方法で求める
+     */
+    csr_graph dedup(const csr_graph& G, unsigned threads)
+    {
+        const index_t n = G.size();
+        csr_graph D;
+        D.offset.assign(n + 1, 0);
+        index_t* offset = D.offset.mutable_data();
+        std::vector<std::vector<std::pair<index_t, weight_t>>> kept(threads);
+        indices_t deg(n, 0);
+        indices_t block(threads + 1, 0);
+        index_t* dst = nullptr;
+        weight_t* w = nullptr;
+
+        barrier sync(threads);
+        parallel_run(threads, [&](unsigned tid) {
+            const index_t first = static_cast<index_t>(static_cast<std::int64_t>(n) * tid / threads);
+            const index_t last  = static_cast<index_t>(static_cast<std::int64_t>(n) * (tid + 1) / threads);
+            auto& K = kept[tid];  // このブロックで残す辺(終点, 重み)
+            std::vector<std::pair<index_t, weight_t>> adj;
+            for (index_t u = first; u < last; ++u) {
+                adj.clear();
+                for (index_t i = G.offset[u]; i < G.offset[u + 1]; ++i) { adj.emplace_back(G.dst[i], G.w[i]); }
+                std::sort(adj.begin(), adj.end());
+                std::size_t before = K.size();
+                for (std::size_t k = 0; k < adj.size(); ++k) {
+                    if (k == 0 || adj[k].first != adj[k - 1].first) { K.push_back(adj[k]); }
+                }
+                deg[u] = static_cast<index_t>(K.size() - before);
+            }
+            block[tid + 1] = static_cast<index_t>(K.size());
+            sync.arrive_and_wait();
+
+            if (tid == 0) {
+                for (unsigned t = 0; t < threads; ++t) { block[t + 1] += block[t]; }
+                D.dst.resize(block[threads]); D.w.resize(block[threads]);
+                dst = D.dst.mutable_data(); w = D.w.mutable_data();
+            }
+            sync.arrive_and_wait();
+            for (index_t u = first, i = block[tid]; u < last; ++u) { i += deg[u]; offset[u + 1] = i; }
+            for (std::size_t k = 0; k < K.size(); ++k) { dst[block[tid] + k] = K[k].first; w[block[tid] + k] = K[k].second; }
+        });
+        return D;
+    }
+
+}
+
+
+/**
+ * @brief  メモリ上の辺リスト[first, last)を解析し、Gとする
+ */
+bool parse_edge_list(const char* first, const char* last, csr_graph& G, const edge_list_params& params)
+{
+    // 1行目のn, mを読み、行の残りを読み飛ばす
+    index_t n, m;
+    const char* p = skip_space(first, last);
+    if (!(p = parse_int(p, last, n)) || !(p = parse_int(skip_space(p, last), last, m)) || n < 0 || m < 0) { return false; }
+    if (!params.directed && 2 * static_cast<std::int64_t>(m) > std::numeric_limits<index_t>::max()) { return false; }  // 有向辺の添字が桁あふれする
+    while (p != last && *p != '\n') { ++p; }
+
+    // 本体を改行の位置でthreads個の区間に分ける
+    const std::size_t bytes = static_cast<std::size_t>(last - p);
+    unsigned threads = static_cast<unsigned>(std::min<std::size_t>(resolve_threads(params.threads), std::max<std::size_t>(bytes / min_chunk, 1)));
+    std::vector<const char*> cut(threads + 1, last);
+    cut[0] = p;
+    for (unsigned t = 1; t < threads; ++t) {
+        const char* q = std::max(cut[t - 1], p + bytes * t / threads);
+        while (q != last && *q != '\n') { ++q; }
+        cut[t] = q;
+    }
+
+    std::vector<edges_t> E(threads);
+    std::atomic<bool> ok(true);
+    parallel_run(threads, [&](unsigned tid) {
+        E[tid].reserve(std::min<std::size_t>(m, bytes / 4) / threads + 1);  // 1辺は少なくとも4バイトなので、mが壊れていても確保しすぎない
+        if (!parse_chunk(cut[tid], cut[tid + 1], n, params.weighted, E[tid])) { ok = false; }
+    });
+    if (!ok) { return false; }
+    std::size_t total = 0;
+    for (auto&& es : E) { total += es.size(); }
+    if (total != static_cast<std::size_t>(m)) { return false; }
+
+    csr_graph H;
+    build_csr(n, E, params.directed, threads, H);
+    G = params.dedup ? dedup(H, threads) : std::move(H);
+    return true;
+}
+
+
+/**
+ * @brief  ファイルpathの辺リストを読み込み、Gとする
+ */
+bool read_edge_list(const std::string& path, csr_graph& G, const edge_list_params& params)
+{
+    mapped_file F;
+    if (!map_file(path, F)) { return false; }
+    return parse_edge_list(F.data, F.data + F.size, G, params);
+}
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
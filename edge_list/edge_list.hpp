@@ -0,0 +1,108 @@
+/**
+ * @brief  テキストの辺リストを並列に解析し、CSR表現のグラフを構成する
+ *
+ * @note   入力はAOJの形式と同じく、1行目に頂点数nと辺数m、続くm行に辺(u, v)と重みwを空白で区切って並べたものである
+ *           n m [...]
+ *           u v [w]
+ *           ...
+ *         1行目のn, mの後ろの数(始点などの問題固有の値)は読み飛ばす. 頂点はすべて[0, n)になければならない
+ *
+ * @note   std::cin >>で1辺ずつ読む代わりに、ファイルを写像(map_file)し、本体を改行の位置でthreads個のほぼ等しい区間に分けて
+ *         各スレッドが手書きの整数解析器で解析する. その後、始点srcをキーとする並列の計数ソートでCSR表現を構成する
+ *           1. 頂点をthreads個のブロックに分け、各スレッドtが自分の区間の辺を始点のブロックbごとのバケツarcs[t][b]に振り分ける
+ *           2. スレッドbがブロックbの頂点の次数を、arcs[0][b], ..., arcs[threads-1][b]から数える
+ *           3. 頂点ごとの次数の接頭辞和をブロックごとに求め、offsetとする
+ *           4. スレッドbがarcs[0][b], ..., arcs[threads-1][b]の辺をこの順に書き込む
+ *         スレッドの区間はファイルでの順に並んでいるので、同じ始点を持つ辺の順序はファイルでの順序を保つ(csr_graph(n, E)と同じ)
+ *         辺の数をmとすると、Θ(n + m + threads^2)の仕事と記憶領域を用いる(スレッドごとに長さnの配列は持たない)
+ *
+ * @note   無向グラフとして読むときは有向辺が約2m本になるので、2mがindex_tに収まらない入力は失敗とする
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef EDGE_LIST_HPP
+#define EDGE_LIST_HPP
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "../graph/graph.hpp"
+#include "../graph/csr.hpp"
+#include <string>
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief 辺リストの読み込みの設定
+ */
+struct edge_list_params {
+    bool     directed = true;   /**< 有向グラフか？ falseならば各辺(u, v)について(v, u)も加える(自己ループは1本だけ) */
+    bool     weighted = true;   /**< 各行に重みwがあるか？ falseならば重みはすべて1とする */
+    bool     dedup    = false;  /**< 同じ頂点対の辺を、重みが最小のもの1本にまとめるか？ (各隣接リストは終点の昇順に並ぶ) */
+    unsigned threads  = 0;      /**< スレッド数(0ならばハードウェアの並列度) */
+};
+
+
+
+//****************************************
+// 関数の宣言
+//****************************************
+
+/**
+ * @brief  メモリ上の辺リスト[first, last)を解析し、Gとする
+ * @note   整数でない語があるとき、頂点が[0, n)にないとき、辺の数がmと異なるときは失敗する
+ *
+ * @param  const char*             first  辺リストの先頭
+ * @param  const char*             last   辺リストの終端
+ * @param  csr_graph&              G      構成したグラフ(失敗したときは変更しない)
+ * @param  const edge_list_params& params 読み込みの設定
+ * @return 成功したか？
+ */
+bool parse_edge_list(const char* first, const char* last, csr_graph& G, const edge_list_params& params = edge_list_params());
+
+
+
+/**
+ * @brief  ファイルpathの辺リストを読み込み、Gとする
+ * @note   ファイルは写像して読むので、ファイル全体をコピーすることはない
+ *
+ * @param  const std::string&      path   辺リストのファイル名
+ * @param  csr_graph&              G      構成したグラフ(失敗したときは変更しない)
+ * @param  const edge_list_params& params 読み込みの設定
+ * @return 成功したか？
+ */
+bool read_edge_list(const std::string& path, csr_graph& G, const edge_list_params& params = edge_list_params());
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
+
+
+
+#endif  // end of EDGE_LIST_HPP
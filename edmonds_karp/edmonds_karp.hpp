@@ -19,7 +19,11 @@
 //****************************************
 
 #include "../graph/graph.hpp"
-#include <queue>
+#include "../graph/matrix.hpp"
+#include "../graph/residual.hpp"
+#include "../graph/workspace.hpp"
+#include "../graph/stats.hpp"
+#include <algorithm>
 
 
 
@@ -40,20 +44,25 @@ GRAPH_BEGIN
  * @note  Ford-Fulkerson法において、増加可能経路を幅優先探索を用いて探索することでFORD-FULKERSONの計算時間の上界を改善できる
  *        すなわち、残余ネットワークの中でsとtを結ぶ最短路を増加可能経路として選択するのである. ただし、残余ネットワークの各辺(u, v)の距離(重み)は1である
  *        Ford-Fulkerson法をこのように実現したものをEdmonds-Karpアルゴリズム(Edmonds-Karp algorithm)と呼ぶ
+ * @note  容量cとフローfをV x Vの表に持つ版である. 記憶量はΘ(V^2)なので、辺の少ない大きなネットワークにはedmonds_karpを用いること
+ *
+ * @tparam Matrix 容量とフローの表の型(matrix_tまたはdense_matrix)
  */
-struct edmonds_karp {
+template<class Matrix = matrix_t>
+struct basic_edmonds_karp {
     indices_t pi;                 /**< 頂点vの先行点属性 */
-    stamps_t visited;             /**< すでに訪問済みか？ */
-    matrix_t c, f;                /**< 辺(u, v) ∈ Eの容量属性(u, v).cとフロー属性(u, v).f */
+    epoch_marks visited;          /**< すでに訪問済みか？(幅優先探索のたびにΟ(1)時間で消す) */
+    indices_t Q;                  /**< 幅優先探索のキューに用いる配列 */
+    Matrix c, f;                  /**< 辺(u, v) ∈ Eの容量属性(u, v).cとフロー属性(u, v).f(matrix_tまたはdense_matrix) */
     std::vector<indices_t> Gf;    /**< 残余ネットワークGf */
     index_t n;                    /**< 頂点v ∈ Vの数 */
 
-    explicit edmonds_karp(std::size_t size) :
-        pi(size), visited(size), c(size, array_t(size)), f(size, array_t(size)),
+    explicit basic_edmonds_karp(std::size_t size) :
+        pi(size), visited(size), c(make_matrix<Matrix>(size)), f(make_matrix<Matrix>(size)),
         Gf(size, indices_t()), n(size) { }
-    explicit edmonds_karp(const graph_t& G)
+    explicit basic_edmonds_karp(const graph_t& G)
     {
-        *this = edmonds_karp(G.size());
+        *this = basic_edmonds_karp(G.size());
         for (index_t i = 0; i < n; ++i) { for (auto&& e : G[i]) { add_edge(e.src, e.dst, e.c); } }
     }
 
@@ -106,25 +115,24 @@ struct edmonds_karp {
      */
     bool_t bfs(index_t s, index_t t)
     {
-        pi.assign(n, limits::nil);
-        visited.assign(n, false);
-        std::queue<index_t> Q;
+        // 訪問印はΟ(1)時間で消す. 先行点属性は訪問した頂点についてだけ読むので、初期化し直す必要はない
+        visited.clear();
 
         // 手続き開始と同時に始点sを発見したと考え、
         pi[s] = limits::nil;  // 始点の先行点をNILで初期化する
-        visited[s] = true;    // 訪問印を刻む
+        visited.insert(s);    // 訪問印を刻む
 
-        Q.push(s);  // sだけを含むようにキューを初期化する
-        while (!Q.empty()) {
-            index_t u = Q.front(); Q.pop();
+        Q.assign(1, s);  // sだけを含むようにキューを初期化する
+        for (std::size_t head = 0; head < Q.size(); ) {
+            index_t u = Q[head++];
             for (auto&& v : Gf[u]) {
                 // vが白でない、または残余容量がゼロならば、辺(u, v)を調べる必要がない
                 if (visited[v] || cf(u, v) == 0) { continue; }
 
                 // 上記の条件にいずれも当てはまらない場合、
-                visited[v] = true;  // 訪問印を刻み、
+                visited.insert(v);  // 訪問印を刻み、
                 pi[v] = u;          // uをその親v.piとして記録し、
-                Q.push(v);          // vをキューQの末尾に置く
+                Q.push_back(v);     // vをキューQの末尾に置く
             }
         }
         return visited[t];  // 最終的な結果は出口節点tを訪問するか、pが空のどちらかである
@@ -167,6 +175,160 @@ struct edmonds_karp {
 };
 
 
+using dense_edmonds_karp = basic_edmonds_karp<dense_matrix>;  /**< 容量とフローの表を1本の整列された領域(dense_matrix)で持つEdmonds-Karpのアルゴリズム */
+
+
+
+/**
+ * @brief Edmonds-Karpのアルゴリズム
+ * @note  残余ネットワークGfを対になった残余辺の配列(residual_network)で表す. 記憶量はΘ(V + E)である
+ *        増加可能経路pは、各頂点vに入るp上の残余辺の添字pi[v]で表すので、フローを増やすときにGfを探し直す必要がない
+ *        同じ頂点対の間の平行な辺は、それぞれ別の辺として容量を持つ
+ * @note  computeはGfにすでに流れているフローから増加可能経路を探す. set_capacityで容量を変更してからcomputeを呼べば、
+ *        フローを0から求め直すことなく、変更後のネットワークの最大フローが得られる(容量の小さな変更を何度も試すときに用いる)
+ *        computeの後には、最後の幅優先探索でsから到達できた頂点の集合Sが最小カット(S, T)を与える
+ */
+struct edmonds_karp {
+    residual_network Gf;  /**< 残余ネットワークGf */
+    indices_t pi;         /**< 頂点vに入る増加可能経路上の残余辺の添字 */
+    epoch_marks visited;  /**< すでに訪問済みか？(幅優先探索のたびにΟ(1)時間で消す) */
+    indices_t Q;          /**< 幅優先探索のキューに用いる配列(増加のたびに確保し直さない) */
+    index_t n;            /**< 頂点v ∈ Vの数 */
+    index_t s = limits::nil, t = limits::nil;  /**< 最後にcomputeを呼んだときの入口sと出口t */
+
+    explicit edmonds_karp(std::size_t size) : Gf(size), pi(size), visited(size), n(size) { }
+    explicit edmonds_karp(const graph_t& G) : edmonds_karp(G.size())
+    {
+        for (index_t i = 0; i < n; ++i) { for (auto&& e : G[i]) { add_edge(e.src, e.dst, e.c); } }
+    }
+
+    /**
+     * @brief  容量capの辺(u, v)を加える. 残余ネットワークGfには残余辺(u, v)と(v, u)の対が加わる
+     * @return 加えた辺の番号(flowで辺のフローを調べるときに用いる)
+     */
+    index_t add_edge(index_t u, index_t v, capacity_t cap) { return Gf.add_edge(u, v, cap); }
+
+    /**
+     * @brief  Edmonds-Karpのアルゴリズムを実行する
+     * @note   アルゴリズムの実行時間はΟ(VE^2)である
+     * @param  index_t s フローネットワークの入口(source) s
+     * @param  index_t t フローネットワークの出口(sink) t
+     * @return フローネットワークの最大フロー
+     */
+    capacity_t compute(index_t s, index_t t)
+    {
+        this->s = s; this->t = t;
+        {
+            GRAPH_STAT_PHASE("build");
+            Gf.build();
+        }
+        if (s == t) { return 0; }
+        GRAPH_STAT_PHASE("augment");
+        while (bfs(s, t)) { proc(s, t); }  // BFSでpを探し、pが存在したならば、フローを更新する
+        return Gf.value(s);
+    }
+
+    /**
+     * @brief  k番目に加えた辺の容量をcapに変更する. その後にcomputeを呼ぶと、それまでのフローから最大フローを求め直す
+     * @note   容量を減らしてフローf(u, v)が容量を超えたときは、超えた分rだけf(u, v)を減らす. uにはrの超過、vにはrの不足が生じるので、
+     *           1. 残余ネットワークでuからvへ迂回させられるだけ流し、
+     *           2. 残りをuからsへ押し戻し(フローの値が減る)、tからvへ流して不足を埋める
+     *         uに超過がある限りuからsへの残余経路が、vに不足がある限りtからvへの残余経路が存在するので、フローはふたたび実行可能になる
+     */
+    void set_capacity(index_t k, capacity_t cap)
+    {
+        capacity_t r = Gf.set_capacity(k, cap);
+        if (r == 0) { return; }
+        index_t u = Gf.E[k].src, v = Gf.E[k].dst;
+        r -= augment(u, v, r);
+        if (u != s && u != t) { augment(u, s, r); }
+        if (v != s && v != t) { augment(t, v, r); }
+    }
+
+    /**
+     * @brief  最小カット(S, T)の入口側の頂点の集合Sを返す
+     * @note   computeの直後に呼ぶこと. 最後の幅優先探索でsから到達できた頂点がSである
+     */
+    indices_t min_cut() const
+    {
+        indices_t S;
+        for (index_t v = 0; v < n; ++v) { if (visited[v]) { S.push_back(v); } }
+        return S;
+    }
+
+    /**
+     * @brief  最小カット(S, T)を横切る辺(u ∈ S, v ∈ T)の番号を返す. これらの辺の容量の和が最大フローの値に等しい
+     * @note   computeの直後に呼ぶこと
+     */
+    indices_t cut_edges() const
+    {
+        indices_t C;
+        for (index_t k = 0; k < Gf.edge_count(); ++k) {
+            if (visited[Gf.E[k].src] && !visited[Gf.E[k].dst]) { C.push_back(k); }
+        }
+        return C;
+    }
+
+    /**
+     * @brief  幅優先探索を用いて残余ネットワークGfにsからtへの道(増加可能経路(augment path))pを探索する
+     * @return 増加可能経路pが存在するか否か
+     */
+    bool_t bfs(index_t s, index_t t)
+    {
+        visited.clear();
+        visited.insert(s);
+        Q.assign(1, s);
+        for (std::size_t head = 0; head < Q.size() && !visited[t]; ) {
+            index_t u = Q[head++];
+            for (index_t a = Gf.offset[u]; a < Gf.offset[u + 1]; ++a) {
+                index_t v = Gf.dst[a];
+                if (visited[v] || Gf.cf[a] == 0) { continue; }  // vが訪問済み、または残余容量がゼロならば、残余辺aを調べる必要がない
+                visited.insert(v);
+                pi[v] = a;      // vに入る残余辺aを記録し、
+                Q.push_back(v); // vをキューQの末尾に置く
+            }
+        }
+        return visited[t];
+    }
+
+    /**
+     * @brief  増加可能経路pに沿ってフローfを残余容量cf(p)だけ増やす(ただしlimitを超えない)
+     * @return capacity_t cf_p
+     */
+    capacity_t proc(index_t s, index_t t, capacity_t limit = limits::inf)
+    {
+        capacity_t cf_p = limit;
+        for (index_t v = t; v != s; v = Gf.dst[Gf.rev[pi[v]]]) { cf_p = std::min(cf_p, Gf.cf[pi[v]]); }
+        for (index_t v = t; v != s; v = Gf.dst[Gf.rev[pi[v]]]) { Gf.push(pi[v], cf_p); }  // 前方辺のフローを加え、後方辺のフローを引く
+        GRAPH_STAT_AUGMENT(path_length(s, t));
+        return cf_p;
+    }
+
+    /**< @brief 最後に見つけたsからtへの増加可能経路pの辺の数を返す(統計に用いる) */
+    index_t path_length(index_t s, index_t t) const
+    {
+        index_t k = 0;
+        for (index_t v = t; v != s; v = Gf.dst[Gf.rev[pi[v]]]) { ++k; }
+        return k;
+    }
+
+    /**
+     * @brief  uからvへ増加可能経路に沿って高々limitだけフローを流す
+     * @return 流したフローの量
+     */
+    capacity_t augment(index_t u, index_t v, capacity_t limit)
+    {
+        capacity_t x = 0;
+        if (u == v) { return 0; }
+        while (x < limit && bfs(u, v)) { x += proc(u, v, limit - x); }
+        return x;
+    }
+
+    /**< @brief k番目に加えた辺のフローを返す */
+    capacity_t flow(index_t k) const { return Gf.flow(k); }
+};
+
+
 
 //****************************************
 // 名前空間の終端
@@ -36,7 +36,13 @@
 //****************************************
 
 #include "floyd_warshall.hpp"
+#include "../graph/parallel.hpp"
+#include "../graph/matrix.hpp"
 #include <iostream>
+#include <algorithm>
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
 
 
 
@@ -88,11 +94,13 @@ GRAPH_BEGIN
  *         このコードはタイトであって、複雑なデータ構造を含まず、Θ-記法に隠された定数は小さい
  *         したがって、Floyd-Warshallアルゴリズムは結構大きな入力グラフに対しても非常に実用的である
  *
+ * @tparam Matrix 重み行列の表現(matrix_tまたはdense_matrix)
  */
-matrix_t floyd_warshall(const matrix_t& W)
+template<class Matrix>
+static Matrix floyd_warshall_impl(const Matrix& W)
 {
     index_t n = W.size();  // n = W.rows
-    matrix_t D(n, array_t(n, limits::inf));
+    Matrix D = make_matrix<Matrix>(n, limits::inf);
 
     for (index_t i = 0; i < n; ++i) {
         std::copy(W[i].begin(), W[i].end(), D[i].begin());
@@ -113,6 +121,313 @@ matrix_t floyd_warshall(const matrix_t& W)
 }
 
 
+/**< @brief 隣接行列Wに対してFloyd-Warshallアルゴリズムを実行する */
+matrix_t floyd_warshall(const matrix_t& W)
+{
+    return floyd_warshall_impl(W);
+}
+
+
+/**< @brief 密な行列Wに対してFloyd-Warshallアルゴリズムを実行する */
+dense_matrix floyd_warshall(const dense_matrix& W)
+{
+    return floyd_warshall_impl(W);
+}
+
+
+namespace {
+
+    /**
+     * @brief  c[j] = min(c[j], a + b[j]) (j = 0, 1, ..., len - 1)を計算する. ただし、b[j] = ∞のときはc[j]を変えない
+     * @note   aは∞でないとする. c == bであってもよい(対角タイルの第kb行ではdkk = 0なので値は変わらない)
+     */
+    inline void minplus_row(weight_t* c, const weight_t* b, weight_t a, std::size_t len)
+    {
+        std::size_t j = 0;
+#if defined(__AVX512F__)
+        const __m512i va = _mm512_set1_epi32(a), vinf = _mm512_set1_epi32(limits::inf);
+        for (; j + 16 <= len; j += 16) {
+            __m512i vb = _mm512_loadu_si512(b + j), vc = _mm512_loadu_si512(c + j);
+            __mmask16 finite = _mm512_cmpneq_epi32_mask(vb, vinf);
+            vc = _mm512_mask_min_epi32(vc, finite, vc, _mm512_add_epi32(va, vb));
+            _mm512_storeu_si512(c + j, vc);
+        }
+#elif defined(__AVX2__)
+        const __m256i va = _mm256_set1_epi32(a), vinf = _mm256_set1_epi32(limits::inf);
+        for (; j + 8 <= len; j += 8) {
+            __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + j));
+            __m256i vc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c + j));
+            __m256i vs = _mm256_min_epi32(vc, _mm256_add_epi32(va, vb));
+            vc = _mm256_blendv_epi8(vs, vc, _mm256_cmpeq_epi32(vb, vinf));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(c + j), vc);
+        }
+#endif
+        for (; j < len; ++j) {  // 分岐のない形なので、SIMD命令セットを指定しなくても-O3などでコンパイラが自動でベクトル化できる
+            weight_t s = std::min(c[j], a + b[j]);
+            c[j] = b[j] == limits::inf ? c[j] : s;
+        }
+    }
+
+
+    /**
+     * @brief  行優先で幅strideの配列Dのタイル(ib, jb)を、中間頂点k ∈ [kb, kb + b)について更新する
+     * @note   kを最も外側のループにしているので、タイル(ib, jb)がタイル(ib, kb)や(kb, jb)と同じであっても正しい
+     */
+    inline void update_tile(weight_t* D, std::size_t stride, std::size_t ib, std::size_t jb, std::size_t kb, std::size_t b)
+    {
+        for (std::size_t k = kb; k < kb + b; ++k) {
+            const weight_t* dk = D + k * stride + jb;
+            for (std::size_t i = ib; i < ib + b; ++i) {
+                weight_t dik = D[i * stride + k];
+                if (dik == limits::inf) { continue; }
+                minplus_row(D + i * stride + jb, dk, dik, b);
+            }
+        }
+    }
+
+}
+
+
+/**
+ * @brief  行優先で幅strideの配列Dの左上のn x n(nはbの倍数)に対して、ブロック化したFloyd-Warshallアルゴリズムをthreads本のスレッドで実行する
+ * @note   第2段階と第3段階のタイルは、通し番号をスレッド数で割った余りでスレッドに割り当てる. 各段階の後で待ち合わせる
+ */
+static void floyd_warshall_tiled(weight_t* D, std::size_t n, std::size_t stride, std::size_t b, unsigned threads)
+{
+    const std::size_t nb = n / b;
+    barrier sync(threads);
+
+    parallel_run(threads, [&](unsigned tid) {
+        for (std::size_t kb = 0; kb < nb; ++kb) {
+            const std::size_t k0 = kb * b;
+            // 第1段階 : 対角タイル
+            if (tid == 0) { update_tile(D, stride, k0, k0, k0, b); }
+            sync.arrive_and_wait();
+
+            // 第2段階 : 第kb行と第kb列のタイル
+            for (std::size_t t = tid; t < 2 * nb; t += threads) {
+                std::size_t x = t % nb;
+                if (x == kb) { continue; }
+                if (t < nb) { update_tile(D, stride, k0, x * b, k0, b); }
+                else        { update_tile(D, stride, x * b, k0, k0, b); }
+            }
+            sync.arrive_and_wait();
+
+            // 第3段階 : 残りのタイル
+            for (std::size_t t = tid; t < nb * nb; t += threads) {
+                std::size_t ib = t / nb, jb = t % nb;
+                if (ib == kb || jb == kb) { continue; }
+                update_tile(D, stride, ib * b, jb * b, k0, b);
+            }
+            sync.arrive_and_wait();
+        }
+    });
+}
+
+
+/**
+ * @brief  ブロック化し、threads本のスレッドで並列化したFloyd-Warshallアルゴリズム
+ * @note   行列の大きさをタイルの一辺bの倍数に切り上げた作業用のdense_matrixに写して計算する
+ *         追加した頂点はどの頂点とも辺で結ばれないので、結果に影響しない
+ */
+template<class Matrix>
+static Matrix floyd_warshall_blocked_impl(const Matrix& W, unsigned threads, std::size_t block)
+{
+    const std::size_t n = W.size(), b = std::max<std::size_t>(block, 1);
+    const std::size_t np = (n + b - 1) / b * b;
+    dense_matrix D(np, np, limits::inf);
+
+    for (std::size_t i = 0; i < n; ++i) { std::copy(W[i].begin(), W[i].begin() + n, D[i].begin()); }
+    for (std::size_t i = 0; i < np; ++i) { D[i][i] = 0; }
+
+    floyd_warshall_tiled(D.data(), np, D.stride(), b, resolve_threads(threads));
+
+    Matrix R = make_matrix<Matrix>(n);
+    for (std::size_t i = 0; i < n; ++i) { std::copy(D[i].begin(), D[i].begin() + n, R[i].begin()); }
+    return R;
+}
+
+
+/**< @brief 隣接行列Wに対して、ブロック化し並列化したFloyd-Warshallアルゴリズムを実行する */
+matrix_t floyd_warshall_blocked(const matrix_t& W, unsigned threads, std::size_t block)
+{
+    return floyd_warshall_blocked_impl(W, threads, block);
+}
+
+
+/**< @brief 密な行列Wに対して、ブロック化し並列化したFloyd-Warshallアルゴリズムを実行する */
+dense_matrix floyd_warshall_blocked(const dense_matrix& W, unsigned threads, std::size_t block)
+{
+    return floyd_warshall_blocked_impl(W, threads, block);
+}
+
+
+
+/**
+ * @brief  Floyd-Warshallアルゴリズムで、最短路重みの行列Dとともに次の頂点の行列Nを求める
+ * @note   nikは第k段の中のjのループで変わらないので(dik + dkk = dikはdikより小さくない)、ループの外で読む
+ */
+template<class Matrix>
+static Matrix floyd_warshall_impl(const Matrix& W, next_hop_matrix& N)
+{
+    index_t n = W.size();
+    Matrix D = make_matrix<Matrix>(n, limits::inf);
+    N = next_hop_matrix(n);
+
+    for (index_t i = 0; i < n; ++i) {
+        std::copy(W[i].begin(), W[i].end(), D[i].begin());
+        D[i][i] = 0;
+        for (index_t j = 0; j < n; ++j) { if (i != j && W[i][j] != limits::inf) { N.set(i, j, j); } }
+    }
+
+    for (index_t k = 0; k < n; ++k) {
+        for (index_t i = 0; i < n; ++i) {
+            weight_t dik = D[i][k];
+            if (dik == limits::inf) { continue; }
+            index_t hop = N.get(i, k);
+            for (index_t j = 0; j < n; ++j) {
+                if (D[k][j] != limits::inf && dik + D[k][j] < D[i][j]) {
+                    D[i][j] = dik + D[k][j];
+                    N.set(i, j, hop);
+                }
+            }
+        }
+    }
+    return D;
+}
+
+
+/**< @brief 隣接行列Wに対して、次の頂点の行列Nとともに最短路重みを求める */
+matrix_t floyd_warshall(const matrix_t& W, next_hop_matrix& N)
+{
+    return floyd_warshall_impl(W, N);
+}
+
+
+/**< @brief 密な行列Wに対して、次の頂点の行列Nとともに最短路重みを求める */
+dense_matrix floyd_warshall(const dense_matrix& W, next_hop_matrix& N)
+{
+    return floyd_warshall_impl(W, N);
+}
+
+
+/**
+ * @brief  重み行列Wと最短路重みの行列Dから、次の頂点の行列Nを求める
+ * @note   辺の重みが正なので、nij = kならばdkj < dijであり、Nを辿ると距離が狭義に減ってjに着く
+ */
+template<class Matrix>
+static next_hop_matrix next_hops_impl(const Matrix& W, const Matrix& D)
+{
+    index_t n = W.size();
+    next_hop_matrix N(n);
+    indices_t adj;
+
+    for (index_t i = 0; i < n; ++i) {
+        adj.clear();
+        for (index_t k = 0; k < n; ++k) { if (k != i && W[i][k] != limits::inf) { adj.push_back(k); } }
+        for (index_t j = 0; j < n; ++j) {
+            if (j == i || D[i][j] == limits::inf) { continue; }
+            for (auto&& k : adj) {
+                if (D[k][j] != limits::inf && W[i][k] + D[k][j] == D[i][j]) { N.set(i, j, k); break; }
+            }
+        }
+    }
+    return N;
+}
+
+
+/**< @brief 隣接行列Wと最短路重みの行列Dから、次の頂点の行列Nを求める */
+next_hop_matrix next_hops(const matrix_t& W, const matrix_t& D)
+{
+    return next_hops_impl(W, D);
+}
+
+
+/**< @brief 密な行列Wと最短路重みの行列Dから、次の頂点の行列Nを求める */
+next_hop_matrix next_hops(const dense_matrix& W, const dense_matrix& D)
+{
+    return next_hops_impl(W, D);
+}
+
+
+/**
+ * @brief  辺(u, v)の重みをwに減らしたときに、最短路重みの行列Dを更新する
+ * @note   第v行を各行に足し込むので、第v行そのものの更新(i = v)ではdvu + w >= 0より値は変わらない
+ */
+template<class Matrix>
+static bool floyd_warshall_decrease_impl(Matrix& D, index_t u, index_t v, weight_t w)
+{
+    if (D[v][u] != limits::inf && w + D[v][u] < 0) { return false; }
+    if (w >= D[u][v]) { return true; }
+
+    const std::size_t n = D.size();
+    const weight_t* dv = D[v].data();
+    for (std::size_t i = 0; i < n; ++i) {
+        weight_t diu = D[i][u];
+        if (diu == limits::inf) { continue; }
+        minplus_row(D[i].data(), dv, diu + w, n);
+    }
+    return true;
+}
+
+
+/**< @brief 辺(u, v)の重みをwに減らしたときに、最短路重みの行列Dを更新する */
+bool floyd_warshall_decrease(matrix_t& D, index_t u, index_t v, weight_t w)
+{
+    return floyd_warshall_decrease_impl(D, u, v, w);
+}
+
+
+/**< @brief 辺(u, v)の重みをwに減らしたときに、密な最短路重みの行列Dを更新する */
+bool floyd_warshall_decrease(dense_matrix& D, index_t u, index_t v, weight_t w)
+{
+    return floyd_warshall_decrease_impl(D, u, v, w);
+}
+
+
+/**
+ * @brief  辺(u, v)の重みをwに減らしたときに、最短路重みの行列Dと次の頂点の行列Nを更新する
+ * @note   dijが減る要素だけNを書き換えるので、行の更新は分岐を含む
+ */
+template<class Matrix>
+static bool floyd_warshall_decrease_impl(Matrix& D, next_hop_matrix& N, index_t u, index_t v, weight_t w)
+{
+    if (D[v][u] != limits::inf && w + D[v][u] < 0) { return false; }
+    if (w >= D[u][v]) { return true; }
+
+    const std::size_t n = D.size();
+    const weight_t* dv = D[v].data();
+    for (std::size_t i = 0; i < n; ++i) {
+        weight_t diu = D[i][u];
+        if (diu == limits::inf) { continue; }
+        weight_t a   = diu + w;
+        index_t  hop = i == static_cast<std::size_t>(u) ? v : N.get(i, u);
+        weight_t* di = D[i].data();
+        for (std::size_t j = 0; j < n; ++j) {
+            if (dv[j] != limits::inf && a + dv[j] < di[j]) {
+                di[j] = a + dv[j];
+                N.set(i, j, hop);
+            }
+        }
+    }
+    return true;
+}
+
+
+/**< @brief 辺(u, v)の重みをwに減らしたときに、最短路重みの行列Dと次の頂点の行列Nを更新する */
+bool floyd_warshall_decrease(matrix_t& D, next_hop_matrix& N, index_t u, index_t v, weight_t w)
+{
+    return floyd_warshall_decrease_impl(D, N, u, v, w);
+}
+
+
+/**< @brief 辺(u, v)の重みをwに減らしたときに、密な最短路重みの行列Dと次の頂点の行列Nを更新する */
+bool floyd_warshall_decrease(dense_matrix& D, next_hop_matrix& N, index_t u, index_t v, weight_t w)
+{
+    return floyd_warshall_decrease_impl(D, N, u, v, w);
+}
+
+
 
 //****************************************
 // 名前空間の終端
@@ -45,6 +45,11 @@
 //****************************************
 
 #include "../graph/graph.hpp"
+#include "../graph/matrix.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
 
 
 
@@ -56,6 +61,77 @@ GRAPH_BEGIN
 
 
 
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief  全点対最短路の次の頂点を格納する行列(next-hop matrix) N = (nij)
+ *
+ * @note   nijは、i = jまたはiからjへの道がなければNILであり、それ以外の場合には、iからjへのある最短路上でiの次に訪れる頂点である
+ *         先行点行列Πがjの側から最短路を辿るのに対して、Nはiの側から辿るので、経路を前から順に1要素ずつ取り出せる
+ *
+ * @note   要素の幅は頂点数nに合わせて、n < 2^8 - 1ならば1バイト、n < 2^16 - 1ならば2バイト、それ以外では4バイトとする(全ビットが1の値をNILとする)
+ *         例えば5000頂点ではn^2個の2バイトの要素(約50MB)であり、index_tで格納する場合の半分の大きさで済む
+ */
+struct next_hop_matrix {
+    std::size_t               n     = 0;  /**< 頂点数 */
+    unsigned                  width = 1;  /**< 要素の幅[byte] */
+    std::vector<std::uint8_t> buf;        /**< 行優先で並べた要素 */
+
+
+    next_hop_matrix() = default;
+
+    /**< @brief n x nの、すべての要素がNILの行列を生成する */
+    explicit next_hop_matrix(std::size_t n)
+        : n(n), width(n < 0xff ? 1 : n < 0xffff ? 2 : 4), buf(n * n * width, 0xff)
+    {
+    }
+
+    /**< @brief 頂点数nを返す */
+    std::size_t size() const { return n; }
+
+    /**< @brief 要素nijを返す */
+    index_t get(std::size_t i, std::size_t j) const
+    {
+        const std::uint8_t* p = buf.data() + (i * n + j) * width;
+        switch (width) {
+        case 1:  return *p == 0xff ? limits::nil : static_cast<index_t>(*p);
+        case 2:  { std::uint16_t x; std::memcpy(&x, p, 2); return x == 0xffff ? limits::nil : static_cast<index_t>(x); }
+        default: { std::uint32_t x; std::memcpy(&x, p, 4); return x == 0xffffffff ? limits::nil : static_cast<index_t>(x); }
+        }
+    }
+
+    /**< @brief 要素nijをvにする(vはNILでもよい) */
+    void set(std::size_t i, std::size_t j, index_t v)
+    {
+        std::uint8_t* p = buf.data() + (i * n + j) * width;
+        std::uint32_t x = v == limits::nil ? 0xffffffff : static_cast<std::uint32_t>(v);
+        switch (width) {
+        case 1:  *p = static_cast<std::uint8_t>(x); break;
+        case 2:  { std::uint16_t y = static_cast<std::uint16_t>(x); std::memcpy(p, &y, 2); break; }
+        default: std::memcpy(p, &x, 4); break;
+        }
+    }
+
+    /**
+     * @brief  頂点iからjへの最短路<i, ..., j>を返す
+     * @note   i = jならば<i>を、iからjへの道がなければ空の列を返す
+     */
+    indices_t path(index_t i, index_t j) const
+    {
+        indices_t p;
+        if (i != j && get(i, j) == limits::nil) { return p; }
+        for (p.push_back(i); i != j; p.push_back(i)) { i = get(i, j); }
+        return p;
+    }
+
+    /**< @brief 行列が占めるメモリの大きさ[byte]を返す */
+    std::size_t memory_bytes() const { return buf.size(); }
+};
+
+
+
 //****************************************
 // 関数の宣言
 //****************************************
@@ -101,6 +177,98 @@ matrix_t floyd_warshall(const matrix_t& W);
 
 
 
+/**
+ * @brief  1本の整列された領域に格納した密な行列Wに対してFloyd-Warshallアルゴリズムを実行する
+ * @note   結果はmatrix_tに対するfloyd_warshallと同じである
+ */
+dense_matrix floyd_warshall(const dense_matrix& W);
+
+
+
+/**
+ * @brief  ブロック化(タイル化)し、threads本のスレッドで並列化したFloyd-Warshallアルゴリズム
+ *
+ * @note   Dを1本の連続した行優先(row-major)の配列(dense_matrix)に写し、b x bのタイルに分割する. 各k段(タイルの添字kb)について、
+ *           第1段階 : 対角タイル(kb, kb)をそれ自身で更新する
+ *           第2段階 : 第kb行のタイル(kb, j)と第kb列のタイル(i, kb)を、対角タイルを用いて更新する
+ *           第3段階 : 残りのタイル(i, j)を、タイル(i, kb)と(kb, j)を用いて更新する
+ *         の順に処理する. 各段階の中のタイルは互いに独立なので、スレッドで分担する. 1つのタイルの更新に必要な3つのタイルがキャッシュに収まるため、
+ *         三重ループのようにkごとに行列全体を読み書きすることがない
+ *
+ * @note   最も内側のループは dij = min(dij, dik + dkj) を連続したj方向に計算する. dik = ∞の行はループの外で飛ばし、dkj = ∞の判定は
+ *         選択(blend)にするので分岐がなく、AVX2またはAVX-512が使えるときは8個または16個ずつまとめて計算する
+ *
+ * @note   結果はfloyd_warshallと一致する. 実行時間はΘ(n^3)のままである
+ *
+ * @param  const matrix_t& W  n x nの重み行列W
+ * @param  unsigned threads   スレッド数(0ならばハードウェアの並列度)
+ * @param  std::size_t block  タイルの一辺の長さb
+ * @return 最短路重みの行列D
+ */
+matrix_t floyd_warshall_blocked(const matrix_t& W, unsigned threads = 0, std::size_t block = 64);
+dense_matrix floyd_warshall_blocked(const dense_matrix& W, unsigned threads = 0, std::size_t block = 64);
+
+
+
+/**
+ * @brief  Floyd-Warshallアルゴリズムで、最短路重みの行列Dとともに次の頂点の行列Nを求める
+ *
+ * @note   nijの初期値は、(i, j) ∈ Eならばj、そうでなければNILである. dik + dkj < dijとなってdijを更新するとき、
+ *         iからjへの最短路はiからkへの最短路を前半に含むので、nij = nikとする. 実行時間はΘ(n^3)のままである
+ *
+ * @param  const matrix_t& W   n x nの重み行列W
+ * @param  next_hop_matrix& N  次の頂点の行列(n x nに作り直す)
+ * @return 最短路重みの行列D
+ */
+matrix_t floyd_warshall(const matrix_t& W, next_hop_matrix& N);
+dense_matrix floyd_warshall(const dense_matrix& W, next_hop_matrix& N);
+
+
+
+/**
+ * @brief  重み行列Wと最短路重みの行列Dから、次の頂点の行列Nを求める
+ *
+ * @note   floyd_warshall_blockedのように距離だけを求めた後で経路が必要になった場合に用いる
+ *         各i != jについて、wik + dkj = dijとなるiの隣接頂点kをnijとする. iの隣接頂点を先に集めるので、実行時間はΘ(n^2 + n|E|)である
+ *
+ * @note   i != jであるすべての辺の重みが正であること. 重み0の辺があると、同じ重みの経路の間で次の頂点が互いを指して、経路が閉じないことがある
+ *         (その場合はfloyd_warshall(W, N)を用いる)
+ */
+next_hop_matrix next_hops(const matrix_t& W, const matrix_t& D);
+next_hop_matrix next_hops(const dense_matrix& W, const dense_matrix& D);
+
+
+
+/**
+ * @brief  辺(u, v)の重みをwに減らした(または辺(u, v)を重みwで加えた)ときに、最短路重みの行列Dを更新する
+ *
+ * @note   辺の重みが減っても、新しい最短路が通るのは辺(u, v)だけであり、それは高々1回である. したがって、更新後の最短路重みは
+ *           dij' = min(dij, diu + w + dvj)
+ *         である. 負閉路がなければ、diuとdvjは(u, v)を通っても小さくならないので、Dをその場で書き換えてよい
+ *         diu = ∞の行は飛ばし、残りの行はfloyd_warshall_blockedと同じ、分岐のない(ベクトル化した)行の更新を行う. 実行時間はΘ(n^2)である
+ *
+ * @note   wが既存のduv以上ならば、Dは変わらない. 辺の削除と重みの増加は扱わない(それらには全体の再計算が必要である)
+ *
+ * @param  D  floyd_warshallが返した最短路重みの行列(その場で更新する)
+ * @param  u  辺の始点
+ * @param  v  辺の終点
+ * @param  w  辺の新しい重み
+ * @return 新しい辺が負閉路を作る(w + dvu < 0)ならばfalse(このときDは変えない)
+ */
+bool floyd_warshall_decrease(matrix_t& D, index_t u, index_t v, weight_t w);
+bool floyd_warshall_decrease(dense_matrix& D, index_t u, index_t v, weight_t w);
+
+
+
+/**
+ * @brief  辺(u, v)の重みをwに減らしたときに、最短路重みの行列Dと次の頂点の行列Nを更新する
+ * @note   dijが減ったiからjへの新しい最短路はi~>u->v~>jであるから、nijをi = uならばv、そうでなければniuとする
+ */
+bool floyd_warshall_decrease(matrix_t& D, next_hop_matrix& N, index_t u, index_t v, weight_t w);
+bool floyd_warshall_decrease(dense_matrix& D, next_hop_matrix& N, index_t u, index_t v, weight_t w);
+
+
+
 //****************************************
 // 名前空間の終端
 //****************************************
@@ -43,6 +43,10 @@
 //****************************************
 
 #include "../graph/graph.hpp"
+#include "../graph/matrix.hpp"
+#include "../graph/residual.hpp"
+#include "../graph/stats.hpp"
+#include <algorithm>
 
 
 
@@ -80,19 +84,24 @@ GRAPH_BEGIN
  *
  *          第1~3行目でフローfを0に初期化する. 第4~8行のwhile文ではGf上の増加可能経路pを見つけ、pに沿ってフローfを残余容量cf(p)だけ増やす操作を繰り返す
  *          道p上の各残余辺は元のネットワークの辺か、その逆向き辺である. 第6~8行では適切にフローを更新する. 増加可能経路がなければ、フローfは最大フローである
+ *
+ * @note    容量cとフローfをV x Vの表に持つ版である. 記憶量はΘ(V^2)なので、辺の少ない大きなネットワークにはford_fulkersonを用いること
+ *
+ * @tparam Matrix 容量とフローの表の型(matrix_tまたはdense_matrix)
  */
-struct ford_fulkerson {
+template<class Matrix = matrix_t>
+struct basic_ford_fulkerson {
     stamps_t visited;             /**< すでに訪問済みか？ */
-    matrix_t c, f;                /**< 辺(u, v) ∈ Eの容量属性(u, v).cとフロー属性(u, v).f */
+    Matrix c, f;                  /**< 辺(u, v) ∈ Eの容量属性(u, v).cとフロー属性(u, v).f(matrix_tまたはdense_matrix) */
     std::vector<indices_t> Gf;    /**< 残余ネットワークGf */
     index_t n;                    /**< 頂点v ∈ Vの数 */
     capacity_t augment;           /**< フローの増加数 */
 
-    explicit ford_fulkerson(std::size_t size) : c(size, array_t(size)), f(size, array_t(size)),
+    explicit basic_ford_fulkerson(std::size_t size) : c(make_matrix<Matrix>(size)), f(make_matrix<Matrix>(size)),
                                    Gf(size, indices_t()), n(size), augment(0) {}
-    explicit ford_fulkerson(const graph_t& G)
+    explicit basic_ford_fulkerson(const graph_t& G)
     {
-        *this = ford_fulkerson(G.size());
+        *this = basic_ford_fulkerson(G.size());
         for (index_t i = 0; i < n; ++i) {
             for (auto&& e : G[i]) { add_edge(e.src, e.dst, e.c); }
         }
@@ -190,6 +199,96 @@ struct ford_fulkerson {
 };
 
 
+using dense_ford_fulkerson = basic_ford_fulkerson<dense_matrix>;  /**< 容量とフローの表を1本の整列された領域(dense_matrix)で持つFord-Fulkersonのアルゴリズム */
+
+
+
+/**
+ * @brief 基本Ford-Fullkersonアルゴリズム
+ * @note  残余ネットワークGfを対になった残余辺の配列(residual_network)で表す. 記憶量はΘ(V + E)である
+ *        同じ頂点対の間の平行な辺は、それぞれ別の辺として容量を持つ
+ */
+struct ford_fulkerson {
+    residual_network Gf;  /**< 残余ネットワークGf */
+    stamps_t visited;     /**< すでに訪問済みか？ */
+    index_t n;            /**< 頂点v ∈ Vの数 */
+    capacity_t augment;   /**< フローの増加数 */
+
+    explicit ford_fulkerson(std::size_t size) : Gf(size), n(size), augment(0) {}
+    explicit ford_fulkerson(const graph_t& G) : ford_fulkerson(G.size())
+    {
+        for (index_t i = 0; i < n; ++i) {
+            for (auto&& e : G[i]) { add_edge(e.src, e.dst, e.c); }
+        }
+    }
+
+    /**
+     * @brief  容量capの辺(u, v)を加える. 残余ネットワークGfには残余辺(u, v)と(v, u)の対が加わる
+     * @return 加えた辺の番号(flowで辺のフローを調べるときに用いる)
+     */
+    index_t add_edge(index_t u, index_t v, capacity_t cap) { return Gf.add_edge(u, v, cap); }
+
+    /**
+     * @brief  Ford-Fulkersonのアルゴリズムを実行する
+     * @note   アルゴリズムの実行時間はΟ(E|f*|)である
+     * @param  フローネットワークの入口(source) s
+     * @param  フローネットワークの出口(sink)   t
+     * @return フローネットワークの最大フロー
+     */
+    capacity_t compute(index_t s, index_t t)
+    {
+        capacity_t flow = 0;
+        {
+            GRAPH_STAT_PHASE("build");
+            Gf.build();
+        }
+        GRAPH_STAT_PHASE("augment");
+        while (dfs(s, t)) { flow += augment; }
+        return flow;
+    }
+
+    /**
+     * @brief  深さ優先探索を用いて残余ネットワークGfにsからtへの増加可能経路pを探索し、pに沿ってフローfを残余容量cf(p)だけ増やす
+     * @param  index_t u 残余ネットワークGfの頂点u
+     * @param  index_t t フローネットワークの出口(sink) t
+     * @param  capacity_t flow 入口sから現在探索している頂点uまで道qの残余容量cf(q)
+     * @param  index_t depth  道qの辺の数
+     * @return capacity_t cf_p
+     */
+    capacity_t dfs_visit(index_t u, index_t t, capacity_t flow, index_t depth = 0)
+    {
+        visited[u] = true;
+        if (u == t) { GRAPH_STAT_AUGMENT(depth); return flow; }  // 探索は残余容量が正の辺だけを辿るので、tに着けばフローを増やせる
+
+        for (index_t a = Gf.offset[u]; a < Gf.offset[u + 1]; ++a) {
+            index_t v = Gf.dst[a];
+            if (visited[v] || Gf.cf[a] == 0) { continue; }
+
+            capacity_t cf_p = dfs_visit(v, t, std::min(flow, Gf.cf[a]), depth + 1);
+            if (cf_p > 0) {
+                Gf.push(a, cf_p);  // 残余辺aのフローを加え、その逆向きの残余辺のフローを引く
+                return cf_p;
+            }
+        }
+        return 0;
+    }
+
+    /**
+     * @brief  深さ優先探索を用いて残余ネットワークGfにsからtへの増加可能経路pを探索し、pに沿ってフローfを増やす
+     * @return bool_t  増加可能経路pが存在するか？
+     */
+    bool_t dfs(index_t u, index_t t)
+    {
+        visited.assign(n, false);
+        augment = dfs_visit(u, t, limits::inf);
+        return augment > 0;
+    }
+
+    /**< @brief k番目に加えた辺のフローを返す */
+    capacity_t flow(index_t k) const { return Gf.flow(k); }
+};
+
+
 
 //****************************************
 // 名前空間の終端
@@ -0,0 +1,136 @@
+/**
+ * @brief  グラフの構築、問い合わせ、破棄を繰り返すときに、確保したメモリを一度に解放する単調なアリーナ
+ *
+ * @note   小さな部分グラフを数千個作っては捨てるような処理では、隣接リストや配列ごとのnew/deleteが無視できない
+ *         arenaは確保要求をポインタを進めるだけで処理し(std::pmr::monotonic_buffer_resource)、個々の解放では何もしない
+ *         1サイクルが終わったらrelease()ですべてを一度に解放する
+ *
+ * @note   最初のブロックはアリーナが所有し、release()の後も使い回す. 1サイクルでその大きさを超えて確保したときは、
+ *         release()で最初のブロックをそのサイクルの使用量まで大きくするので、同じ規模のサイクルでは上流のnewは呼ばれなくなる
+ *
+ * @note   使い方
+ *           graph::arena A;
+ *           for (...) {
+ *               graph::pmr::edges_t E(&A);                  // 辺集合をアリーナから確保する
+ *               ...
+ *               graph::csr_graph G(n, E, &A);               // CSR表現の配列もアリーナから確保する
+ *               ...                                         // 問い合わせ
+ *               A.release();                                // GとEを破棄した後、すべてを一度に解放する
+ *           }
+ *         アリーナから確保したコンテナは、release()の前に破棄しておくこと
+ *         (破棄しなくても解放は起きるが、release()の後にそのコンテナに触れてはならない)
+ *         アリーナはスレッド安全ではないので、スレッドごとに1つ用意すること
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "graph.hpp"
+#include <cstddef>
+#include <algorithm>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// クラスの定義
+//****************************************
+
+/**
+ * @brief 単調なアリーナ(monotonic arena). std::pmr::memory_resourceとしてコンテナに渡す
+ */
+class arena : public std::pmr::memory_resource {
+public:
+    /**
+     * @param std::size_t                initial  最初のブロックの大きさ[byte]
+     * @param std::pmr::memory_resource* upstream 最初のブロックを使い切ったときに次のブロックを確保する資源
+     */
+    explicit arena(std::size_t initial = 1 << 16, std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+        : upstream(upstream)
+    {
+        allocate_block(initial);
+    }
+
+    arena(const arena&) = delete;
+    arena& operator = (const arena&) = delete;
+
+    /**< @brief 最後のrelease()から確保した大きさ[byte]の合計を返す */
+    std::size_t used() const { return bytes; }
+
+    /**< @brief 最初のブロックの大きさ[byte]を返す */
+    std::size_t capacity() const { return size; }
+
+    /**
+     * @brief  アリーナから確保したメモリをすべて一度に解放する
+     * @note   このサイクルの使用量が最初のブロックを超えていたら、最初のブロックをその大きさで確保し直す
+     */
+    void release()
+    {
+        if (bytes > size) { pool.reset(); allocate_block(bytes + bytes / 4); }
+        else              { pool->release(); }
+        bytes = 0;
+    }
+
+protected:
+    void* do_allocate(std::size_t n, std::size_t alignment) override
+    {
+        bytes += n;
+        return pool->allocate(n, alignment);
+    }
+
+    void do_deallocate(void*, std::size_t, std::size_t) override {}  // 個々の解放では何もしない
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+private:
+    /**< @brief 最初のブロックを大きさnで確保し、空のアリーナとする */
+    void allocate_block(std::size_t n)
+    {
+        n = std::max<std::size_t>(n, sizeof(std::max_align_t));
+        block.reset(new std::max_align_t[(n + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t)]);
+        size = n;
+        pool.emplace(block.get(), size, upstream);
+    }
+
+    std::pmr::memory_resource*                         upstream;   /**< 上流の資源 */
+    std::unique_ptr<std::max_align_t[]>                block;      /**< 最初のブロック */
+    std::size_t                                        size  = 0;  /**< 最初のブロックの大きさ[byte] */
+    std::size_t                                        bytes = 0;  /**< 最後のrelease()から確保した大きさ[byte]の合計 */
+    std::optional<std::pmr::monotonic_buffer_resource> pool;       /**< 最初のブロックに続けて確保する資源 */
+};
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
+
+
+
+#endif  // end of ARENA_HPP
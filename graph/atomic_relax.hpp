@@ -0,0 +1,77 @@
+/**
+ * @brief  複数のスレッドから同時に行う辺の緩和(relax)を扱う
+ *
+ * @note   並列版の単一始点最短路アルゴリズムでは、同じ頂点vに入る辺を複数のスレッドが同時に緩和しうる
+ *         v.dとv.πを別々に書き換えると、v.dとv.πが別々の緩和に由来する状態が見えることがあるので、
+ *         d値(上位32ビット)とπ値(下位32ビット)を1つの64ビット整数に詰め、d値が減る場合にだけ比較交換で書き換える
+ *         したがって、d値とπ値は常に対応しており、d値は単調に減る
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef ATOMIC_RELAX_HPP
+#define ATOMIC_RELAX_HPP
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "graph.hpp"
+#include <atomic>
+#include <cstdint>
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**< @brief d値(上位32ビット)とπ値(下位32ビット)を1つの64ビット整数に詰める */
+inline std::uint64_t pack_relax(weight_t d, index_t pi)
+{
+    return static_cast<std::uint64_t>(static_cast<std::uint32_t>(d)) << 32 | static_cast<std::uint32_t>(pi);
+}
+inline weight_t unpack_d(std::uint64_t x)  { return static_cast<weight_t>(x >> 32); }
+inline index_t  unpack_pi(std::uint64_t x) { return static_cast<index_t>(static_cast<std::uint32_t>(x)); }
+
+
+/**
+ * @brief  辺(u, v)を緩和する. v.d > dの間、(v.d, v.π)を(d, u)に比較交換で書き換える
+ * @return v.dを減らしたか？
+ */
+inline bool relax_atomic(std::atomic<std::uint64_t>& v, weight_t d, index_t u)
+{
+    std::uint64_t old = v.load(std::memory_order_relaxed), x = pack_relax(d, u);
+    while (unpack_d(old) > d) {
+        if (v.compare_exchange_weak(old, x, std::memory_order_relaxed)) { return true; }
+    }
+    return false;
+}
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
+
+
+
+#endif  // end of ATOMIC_RELAX_HPP
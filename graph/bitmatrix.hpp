@@ -0,0 +1,181 @@
+/**
+ * @brief  隣接行列の各要素を1ビットに詰めたビット行列を扱う
+ *
+ * @note   密なグラフを隣接行列matrix_tで表すと、辺の有無だけを知りたい場合でも1要素に4バイトを用いる
+ *         bit_matrixは第i行を64ビットの語(word)の列として格納し、(i, j) ∈ Eならば第i行の第jビットを立てる
+ *         記憶量はn^2 / 8バイトで、matrix_tの32分の1である
+ *
+ * @note   行の集合演算(和、差)は1語で64頂点分をまとめて計算できる. 幅優先探索(bfs/bfs.hpp)や推移閉包(transitive_closure)は、
+ *         隣接する頂点を1つずつ調べる代わりに、行の語ごとのORとAND NOTで頂点の集合を更新する
+ *
+ * @note   各行の先頭は64バイト境界に揃え、行の長さ(語数)のstrideは8の倍数に切り上げる. 切り上げた部分のビットは常に0である
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef BITMATRIX_HPP
+#define BITMATRIX_HPP
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "graph.hpp"
+#include "csr.hpp"
+#include "matrix.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <memory>
+#include <new>
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief  n x nのビット行列(有向グラフG = (V, E)の隣接行列)
+ */
+struct bit_matrix {
+    using word_t = std::uint64_t;
+    static constexpr std::size_t alignment = 64;  /**< 各行の先頭を揃える境界 */
+    static constexpr std::size_t bits      = 64;  /**< 1語のビット数 */
+
+    bit_matrix() = default;
+
+    /**< @brief すべての要素が0のn x nの行列を生成する */
+    explicit bit_matrix(std::size_t n)
+        : n_(n), words_((n + bits - 1) / bits), stride_(round_up(words_)), buf(allocate(n * stride_))
+    {
+        std::fill_n(buf.get(), n_ * stride_, word_t(0));
+    }
+
+    /**< @brief 隣接リスト表現Gから生成する */
+    explicit bit_matrix(const graph_t& G) : bit_matrix(G.size())
+    {
+        for (auto&& es : G) { for (auto&& e : es) { set(e.src, e.dst); } }
+    }
+
+    /**< @brief CSR表現Gから生成する */
+    explicit bit_matrix(const csr_graph& G) : bit_matrix(G.size())
+    {
+        for (index_t u = 0; u < G.size(); ++u) { for (auto&& e : G[u]) { set(u, e.dst); } }
+    }
+
+    /**< @brief 重み行列Wから生成する. i != jかつwij != ∞の要素を辺とする */
+    explicit bit_matrix(const matrix_t& W) : bit_matrix(W.size()) { from_weights(W); }
+    explicit bit_matrix(const dense_matrix& W) : bit_matrix(W.size()) { from_weights(W); }
+
+    bit_matrix(const bit_matrix& M) : n_(M.n_), words_(M.words_), stride_(M.stride_), buf(allocate(n_ * stride_))
+    {
+        std::copy_n(M.buf.get(), n_ * stride_, buf.get());
+    }
+    bit_matrix(bit_matrix&&) noexcept = default;
+    bit_matrix& operator = (const bit_matrix& M) { if (this != &M) { *this = bit_matrix(M); } return *this; }
+    bit_matrix& operator = (bit_matrix&&) noexcept = default;
+
+    std::size_t size()   const { return n_; }      /**< @brief 行数(頂点数)を返す */
+    std::size_t words()  const { return words_; }  /**< @brief 1行の意味のある語数を返す */
+    std::size_t stride() const { return stride_; } /**< @brief 隣り合う行の先頭の間隔(語数) */
+
+    /**< @brief 第i行の先頭の語を返す */
+    word_t*       row(std::size_t i)       { return buf.get() + i * stride_; }
+    const word_t* row(std::size_t i) const { return buf.get() + i * stride_; }
+
+    /**< @brief 要素(i, j)を返す */
+    bool test(std::size_t i, std::size_t j) const { return (row(i)[j / bits] >> (j % bits)) & 1; }
+
+    /**< @brief 要素(i, j)を1にする */
+    void set(std::size_t i, std::size_t j) { row(i)[j / bits] |= word_t(1) << (j % bits); }
+
+    /**< @brief 要素(i, j)を0にする */
+    void reset(std::size_t i, std::size_t j) { row(i)[j / bits] &= ~(word_t(1) << (j % bits)); }
+
+    /**< @brief 第i行の1の数(頂点iの出次数)を返す */
+    std::size_t count(std::size_t i) const
+    {
+        std::size_t c = 0;
+        for (std::size_t k = 0; k < words_; ++k) { c += static_cast<std::size_t>(__builtin_popcountll(row(i)[k])); }
+        return c;
+    }
+
+    /**< @brief 転置行列を返す */
+    bit_matrix transpose() const
+    {
+        bit_matrix T(n_);
+        for (std::size_t i = 0; i < n_; ++i) {
+            for (std::size_t k = 0; k < words_; ++k) {
+                for (word_t x = row(i)[k]; x != 0; x &= x - 1) { T.set(k * bits + __builtin_ctzll(x), i); }
+            }
+        }
+        return T;
+    }
+
+    bool operator == (const bit_matrix& M) const
+    {
+        if (n_ != M.n_) { return false; }
+        for (std::size_t i = 0; i < n_; ++i) {
+            if (!std::equal(row(i), row(i) + words_, M.row(i))) { return false; }
+        }
+        return true;
+    }
+    bool operator != (const bit_matrix& M) const { return !(*this == M); }
+
+private:
+    struct deleter {
+        void operator () (word_t* p) const { ::operator delete(p, std::align_val_t(alignment)); }
+    };
+
+    template<class Matrix>
+    void from_weights(const Matrix& W)
+    {
+        for (std::size_t i = 0; i < n_; ++i) {
+            for (std::size_t j = 0; j < n_; ++j) { if (i != j && W[i][j] != limits::inf) { set(i, j); } }
+        }
+    }
+
+    static std::size_t round_up(std::size_t words)
+    {
+        constexpr std::size_t k = alignment / sizeof(word_t);
+        return (words + k - 1) / k * k;
+    }
+
+    static word_t* allocate(std::size_t count)
+    {
+        if (count == 0) { return nullptr; }
+        return static_cast<word_t*>(::operator new(count * sizeof(word_t), std::align_val_t(alignment)));
+    }
+
+    std::size_t n_ = 0, words_ = 0, stride_ = 0;
+    std::unique_ptr<word_t[], deleter> buf;
+};
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
+
+
+
+#endif  // end of BITMATRIX_HPP
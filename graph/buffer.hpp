@@ -0,0 +1,185 @@
+/**
+ * @brief  自分で確保した配列と、外部の読み取り専用メモリ(ファイルの写像など)を同じように扱う配列
+ *
+ * @note   buffer<T>は通常はstd::vector<T>と同じく要素を所有する. borrow(p, n, keeper)で作ったものは、keeperが保持するメモリ
+ *         [p, p + n)をコピーせずに参照し、keeperの参照がすべてなくなったときにそのメモリが解放される
+ *         参照しているbufferを書き換えようとすると、その時点で要素を自分の配列にコピーしてから書き換える(copy-on-write)
+ *         要素の読み出しは常に1本のポインタを辿るだけなので、std::vector<T>と同じ速さで走る
+ *         要素への参照はconstのものだけを返し、要素を書き換えるときはmutable_data()を用いる
+ *
+ * @note   所有する要素はstd::pmr::memory_resourceから確保する. 構築時に資源を渡せば、アリーナ(arena.hpp)などから確保できる
+ *         コピーは既定の資源に確保し、ムーブ構築は資源ごと引き継ぐ(std::pmr::vectorと同じ規則)
+ *
+ * @note   CSR表現csr_graphの配列に用い、ファイルをmmapした領域の上にグラフを直接構成できるようにする(snapshot/snapshot.hpp)
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef BUFFER_HPP
+#define BUFFER_HPP
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "graph.hpp"
+#include <cstddef>
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// クラスの定義
+//****************************************
+
+/**
+ * @brief  要素を所有するか、外部のメモリを参照する配列
+ * @tparam T  要素の型(トリビアルにコピーできる型)
+ */
+template<class T>
+class buffer {
+public:
+    using value_type     = T;
+    using const_iterator = const T*;
+
+    buffer() = default;
+    explicit buffer(std::pmr::memory_resource* mr) : own(mr) {}
+    explicit buffer(std::size_t n, T x = T()) : own(n, x) { sync(); }
+    buffer(std::size_t n, T x, std::pmr::memory_resource* mr) : own(n, x, mr) { sync(); }
+
+    template<class InputIterator, class = typename std::iterator_traits<InputIterator>::iterator_category>
+    buffer(InputIterator first, InputIterator last) : own(first, last) { sync(); }
+
+    buffer(const buffer& b) { *this = b; }
+    buffer(buffer&& b) noexcept : own(std::move(b.own)), p(b.p), n(b.n), keeper(std::move(b.keeper))
+    {
+        if (!keeper) { sync(); }
+        b.own.clear(); b.keeper.reset(); b.sync();
+    }
+
+    /**< @brief 参照しているbufferのコピーは同じメモリを参照する. 所有しているbufferのコピーは要素をコピーする */
+    buffer& operator = (const buffer& b)
+    {
+        if (this == &b) { return *this; }
+        if (b.keeper) { own.clear(); own.shrink_to_fit(); keeper = b.keeper; p = b.p; n = b.n; }
+        else          { own = b.own; keeper.reset(); sync(); }
+        return *this;
+    }
+
+    buffer& operator = (buffer&& b) noexcept
+    {
+        if (this == &b) { return *this; }
+        own = std::move(b.own); keeper = std::move(b.keeper);
+        if (keeper) { p = b.p; n = b.n; }
+        else        { sync(); }
+        b.own.clear(); b.keeper.reset(); b.sync();
+        return *this;
+    }
+
+    /**
+     * @brief  keeperが保持するメモリ[p, p + n)をコピーせずに参照するbufferを返す
+     * @note   keeperはメモリの持ち主であり、最後の参照がなくなると解放(munmapなど)を行う. 所有権を持たないならば空でもよい
+     */
+    static buffer borrow(const T* p, std::size_t n, std::shared_ptr<const void> keeper)
+    {
+        buffer b;
+        b.p = p; b.n = n;
+        b.keeper = keeper ? std::move(keeper) : std::shared_ptr<const void>(p, [](const void*) {});
+        return b;
+    }
+
+    /**< @brief 外部のメモリを参照しているか？ */
+    bool borrowed() const { return static_cast<bool>(keeper); }
+
+    /**< @brief 所有する要素を確保する資源を返す */
+    std::pmr::memory_resource* resource() const { return own.get_allocator().resource(); }
+
+    std::size_t size() const { return n; }
+    bool empty() const { return n == 0; }
+
+    const T* data() const { return p; }
+    const_iterator begin() const { return p; }
+    const_iterator end()   const { return p + n; }
+    const T& operator [] (std::size_t i) const { return p[i]; }
+    const T& front() const { return p[0]; }
+    const T& back()  const { return p[n - 1]; }
+
+    /**< @brief 要素の列が等しいか？ */
+    bool operator == (const buffer& b) const { return n == b.n && std::equal(p, p + n, b.p); }
+    bool operator != (const buffer& b) const { return !(*this == b); }
+
+    //****************************************
+    // 書き換え(参照しているならば、先に要素をコピーする)
+    //****************************************
+
+    /**
+     * @brief  書き換えのできる要素の先頭を返す
+     * @note   要素の参照はconstのものしか提供しないので、読み出すだけのコードがうっかり写像したメモリをコピーすることはない
+     *         書き換えるときは明示的にこれを呼ぶこと
+     */
+    T* mutable_data() { detach(); return own.data(); }
+
+    void assign(std::size_t count, T x) { keeper.reset(); own.assign(count, x); sync(); }
+
+    template<class InputIterator, class = typename std::iterator_traits<InputIterator>::iterator_category>
+    void assign(InputIterator first, InputIterator last)
+    {
+        std::pmr::vector<T> v(first, last, own.get_allocator());  // [first, last)が参照しているメモリを指していても、解放する前にコピーする
+        own.swap(v); keeper.reset(); sync();
+    }
+
+    void resize(std::size_t count, T x = T()) { detach(); own.resize(count, x); sync(); }
+    void reserve(std::size_t count) { detach(); own.reserve(count); sync(); }
+    void push_back(T x) { detach(); own.push_back(x); sync(); }
+    void clear() { keeper.reset(); own.clear(); sync(); }
+
+private:
+    /**< @brief 参照しているメモリを自分の配列にコピーし、参照をやめる */
+    void detach()
+    {
+        if (!keeper) { return; }
+        own.assign(p, p + n);
+        keeper.reset();
+        sync();
+    }
+
+    void sync() { p = own.data(); n = own.size(); }
+
+    std::pmr::vector<T>         own;          /**< 所有している要素 */
+    const T*                    p = nullptr;  /**< 要素の先頭(ownの先頭か、参照しているメモリ) */
+    std::size_t                 n = 0;        /**< 要素の数 */
+    std::shared_ptr<const void> keeper;       /**< 参照しているメモリの持ち主(所有しているならば空) */
+};
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
+
+
+
+#endif  // end of BUFFER_HPP
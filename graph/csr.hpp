@@ -0,0 +1,219 @@
+/**
+ * @brief  グラフの圧縮行格納(compressed sparse row, CSR)表現を扱う
+ *
+ * @note   隣接リスト表現graph_tでは頂点ごとに別々の動的配列を確保するため、隣接リストを走査するたびにポインタを辿ることになる
+ *         また、各辺は始点srcを重複して保持している. 辺の数が数千万におよぶグラフでは、これらの無駄が無視できなくなる
+ *
+ *         CSR表現では、頂点uの隣接リストを1本の配列dstの区間[offset[u], offset[u + 1])に詰めて格納し、
+ *         辺の重みwも同じ添字で配列wに並べる. 始点uは区間の位置から分かるので格納しない
+ *         記憶量は|V| + 1個の添字と|E|個の(終点, 重み)の組、すなわちΘ(V + E)であり、隣接リストの走査は連続したメモリの走査になる
+ *
+ *         CSR表現は不変(immutable)である. 辺の追加や削除が必要ならば、graph_tや辺集合edges_tを編集して再構築すること
+ *
+ * @note   各配列はbuffer(buffer.hpp)であり、ファイルを写像したメモリをコピーせずに参照することもできる(snapshot/snapshot.hpp)
+ *         構築時にstd::pmr::memory_resourceを渡せば、配列と作業領域をそこから確保する(arena.hpp)
+ *         読み出しはstd::vectorと同じように行え、書き換えるときはmutable_data()を用いる
+ *
+ * @note   G[u]は頂点uの隣接リストを表す範囲を返し、その要素はgraph_tと同様にedge(src, dst, w)として読み出せる
+ *         したがって、for (auto&& e : G[u])の形で書かれたアルゴリズムは、graph_tとCSR表現のどちらに対しても同じように動作する
+ *
+ * @note   basic_csr_graph<Traits>は添字と重みの型を特性Traits(graph_traits)で選ぶ. csr_graphは既定の特性による別名である
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef CSR_HPP
+#define CSR_HPP
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "graph.hpp"
+#include "buffer.hpp"
+#include <cstddef>
+#include <iterator>
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief  グラフGのCSR表現
+ * @tparam Traits 添字と重みの型を与える特性(graph_traits)
+ */
+template<class Traits>
+struct basic_csr_graph {
+    using traits_type = Traits;
+    using index_type  = typename Traits::index_type;
+    using weight_type = typename Traits::weight_type;
+    using edge_type   = basic_edge<Traits>;
+
+    buffer<index_type>  offset;  /**< 頂点uの隣接リストの開始位置(offset[|V|] = |E|) */
+    buffer<index_type>  dst;     /**< 辺(u, v)の終点v */
+    buffer<weight_type> w;       /**< 辺(u, v)への重み(容量) */
+
+
+    /**
+     * @brief 頂点uの隣接リストAdj[u]を表す範囲
+     */
+    struct adjacency {
+        /**< @brief 隣接リストを走査する反復子. 参照外しで辺(u, v)を返す */
+        struct iterator {
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = edge_type;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = const edge_type*;
+            using reference         = edge_type;
+
+            const basic_csr_graph* G;
+            index_type u, i;
+
+            edge_type operator * () const { return edge_type(u, G->dst[i], G->w[i]); }
+            iterator& operator ++ () { ++i; return *this; }
+            iterator  operator ++ (int) { iterator it = *this; ++i; return it; }
+            bool operator == (const iterator& it) const { return i == it.i; }
+            bool operator != (const iterator& it) const { return i != it.i; }
+        };
+
+        const basic_csr_graph* G;
+        index_type u;
+
+        iterator begin() const { return { G, u, G->offset[u] }; }
+        iterator end()   const { return { G, u, G->offset[u + 1] }; }
+        std::size_t size() const { return G->offset[u + 1] - G->offset[u]; }
+        bool empty() const { return size() == 0; }
+        edge_type operator [] (std::size_t k) const
+        {
+            index_type i = G->offset[u] + static_cast<index_type>(k);
+            return edge_type(u, G->dst[i], G->w[i]);
+        }
+    };
+
+
+    basic_csr_graph() : offset(1, 0) {}
+
+    /**< @brief 配列を資源mrから確保する空のグラフを生成する */
+    explicit basic_csr_graph(std::pmr::memory_resource* mr) : offset(1, 0, mr), dst(mr), w(mr) {}
+
+    /**< @brief 隣接リスト表現Gから、配列を資源mrから確保して生成する */
+    explicit basic_csr_graph(const basic_graph_t<Traits>& G, std::pmr::memory_resource* mr = std::pmr::get_default_resource()) : basic_csr_graph(mr) { from_lists(G); }
+    explicit basic_csr_graph(const pmr::basic_graph_t<Traits>& G, std::pmr::memory_resource* mr = std::pmr::get_default_resource()) : basic_csr_graph(mr) { from_lists(G); }
+
+    /**
+     * @brief  頂点数nと辺集合Eから、配列を資源mrから確保して生成する
+     * @note   始点srcをキーとする計数ソートで辺を並べるので、Θ(V + E)時間で走る. 同じ始点を持つ辺の順序はEでの順序を保つ
+     */
+    basic_csr_graph(index_type n, const basic_edges_t<Traits>& E, std::pmr::memory_resource* mr = std::pmr::get_default_resource()) : basic_csr_graph(mr) { from_edges(n, E); }
+    basic_csr_graph(index_type n, const pmr::basic_edges_t<Traits>& E, std::pmr::memory_resource* mr = std::pmr::get_default_resource()) : basic_csr_graph(mr) { from_edges(n, E); }
+
+    /**< @brief 頂点数|V|を返す */
+    index_type size() const { return static_cast<index_type>(offset.size()) - 1; }
+
+    /**< @brief 辺数|E|を返す */
+    index_type edge_count() const { return offset.back(); }
+
+    /**< @brief 頂点uの出次数を返す */
+    index_type degree(index_type u) const { return offset[u + 1] - offset[u]; }
+
+    /**< @brief 頂点uの隣接リストAdj[u]を返す */
+    adjacency operator [] (index_type u) const { return { this, u }; }
+
+private:
+    template<class AdjacencyList>
+    void from_lists(const AdjacencyList& G)
+    {
+        index_type n = static_cast<index_type>(G.size());
+        offset.assign(n + 1, 0);
+        index_type* off = offset.mutable_data();
+        for (index_type u = 0; u < n; ++u) { off[u + 1] = off[u] + static_cast<index_type>(G[u].size()); }
+        dst.resize(off[n]); w.resize(off[n]);
+        index_type*  pd = dst.mutable_data();
+        weight_type* pw = w.mutable_data();
+        for (auto&& es : G) {
+            for (auto&& e : es) { *pd++ = e.dst; *pw++ = e.w; }
+        }
+    }
+
+    template<class Edges>
+    void from_edges(index_type n, const Edges& E)
+    {
+        offset.assign(n + 1, 0); dst.resize(E.size()); w.resize(E.size());
+        index_type*  off = offset.mutable_data();
+        index_type*  pd  = dst.mutable_data();
+        weight_type* pw  = w.mutable_data();
+        for (auto&& e : E) { ++off[e.src + 1]; }
+        for (index_type u = 0; u < n; ++u) { off[u + 1] += off[u]; }
+        std::pmr::vector<index_type> pos(off, off + n, offset.resource());
+        for (auto&& e : E) {
+            index_type i = pos[e.src]++;
+            pd[i] = e.dst; pw[i] = e.w;
+        }
+    }
+};
+
+using csr_graph = basic_csr_graph<default_traits>;  /**< 既定の特性によるCSR表現 */
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**
+ * @brief  Gの転置G^T = (V, E^T), E^T = { (u, v) : (v, u) ∈ E }をΘ(V + E)時間で生成する
+ * @note   各辺の重みは保たれる. G^Tの配列は資源mrから確保する
+ */
+template<class Traits>
+basic_csr_graph<Traits> transpose(const basic_csr_graph<Traits>& G, std::pmr::memory_resource* mr = std::pmr::get_default_resource())
+{
+    using index_type  = typename Traits::index_type;
+    using weight_type = typename Traits::weight_type;
+    index_type n = G.size(), m = G.edge_count();
+    basic_csr_graph<Traits> GT(mr);
+    GT.offset.assign(n + 1, 0);
+    GT.dst.resize(m); GT.w.resize(m);
+    index_type*  off = GT.offset.mutable_data();
+    index_type*  pd  = GT.dst.mutable_data();
+    weight_type* pw  = GT.w.mutable_data();
+    for (index_type i = 0; i < m; ++i) { ++off[G.dst[i] + 1]; }
+    for (index_type v = 0; v < n; ++v) { off[v + 1] += off[v]; }
+    std::pmr::vector<index_type> pos(off, off + n, mr);
+    for (index_type u = 0; u < n; ++u) {
+        for (index_type i = G.offset[u]; i < G.offset[u + 1]; ++i) {
+            index_type j = pos[G.dst[i]]++;
+            pd[j] = u; pw[j] = G.w[i];
+        }
+    }
+    return GT;
+}
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
+
+
+
+#endif  // end of CSR_HPP
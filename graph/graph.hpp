@@ -64,6 +64,10 @@
 //********************************************************************************
 
 #include <vector>
+#include <memory_resource>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
 
 
 
@@ -111,40 +115,99 @@ enum struct vcolor : std::int32_t {
     gray,   /**< 既見済頂点 */
 };
 
+/**
+ * @brief  頂点の添字の型と辺の重みの型、およびそれらの番兵の値を与える特性(traits)
+ *
+ * @note   頂点、辺、CSR表現、min優先度付きキューなどは特性Traitsを型引数に持つテンプレートであり、
+ *         型はすべてコンパイル時に決まるので、実行時の費用はない. Traitsを省いた名前(edge, vertex, csr_graph, ...)は
+ *         既定の特性default_traitsによる実体化の別名であり、これまでと同じくstd::int32_tを用いる
+ *
+ *         重みの和が2^31を超えるグラフ(道路網の距離[mm]など)ではstd::int64_tを、重みと最短路重みが小さいグラフでは
+ *         std::uint16_tを用いれば、重みの配列の大きさが変わり、それだけメモリ帯域を節約できる. 実数の重みならば浮動小数点数型を用いる
+ *
+ * @note   ∞は整数型では最大値の1/3である. したがって、∞未満の2つの値の和は型の範囲に収まる
+ *         浮動小数点数型では∞そのもの(std::numeric_limits<Weight>::infinity())を用いる
+ *         NILは添字の型の最小値の1/3であり、0以上の添字と区別できるように添字の型は符号付きでなければならない
+ *
+ * @tparam Index  頂点の添字を表す符号付き整数型
+ * @tparam Weight 辺(u, v)への重みを表す算術型
+ */
+template<class Index, class Weight>
+struct graph_traits {
+    static_assert(std::is_integral_v<Index> && std::is_signed_v<Index>, "the index type must be a signed integer");
+    static_assert(std::is_arithmetic_v<Weight>, "the weight type must be arithmetic");
+
+    using index_type    = Index;   /**< 頂点vの添字を表す型       */
+    using weight_type   = Weight;  /**< 辺(u, v)への重みwを表す型 */
+    using capacity_type = Weight;  /**< 辺(u, v)の容量を表す型    */
+
+    /**< @brief 辺が存在しない場合に使用される値 */
+    static constexpr weight_type inf() noexcept
+    {
+        if constexpr (std::is_floating_point_v<Weight>) { return std::numeric_limits<Weight>::infinity(); }
+        else                                            { return std::numeric_limits<Weight>::max() / 3; }
+    }
+
+    /**< @brief 先行点が存在しない場合に使用される値 */
+    static constexpr index_type nil() noexcept { return std::numeric_limits<Index>::min() / 3; }
+};
+
+using default_traits = graph_traits<index_t, weight_t>;       /**< 既定の特性. 添字, 重みともにstd::int32_t */
+using wide_traits    = graph_traits<index_t, std::int64_t>;   /**< 重みの和が2^31を超えるグラフのための特性 */
+using narrow_traits  = graph_traits<index_t, std::uint16_t>;  /**< 最短路重みが∞ = 21845未満に収まるグラフのための特性 */
+using real_traits    = graph_traits<index_t, double>;         /**< 実数の重みを持つグラフのための特性 */
+
+
 /**
  * @brief グラフ用ノード(頂点)
+ * @tparam Traits 添字と重みの型を与える特性(graph_traits)
  */
-struct vertex {
+template<class Traits>
+struct basic_vertex {
+    using traits_type = Traits;
+    using index_type  = typename Traits::index_type;
+    using weight_type = typename Traits::weight_type;
+
     union {
-        weight_t d;       /**< 始点sからの距離  */
-        weight_t key;     /**< Primのアルゴリズムにおいて木に属するある頂点とを結ぶ重み */
+        weight_type d;    /**< 始点sからの距離  */
+        weight_type key;  /**< Primのアルゴリズムにおいて木に属するある頂点とを結ぶ重み */
     };
-    index_t pi;           /**< 先行頂点(の添字) */
+    index_type pi;        /**< 先行頂点(の添字) */
     union {
         vcolor color;     /**< 頂点の色        */
         bool_t  visited;  /**< 発見済みか?     */
     };
     // weight_t f;           /**< 終了時刻印(DFSにおいて、黒色に彩色されたとき、刻まれる)     */
-    vertex() noexcept : d(0), pi(0), color(vcolor::white)/*, f(0)*/ {}
+    basic_vertex() noexcept : d(0), pi(0), color(vcolor::white)/*, f(0)*/ {}
 };
 
 /**
  * @brief グラフ用エッジ(辺)
  * @note  G = (V, E)を重み関数wを持つ重み付きグラフとすると、
  *        辺(u, v) ∈ Eの重みはw(u, v)と表される
+ * @tparam Traits 添字と重みの型を与える特性(graph_traits)
  */
-struct edge {
-    index_t  src;   /**< 辺の始点u */
-    index_t  dst;   /**< 辺の終点v */
+template<class Traits>
+struct basic_edge {
+    using traits_type   = Traits;
+    using index_type    = typename Traits::index_type;
+    using weight_type   = typename Traits::weight_type;
+    using capacity_type = typename Traits::capacity_type;
+
+    index_type src;   /**< 辺の始点u */
+    index_type dst;   /**< 辺の終点v */
     union {
-        weight_t w;     /**< 辺(u, v)への重み(コスト) */
-        capacity_t c;   /**< 辺(u, v)の容量 */
+        weight_type   w;  /**< 辺(u, v)への重み(コスト) */
+        capacity_type c;  /**< 辺(u, v)の容量 */
     };
-    edge() = default;
-    edge(index_t src, index_t dst) noexcept             : src(src), dst(dst), w(1) {}
-    edge(index_t src, index_t dst, weight_t w) noexcept : src(src), dst(dst), w(w) {}
+    basic_edge() = default;
+    basic_edge(index_type src, index_type dst) noexcept                : src(src), dst(dst), w(1) {}
+    basic_edge(index_type src, index_type dst, weight_type w) noexcept : src(src), dst(dst), w(w) {}
 };
 
+using vertex = basic_vertex<default_traits>;  /**< 既定の特性による頂点 */
+using edge   = basic_edge<default_traits>;    /**< 既定の特性による辺   */
+
 
 
 namespace limits {
@@ -154,6 +217,8 @@ namespace limits {
     };
 }
 
+static_assert(default_traits::inf() == limits::inf && default_traits::nil() == limits::nil, "limits must agree with default_traits");
+
 
 
 //********************************************************************************
@@ -168,6 +233,47 @@ using stamps_t   = std::vector<bool_t>;    /**< ブーリアンの集合 */
 using matrix_t   = std::vector<array_t>;   /**< グラフGの隣接行列表現(および表行列表現) */
 using graph_t    = std::vector<edges_t>;   /**< グラフGの隣接リスト表現(こちらを主に使用する) */
 
+template<class Traits> using basic_edges_t    = std::vector<basic_edge<Traits>>;    /**< 特性Traitsによる辺集合E   */
+template<class Traits> using basic_vertices_t = std::vector<basic_vertex<Traits>>;  /**< 特性Traitsによる頂点集合V */
+template<class Traits> using basic_graph_t    = std::vector<basic_edges_t<Traits>>; /**< 特性Traitsによる隣接リスト表現 */
+
+
+/**
+ * @brief  グラフの表現Graphの特性を求める
+ * @note   CSR表現のようにtraits_typeを持つものはそれを、隣接リスト表現basic_graph_t<Traits>は辺の型の特性を用いる
+ */
+template<class Graph, class = void>
+struct graph_traits_of { using type = typename Graph::value_type::value_type::traits_type; };
+
+template<class Graph>
+struct graph_traits_of<Graph, std::void_t<typename Graph::traits_type>> { using type = typename Graph::traits_type; };
+
+template<class Graph> using traits_of = typename graph_traits_of<Graph>::type;  /**< グラフの表現Graphの特性 */
+
+
+
+//********************************************************************************
+// 型シノニムその3
+//********************************************************************************
+
+/**
+ * @brief  多態的アロケータ(std::pmr::polymorphic_allocator)を用いる版の型シノニム
+ * @note   構築時にstd::pmr::memory_resourceを渡すと、入れ子のコンテナを含むすべての要素のメモリをそこから確保する
+ *         たとえばgraph::pmr::graph_t G(n, &A)とすれば、各隣接リストもアリーナA(arena.hpp)から確保される
+ *         渡さなければstd::pmr::get_default_resource()(new/delete)を用いるので、振る舞いは上の型シノニムと同じである
+ */
+namespace pmr {
+    using edges_t    = std::pmr::vector<edge>;      /**< グラフG=(V, E)の辺集合E   */
+    using vertices_t = std::pmr::vector<vertex>;    /**< グラフG=(V, E)の頂点集合V */
+    using array_t    = std::pmr::vector<weight_t>;  /**< 重みwの配列  */
+    using indices_t  = std::pmr::vector<index_t>;   /**< 頂点の添字配列 */
+    using matrix_t   = std::pmr::vector<array_t>;   /**< グラフGの隣接行列表現(および表行列表現) */
+    using graph_t    = std::pmr::vector<edges_t>;   /**< グラフGの隣接リスト表現 */
+
+    template<class Traits> using basic_edges_t = std::pmr::vector<basic_edge<Traits>>;     /**< 特性Traitsによる辺集合E   */
+    template<class Traits> using basic_graph_t = std::pmr::vector<basic_edges_t<Traits>>;  /**< 特性Traitsによる隣接リスト表現 */
+}
+
 
 
 //********************************************************************************
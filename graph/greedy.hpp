@@ -19,6 +19,10 @@
 //****************************************
 
 #include "graph.hpp"
+#include <algorithm>
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
 
 
 
@@ -47,7 +51,7 @@ GRAPH_BEGIN
  * @param  index_t n           頂点集合Vの頂点数n
  * @return index_t u           条件を満たす頂点u(条件を満たす頂点が存在しない場合はnilを返す)
  */
-static index_t extract_min(const vertices_t& V, index_t n)
+static inline index_t extract_min(const vertices_t& V, index_t n)
 {
     index_t  u = limits::nil;
     weight_t d = limits::inf;
@@ -62,6 +66,61 @@ static index_t extract_min(const vertices_t& V, index_t n)
 
 
 
+/**
+ * @brief  配列q[0, n)で最小の値を持つ最初の添字uを返す(すべての値が∞ならばNILを返す)
+ *
+ * @note   vertices_tに対するextract_minは頂点ごとにv.visitedとv.dを読むので、比較が分岐になりベクトル化できない
+ *         こちらは集合Sに属する頂点の値を∞にした配列qを受け取り、
+ *           1. 最小値m = min q[v]を求める
+ *           2. q[v] = mとなる最初のvを探す
+ *         の2回の走査に分ける. どちらも分岐のない比較なので、AVX2またはAVX-512が使えるときは8個または16個ずつまとめて比較する
+ *         結果は、vertices_tに対するextract_minと同じ頂点である(最小の値を持つ頂点のうち、最小の番号のもの)
+ *
+ * @param  const weight_t* q 頂点の値の配列q(集合Sに属する頂点の値は∞とする)
+ * @param  index_t n         頂点数n
+ * @return index_t u         条件を満たす頂点u(条件を満たす頂点が存在しない場合はnilを返す)
+ */
+static inline index_t extract_min(const weight_t* q, index_t n)
+{
+    index_t  v = 0;
+    weight_t m = limits::inf;
+#if defined(__AVX512F__)
+    __m512i vm = _mm512_set1_epi32(limits::inf);
+    for (; v + 16 <= n; v += 16) { vm = _mm512_mask_min_epi32(vm, 0xffff, vm, _mm512_loadu_si512(q + v)); }
+    alignas(64) weight_t lane[16];
+    _mm512_store_si512(lane, vm);
+    for (auto&& x : lane) { m = std::min(m, x); }
+#elif defined(__AVX2__)
+    __m256i vm = _mm256_set1_epi32(limits::inf);
+    for (; v + 8 <= n; v += 8) { vm = _mm256_min_epi32(vm, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(q + v))); }
+    alignas(32) weight_t lane[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lane), vm);
+    for (auto&& x : lane) { m = std::min(m, x); }
+#endif
+    for (; v < n; ++v) { m = std::min(m, q[v]); }
+    if (m == limits::inf) { return limits::nil; }
+
+    v = 0;
+#if defined(__AVX512F__)
+    const __m512i vx = _mm512_set1_epi32(m);
+    for (; v + 16 <= n; v += 16) {
+        __mmask16 k = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(q + v), vx);
+        if (k != 0) { return v + __builtin_ctz(k); }
+    }
+#elif defined(__AVX2__)
+    const __m256i vx = _mm256_set1_epi32(m);
+    for (; v + 8 <= n; v += 8) {
+        __m256i c = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(q + v)), vx);
+        int k = _mm256_movemask_ps(_mm256_castsi256_ps(c));
+        if (k != 0) { return v + __builtin_ctz(k); }
+    }
+#endif
+    for (; q[v] != m; ++v) {}
+    return v;
+}
+
+
+
 //****************************************
 // 名前空間の終端
 //****************************************
@@ -0,0 +1,335 @@
+/**
+ * @brief  DijkstraおよびPrimのアルゴリズムで用いるmin優先度付きキューに関する物置
+ *
+ * @note   std::priority_queueはDECREASE-KEY操作を持たないので、最短路推定値が改善されるたびに同じ頂点を重複して挿入し、
+ *         EXTRACT-MIN時に古い要素を無視する必要がある(遅延削除). このとき、キューの大きさはΟ(E)まで膨らむ
+ *
+ *         添字付きd分ヒープ(indexed d-ary heap)は、各頂点vがヒープ配列のどこにあるかを位置配列pos[v]で管理することで、
+ *         DECREASE-KEY操作をΟ(log_d V)時間で実行する. 各頂点は高々1回しかヒープに置かれないので、記憶量は|V|で抑えられる
+ *
+ *         d分ヒープの各節点はd個の子を持つ. 添字iの節点の親は(i - 1) / d、子は d * i + 1, ..., d * i + dである
+ *         dを大きくすると木が浅くなりINSERTやDECREASE-KEYが速くなる一方で、EXTRACT-MINでは各段でd個の子を比較する必要がある
+ *         Dijkstraのアルゴリズムのように、DECREASE-KEYがEXTRACT-MINよりも多く呼ばれる場合には、d = 4程度が良い
+ *
+ * @note   辺重みが非負の整数であれば、Dijkstraのアルゴリズムが取り出すキーは単調非減少である
+ *         このとき、比較に基づくヒープの代わりに、キーの値そのものを使う単調(monotone)な優先度付きキューを用いることができる
+ *
+ *         基数ヒープ(radix heap)は、最後に取り出したキーlastとのビット単位の排他的論理和の最上位ビットの位置で要素をバケットに分ける
+ *         キーの比較はビット演算に置き換わり、各要素はバケットを高々lg C回しか移動しないので、Dijkstraのアルゴリズムは
+ *         Ο(E + VlgC)時間で走る. ここでCは最大の辺重みである
+ *
+ *         Dialのバケット(Dial's bucket queue)は、キーdの要素をバケットd mod (C + 1)に置く. 単調性から、キューに置かれているキーは
+ *         常にlast以上last + C以下なので、C + 1個のバケットを循環させれば十分である. Dijkstraのアルゴリズムは
+ *         Ο(E + V + D)時間で走る. ここでDは最大の最短路重みであり、Cが小さいときに特に速い
+ *
+ *         どちらもstd::priority_queue<state>と同様に、同じ頂点を重複して挿入し、取り出したときに古い要素を無視する(遅延削除)
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef HEAP_HPP
+#define HEAP_HPP
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "graph.hpp"
+#include "stats.hpp"
+#include <cstddef>
+#include <algorithm>
+#include <queue>
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief  min優先度付きキューの要素. 頂点uとそのキーd
+ * @tparam Traits 添字と重みの型を与える特性(graph_traits)
+ */
+template<class Traits>
+struct basic_state {
+    using index_type  = typename Traits::index_type;
+    using weight_type = typename Traits::weight_type;
+
+    index_type  u;  /**< G.Vに属する頂点u */
+    weight_type d;  /**< 始点sからの距離d */
+
+    /**< @brief <演算子オーバーロード */
+    bool operator < (const basic_state& s) const { return d > s.d; } // NOTE : min優先度付きキューのためにREVERSE
+
+    basic_state() = default;
+    basic_state(index_type u, weight_type d) : u(u), d(d) {}
+};
+
+using state = basic_state<default_traits>;  /**< 既定の特性による要素 */
+
+
+/**
+ * @brief  DECREASE-KEY操作を持つ添字付きd分minヒープ
+ *
+ * @note   ヒープに置くことのできる頂点は0, 1, ..., n-1であり、各頂点は高々1つしかヒープに置かれない
+ *         push(v, d)はvがヒープに置かれていなければ挿入し、置かれていてキーがdより大きければキーをdに減らす
+ *         したがって、std::priority_queue<state>のemplace(v, d)と同じ形で呼び出せ、relax_with_heapにそのまま渡すことができる
+ *
+ * @tparam D      各節点の子の数(アリティ). コンパイル時に決まる
+ * @tparam Traits 添字と重みの型を与える特性(graph_traits)
+ */
+template<std::size_t D = 4, class Traits = default_traits>
+struct dary_heap {
+    static_assert(D >= 2, "the arity of a d-ary heap must be at least 2");
+
+    using index_type  = typename Traits::index_type;
+    using weight_type = typename Traits::weight_type;
+    using state       = basic_state<Traits>;
+
+    std::vector<state>      heap;  /**< ヒープ配列 */
+    std::vector<index_type> pos;   /**< 頂点vのヒープ配列での位置(ヒープに置かれていなければNIL) */
+
+    explicit dary_heap(std::size_t n = 0) : pos(n, Traits::nil()) {}
+
+    /**< @brief 置くことのできる頂点の数をnに変更し、ヒープを空にする */
+    void resize(std::size_t n) { heap.clear(); pos.assign(n, Traits::nil()); }
+
+    bool empty() const { return heap.empty(); }
+    std::size_t size() const { return heap.size(); }
+
+    /**< @brief ヒープを空にする. 置かれていた要素の数に比例する時間で済む */
+    void clear()
+    {
+        for (auto&& x : heap) { pos[x.u] = Traits::nil(); }
+        heap.clear();
+    }
+
+    /**< @brief 頂点vがヒープに置かれているか？ */
+    bool contains(index_type v) const { return pos[v] != Traits::nil(); }
+
+    /**< @brief ヒープに置かれている頂点vのキーを返す */
+    weight_type key(index_type v) const { return heap[pos[v]].d; }
+
+    /**< @brief 最小のキーを持つ要素を返す */
+    const state& top() const { return heap.front(); }
+
+    /**< @brief 最小のキーを持つ要素を取り除く */
+    void pop()
+    {
+        GRAPH_STAT_ADD(heap_pops, 1);
+        pos[heap.front().u] = Traits::nil();
+        state last = heap.back(); heap.pop_back();
+        if (!heap.empty()) { sift_down(0, last); }
+    }
+
+    /**
+     * @brief  頂点vをキーdで挿入する. すでに置かれている場合はキーをdに減らす(DECREASE-KEY)
+     * @return 挿入またはキーの減少が行われたか？(すでに置かれていてキーがd以下ならばfalse)
+     */
+    bool push(index_type v, weight_type d)
+    {
+        if (pos[v] == Traits::nil()) {
+            heap.emplace_back();
+            sift_up(heap.size() - 1, state(v, d));
+            GRAPH_STAT_ADD(heap_pushes, 1);
+            GRAPH_STAT_MAX(heap_peak, heap.size());
+            return true;
+        }
+        std::size_t i = pos[v];
+        if (d >= heap[i].d) { return false; }
+        sift_up(i, state(v, d));
+        GRAPH_STAT_ADD(heap_decrease_keys, 1);
+        return true;
+    }
+
+    /**< @brief push(v, d)と同じ. std::priority_queueと同じ名前で呼び出すために用意する */
+    void emplace(index_type v, weight_type d) { push(v, d); }
+
+private:
+    /**< @brief 穴iに要素xを置き、親より小さい間は穴を上に移動する */
+    void sift_up(std::size_t i, state x)
+    {
+        while (i > 0) {
+            std::size_t p = (i - 1) / D;
+            if (heap[p].d <= x.d) { break; }
+            place(i, heap[p]);
+            i = p;
+        }
+        place(i, x);
+    }
+
+    /**< @brief 穴iに要素xを置き、最小の子より大きい間は穴を下に移動する */
+    void sift_down(std::size_t i, state x)
+    {
+        std::size_t n = heap.size();
+        while (true) {
+            std::size_t c = D * i + 1;
+            if (c >= n) { break; }
+            std::size_t last = c + D < n ? c + D : n, m = c;
+            for (++c; c < last; ++c) {
+                if (heap[c].d < heap[m].d) { m = c; }
+            }
+            if (x.d <= heap[m].d) { break; }
+            place(i, heap[m]);
+            i = m;
+        }
+        place(i, x);
+    }
+
+    void place(std::size_t i, const state& x) { heap[i] = x; pos[x.u] = static_cast<index_type>(i); }
+};
+
+
+
+/**
+ * @brief  非負整数のキーを持つ単調な基数ヒープ(radix heap)
+ *
+ * @note   挿入するキーは、最後に取り出したキー以上でなければならない
+ *         バケットiには、lastとの排他的論理和の最上位ビットが第(i - 1)ビットであるキーを置く(バケット0にはキーがlastに等しいものを置く)
+ *         バケット0が空になると、空でない最小のバケットの最小キーを新しいlastとして、そのバケットの要素をより小さいバケットに振り分け直す
+ */
+struct radix_heap {
+    static constexpr int bits = std::numeric_limits<std::uint32_t>::digits;
+
+    std::vector<state> bucket[bits + 1];  /**< バケット */
+    std::uint32_t      last  = 0;         /**< 最後に取り出したキー */
+    std::size_t        count = 0;         /**< 要素の数 */
+
+    radix_heap() = default;
+    explicit radix_heap(std::size_t) {}
+
+    bool empty() const { return count == 0; }
+    std::size_t size() const { return count; }
+
+    /**
+     * @brief  最小のキーを持つ要素を返す
+     * @note   lastの更新はここまで遅らせる. pop()の直後に更新すると、取り出した頂点から緩和されたキーがlastより小さくなりうる
+     */
+    const state& top()
+    {
+        if (bucket[0].empty()) { pull(); }
+        return bucket[0].back();
+    }
+
+    /**< @brief 最小のキーを持つ要素を取り除く. 直前にtop()を呼んでいなければならない */
+    void pop() { bucket[0].pop_back(); --count; GRAPH_STAT_ADD(heap_pops, 1); }
+
+    /**< @brief 頂点vをキーdで挿入する. dは最後に取り出したキー以上でなければならない */
+    void emplace(index_t v, weight_t d)
+    {
+        bucket[index(static_cast<std::uint32_t>(d))].emplace_back(v, d); ++count;
+        GRAPH_STAT_ADD(heap_pushes, 1);
+        GRAPH_STAT_MAX(heap_peak, count);
+    }
+    void push(index_t v, weight_t d) { emplace(v, d); }
+
+private:
+    /**< @brief キーxを置くバケットの番号を返す */
+    int index(std::uint32_t x) const
+    {
+        std::uint32_t y = x ^ last;
+#if defined(__GNUC__)
+        return y == 0 ? 0 : bits - __builtin_clz(y);
+#else
+        int i = 0;
+        while (y != 0) { y >>= 1; ++i; }
+        return i;
+#endif
+    }
+
+    /**< @brief 空でない最小のバケットの要素を振り分け直し、バケット0を空でなくする */
+    void pull()
+    {
+        int i = 1;
+        while (bucket[i].empty()) { ++i; }
+        std::uint32_t m = static_cast<std::uint32_t>(bucket[i].front().d);
+        for (auto&& x : bucket[i]) { m = std::min(m, static_cast<std::uint32_t>(x.d)); }
+        last = m;
+        for (auto&& x : bucket[i]) { bucket[index(static_cast<std::uint32_t>(x.d))].push_back(x); }
+        bucket[i].clear();
+    }
+};
+
+
+/**
+ * @brief  非負整数のキーを持つDialのバケット(Dial's bucket queue)
+ *
+ * @note   挿入するキーは、最後に取り出したキーlast以上last + C以下でなければならない. Cは構築時に与える最大の辺重みである
+ *         キーdの要素をバケットd mod (C + 1)に置き、取り出すときは現在のバケットから順に空でないバケットを探す
+ */
+struct bucket_queue {
+    std::vector<std::vector<state>> bucket;  /**< C + 1個のバケット */
+    weight_t    last  = 0;                   /**< 現在のバケットのキー */
+    std::size_t count = 0;                   /**< 要素の数 */
+
+    explicit bucket_queue(weight_t C = 0) : bucket(static_cast<std::size_t>(C) + 1) {}
+
+    bool empty() const { return count == 0; }
+    std::size_t size() const { return count; }
+
+    /**< @brief 最小のキーを持つ要素を返す. 基数ヒープと同じ理由で、lastはここで進める */
+    const state& top()
+    {
+        while (bucket[slot(last)].empty()) { ++last; }
+        return bucket[slot(last)].back();
+    }
+
+    /**< @brief 最小のキーを持つ要素を取り除く. 直前にtop()を呼んでいなければならない */
+    void pop() { bucket[slot(last)].pop_back(); --count; GRAPH_STAT_ADD(heap_pops, 1); }
+
+    /**< @brief 頂点vをキーdで挿入する. dはlast以上last + C以下でなければならない */
+    void emplace(index_t v, weight_t d)
+    {
+        bucket[slot(d)].emplace_back(v, d); ++count;
+        GRAPH_STAT_ADD(heap_pushes, 1);
+        GRAPH_STAT_MAX(heap_peak, count);
+    }
+    void push(index_t v, weight_t d) { emplace(v, d); }
+
+private:
+    std::size_t slot(weight_t d) const { return static_cast<std::size_t>(d) % bucket.size(); }
+};
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**
+ * @brief  頂点数nのグラフに対するmin優先度付きキューを生成する
+ * @note   dary_heapは位置配列のために頂点数を必要とするが、std::priority_queueは必要としないので、その違いをここで吸収する
+ */
+template<class PriorityQueue>
+inline PriorityQueue make_priority_queue(std::size_t n) { return PriorityQueue(n); }
+
+template<>
+inline std::priority_queue<state> make_priority_queue<std::priority_queue<state>>(std::size_t) { return { }; }
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
+
+
+
+#endif  // end of HEAP_HPP
@@ -0,0 +1,117 @@
+/**
+ * @brief  ファイルを読み取り専用のメモリとして扱う
+ *
+ * @note   POSIXの環境ではファイルをmmapし、その他の環境ではファイル全体を読み込んだ配列を用いる
+ *         どちらの場合も、メモリはkeeperの参照がすべてなくなったときに解放される. buffer<T>::borrowに渡せば、ファイルの上に
+ *         配列を直接構成できる(snapshot/snapshot.hpp). 先頭は少なくとも16バイト境界に揃っている
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "graph.hpp"
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define GRAPH_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief 読み取り専用で写像したファイル
+ */
+struct mapped_file {
+    const char*                 data = nullptr;  /**< ファイルの先頭 */
+    std::size_t                 size = 0;        /**< ファイルの大きさ[byte] */
+    std::shared_ptr<const void> keeper;          /**< メモリの持ち主. 最後の参照がなくなると写像を解除する */
+};
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**
+ * @brief  ファイルpathを読み取り専用で写像し、Fとする
+ * @note   ファイルが空ならば、F.size = 0として成功する
+ * @return 成功したか？
+ */
+inline bool map_file(const std::string& path, mapped_file& F)
+{
+#if defined(GRAPH_HAS_MMAP)
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) { return false; }
+    struct stat st;
+    if (::fstat(fd, &st) != 0) { ::close(fd); return false; }
+    const std::size_t size = static_cast<std::size_t>(st.st_size);
+    if (size == 0) { ::close(fd); F = mapped_file(); return true; }
+    void* addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // 写像した後はファイル記述子を閉じてよい
+    if (addr == MAP_FAILED) { return false; }
+    F.keeper = std::shared_ptr<const void>(addr, [size](const void* p) { ::munmap(const_cast<void*>(p), size); });
+    F.data = static_cast<const char*>(addr);
+    F.size = size;
+    return true;
+#else
+    std::FILE* fp = std::fopen(path.c_str(), "rb");
+    if (!fp) { return false; }
+    auto bytes = std::make_shared<std::vector<char>>();
+    char chunk[1 << 16];
+    for (std::size_t k; (k = std::fread(chunk, 1, sizeof(chunk), fp)) > 0; ) { bytes->insert(bytes->end(), chunk, chunk + k); }
+    bool ok = !std::ferror(fp);
+    std::fclose(fp);
+    if (!ok) { return false; }
+    F.data = bytes->data();
+    F.size = bytes->size();
+    F.keeper = std::move(bytes);
+    return true;
+#endif
+}
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
+
+
+
+#endif  // end of MAPPED_FILE_HPP
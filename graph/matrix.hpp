@@ -0,0 +1,171 @@
+/**
+ * @brief  1本の整列された領域に格納する密な行列(隣接行列および表行列)を扱う
+ *
+ * @note   matrix_tはarray_tのvectorなので、n x nの行列を作るとn + 1回の動的確保が起こり、各行はメモリ上に散らばる
+ *         dense_matrixはn x mの要素を1回の確保で行優先(row-major)に並べる. 各行の先頭がalignmentバイト境界に揃うように、
+ *         行の幅strideを列数mからalignment / sizeof(weight_t)の倍数に切り上げる. したがって、各行はSIMD命令でそのまま読み書きできる
+ *
+ * @note   M[i]は第i行を表す範囲(row_view)を返すので、M[i][j]の形で書かれたアルゴリズムはmatrix_tとdense_matrixのどちらに対しても同じように動作する
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef MATRIX_HPP
+#define MATRIX_HPP
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "graph.hpp"
+#include <cstddef>
+#include <algorithm>
+#include <memory>
+#include <new>
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief 行列の1行を表す範囲
+ */
+template<class T>
+struct row_view {
+    T*          p;  /**< 行の先頭 */
+    std::size_t n;  /**< 列数 */
+
+    T& operator [] (std::size_t j) const { return p[j]; }
+    T* begin() const { return p; }
+    T* end()   const { return p + n; }
+    T* data()  const { return p; }
+    std::size_t size() const { return n; }
+};
+
+
+/**
+ * @brief 1本の整列された領域に行優先で格納したrows x colsの密な行列
+ */
+struct dense_matrix {
+    static constexpr std::size_t alignment = 64;  /**< 各行の先頭を揃える境界(キャッシュラインおよびAVX-512のレジスタ幅) */
+
+    dense_matrix() = default;
+
+    /**< @brief すべての要素をxとするrows x colsの行列を生成する */
+    dense_matrix(std::size_t rows, std::size_t cols, weight_t x = 0)
+        : rows_(rows), cols_(cols), stride_(round_up(cols)), buf(allocate(rows * stride_))
+    {
+        std::fill_n(buf.get(), rows_ * stride_, x);
+    }
+
+    /**< @brief matrix_tから変換する */
+    explicit dense_matrix(const matrix_t& M) : dense_matrix(M.size(), M.empty() ? 0 : M[0].size())
+    {
+        for (std::size_t i = 0; i < rows_; ++i) { std::copy(M[i].begin(), M[i].end(), (*this)[i].begin()); }
+    }
+
+    dense_matrix(const dense_matrix& M) : rows_(M.rows_), cols_(M.cols_), stride_(M.stride_), buf(allocate(rows_ * stride_))
+    {
+        std::copy_n(M.buf.get(), rows_ * stride_, buf.get());
+    }
+    dense_matrix(dense_matrix&&) noexcept = default;
+    dense_matrix& operator = (const dense_matrix& M) { if (this != &M) { *this = dense_matrix(M); } return *this; }
+    dense_matrix& operator = (dense_matrix&&) noexcept = default;
+
+    std::size_t size()   const { return rows_; }    /**< @brief 行数を返す(matrix_tのsize()に合わせる) */
+    std::size_t rows()   const { return rows_; }
+    std::size_t cols()   const { return cols_; }
+    std::size_t stride() const { return stride_; }  /**< @brief 隣り合う行の先頭の間隔(要素数) */
+
+    /**< @brief 行列の先頭(第0行の先頭)を返す */
+    weight_t*       data()       { return buf.get(); }
+    const weight_t* data() const { return buf.get(); }
+
+    /**< @brief 第i行を返す */
+    row_view<weight_t>       operator [] (std::size_t i)       { return { buf.get() + i * stride_, cols_ }; }
+    row_view<const weight_t> operator [] (std::size_t i) const { return { buf.get() + i * stride_, cols_ }; }
+
+    /**< @brief matrix_tに変換する */
+    matrix_t to_matrix() const
+    {
+        matrix_t M(rows_, array_t(cols_));
+        for (std::size_t i = 0; i < rows_; ++i) { std::copy((*this)[i].begin(), (*this)[i].end(), M[i].begin()); }
+        return M;
+    }
+
+    bool operator == (const dense_matrix& M) const
+    {
+        if (rows_ != M.rows_ || cols_ != M.cols_) { return false; }
+        for (std::size_t i = 0; i < rows_; ++i) {
+            if (!std::equal((*this)[i].begin(), (*this)[i].end(), M[i].begin())) { return false; }
+        }
+        return true;
+    }
+    bool operator != (const dense_matrix& M) const { return !(*this == M); }
+
+private:
+    struct deleter {
+        void operator () (weight_t* p) const { ::operator delete(p, std::align_val_t(alignment)); }
+    };
+
+    static std::size_t round_up(std::size_t cols)
+    {
+        constexpr std::size_t k = alignment / sizeof(weight_t);
+        return (cols + k - 1) / k * k;
+    }
+
+    static weight_t* allocate(std::size_t count)
+    {
+        if (count == 0) { return nullptr; }
+        return static_cast<weight_t*>(::operator new(count * sizeof(weight_t), std::align_val_t(alignment)));
+    }
+
+    std::size_t rows_ = 0, cols_ = 0, stride_ = 0;
+    std::unique_ptr<weight_t[], deleter> buf;
+};
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**
+ * @brief  すべての要素をxとするn x nの行列を生成する
+ * @note   matrix_tとdense_matrixのどちらを用いるかをテンプレート引数で選ぶアルゴリズムのために、生成の違いをここで吸収する
+ */
+template<class Matrix>
+inline Matrix make_matrix(std::size_t n, weight_t x = 0) { return Matrix(n, n, x); }
+
+template<>
+inline matrix_t make_matrix<matrix_t>(std::size_t n, weight_t x) { return matrix_t(n, array_t(n, x)); }
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
+
+
+
+#endif  // end of MATRIX_HPP
@@ -0,0 +1,125 @@
+/**
+ * @brief  並列アルゴリズムで用いるスレッドの起動と同期に関する物置
+ *
+ * @note   並列版のアルゴリズムはスレッド数threadsを引数に取る. threads = 0のときはstd::thread::hardware_concurrency()を用いる
+ *         parallel_run(threads, f)は呼び出したスレッドを含むthreads本のスレッドでf(tid)を実行し、すべての終了を待つ
+ *         スレッドは呼び出しごとに生成するので、段(level)ごとに同期が必要なアルゴリズムはparallel_runの中でbarrierを用いること
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "graph.hpp"
+#include <cstddef>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief  threads本のスレッドが揃うまで待ち合わせる再利用可能なバリア
+ * @note   最後に到着したスレッドが世代generationを進め、待っているスレッドを起こす
+ */
+struct barrier {
+    explicit barrier(std::size_t threads) : threads(threads) {}
+
+    /**< @brief すべてのスレッドが到着するまで待つ */
+    void arrive_and_wait()
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        std::size_t gen = generation;
+        if (++waiting == threads) {
+            waiting = 0; ++generation;
+            cv.notify_all();
+            return;
+        }
+        cv.wait(lock, [&] { return gen != generation; });
+    }
+
+private:
+    std::mutex              mtx;
+    std::condition_variable cv;
+    std::size_t             threads, waiting = 0, generation = 0;
+};
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**< @brief スレッド数threadsを解決する. 0ならばハードウェアの並列度を用いる */
+inline unsigned resolve_threads(unsigned threads)
+{
+    if (threads == 0) { threads = std::thread::hardware_concurrency(); }
+    return std::max(threads, 1u);
+}
+
+
+/**
+ * @brief  threads本のスレッドでf(tid)を実行し、すべての終了を待つ(tid = 0, 1, ..., threads - 1)
+ * @note   tid = 0は呼び出したスレッドで実行する
+ */
+template<class F>
+void parallel_run(unsigned threads, F f)
+{
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (unsigned tid = 1; tid < threads; ++tid) { workers.emplace_back(f, tid); }
+    f(0u);
+    for (auto&& t : workers) { t.join(); }
+}
+
+
+/**
+ * @brief  区間[0, n)をthreads個のほぼ等しいブロックに分け、各スレッドでf(i)を実行する
+ */
+template<class F>
+void parallel_for(std::size_t n, unsigned threads, F f)
+{
+    threads = static_cast<unsigned>(std::min<std::size_t>(threads, std::max<std::size_t>(n, 1)));
+    parallel_run(threads, [&](unsigned tid) {
+        std::size_t first = n * tid / threads, last = n * (tid + 1) / threads;
+        for (std::size_t i = first; i < last; ++i) { f(i); }
+    });
+}
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
+
+
+
+#endif  // end of PARALLEL_HPP
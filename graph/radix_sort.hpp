@@ -0,0 +1,116 @@
+/**
+ * @brief  32ビット整数のキーによる並列の基数ソート(radix sort)を扱う
+ *
+ * @note   LSD(Least Significant Digit)基数ソートは、キーを8ビットずつの4桁に分け、下の桁から順に各桁について安定な計数ソートを行う
+ *         比較を行わないので、要素数nに対してΘ(n)時間で整列できる. ある桁の値がすべての要素で等しければ、その桁の計数ソートは省く
+ *
+ *         各桁の計数ソートは、配列をthreads個のブロックに分けて並列に行う
+ *           1. 各スレッドが自分のブロックの桁の値の度数を数える
+ *           2. 桁の値dとスレッドtidの順に度数を累積し、スレッドtidが値dの要素を書き込む開始位置を決める
+ *           3. 各スレッドが自分のブロックの要素を先頭から順に書き込む
+ *         ブロックの順と各ブロックの中の順が保たれるので、計数ソートは安定である
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef RADIX_SORT_HPP
+#define RADIX_SORT_HPP
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "graph.hpp"
+#include "parallel.hpp"
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**< @brief 符号付き整数xを、大小関係を保ったまま符号なし整数に写す(符号ビットを反転する) */
+inline std::uint32_t radix_key(std::int32_t x) { return static_cast<std::uint32_t>(x) ^ 0x80000000u; }
+
+
+/**
+ * @brief  配列aをキーkey(a[i])の非減少順に安定に整列する
+ * @note   要素が少ないときはスレッドを起動する費用の方が大きいので、1スレッドあたりgrain個以上の要素があるようにスレッド数を減らす
+ *
+ * @tparam T       要素の型
+ * @tparam Key     要素から32ビットの符号なし整数のキーを求める関数オブジェクトの型
+ * @param  unsigned threads  スレッド数(0ならばハードウェアの並列度)
+ */
+template<class T, class Key>
+void radix_sort(std::vector<T>& a, Key key, unsigned threads = 0)
+{
+    constexpr std::size_t radix = 256, grain = 1 << 16;
+    const std::size_t n = a.size();
+    if (n < 2) { return; }
+    threads = static_cast<unsigned>(std::min<std::size_t>(resolve_threads(threads), std::max<std::size_t>(n / grain, 1)));
+
+    std::vector<T> b(n);
+    std::vector<std::array<std::size_t, radix>> count(threads);
+    bool skip = false;
+    barrier sync(threads);
+
+    parallel_run(threads, [&](unsigned tid) {
+        const std::size_t first = n * tid / threads, last = n * (tid + 1) / threads;
+        for (unsigned shift = 0; shift < 32; shift += 8) {
+            auto& C = count[tid];
+            C.fill(0);
+            for (std::size_t i = first; i < last; ++i) { ++C[key(a[i]) >> shift & (radix - 1)]; }
+            sync.arrive_and_wait();
+
+            if (tid == 0) {  // 値dの要素をスレッドtidが書き込む開始位置を決める
+                std::size_t sum = 0;
+                skip = false;
+                for (std::size_t d = 0; d < radix; ++d) {
+                    std::size_t k = 0;
+                    for (auto&& c : count) { k += c[d]; }
+                    if (k == n) { skip = true; }  // すべての要素の桁の値が等しい
+                    for (auto&& c : count) { std::size_t x = c[d]; c[d] = sum; sum += x; }
+                }
+            }
+            sync.arrive_and_wait();
+            if (skip) { continue; }
+
+            for (std::size_t i = first; i < last; ++i) { b[C[key(a[i]) >> shift & (radix - 1)]++] = a[i]; }
+            sync.arrive_and_wait();
+            if (tid == 0) { a.swap(b); }
+            sync.arrive_and_wait();
+        }
+    });
+}
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
+
+
+
+#endif  // end of RADIX_SORT_HPP
@@ -94,7 +94,9 @@
 //****************************************
 
 #include "graph.hpp"
-#include <functional>
+#include "soa.hpp"
+#include "workspace.hpp"
+#include "stats.hpp"
 
 
 
@@ -170,29 +172,34 @@ static inline void initialize_single_source_with_visitor(vertices_t& V, index_t
  * @param  index_t u       辺(u, v)の始点u (ただし、u ∈ V)
  * @param  index_t v       辺(u, v)の終点v (ただし、v ∈ V)
  * @param  weight_t w      辺(u, v)の重みw
+ * @tparam Predicate       述語の型. 関数オブジェクトを直接受け取るので、呼び出しは展開(inline)される
  * @param  Predicate pred  relax可能な前提条件を記述した述語
  */
-static void relax(vertices_t& V,
+template<class Predicate>
+inline void relax(vertices_t& V,
            index_t u, index_t v, weight_t w,
-           std::function<bool(const vertices_t&, index_t)> pred)
+           Predicate pred)
 {
+    GRAPH_STAT_ADD(edges_scanned, 1);
     if (pred(V, u) && V[v].d > V[u].d + w) {
         V[v].d = V[u].d + w;
         V[v].pi = u;
+        GRAPH_STAT_ADD(relaxations, 1);
     }
 }
 
 
 // オーバーロードされたrelax関数群
 
-static inline void relax(vertices_t& V, const edge& e,
-           std::function<bool(const vertices_t&, index_t)> pred)
+template<class Predicate>
+inline void relax(vertices_t& V, const edge& e, Predicate pred)
 {
     relax(V, e.src, e.dst, e.w, pred);
 }
-static inline void relax(vertices_t& V, const matrix_t& W,
+template<class Predicate>
+inline void relax(vertices_t& V, const matrix_t& W,
            index_t u, index_t v,
-           std::function<bool(const vertices_t&, index_t)> pred)
+           Predicate pred)
 {
     relax(V, u, v, W[u][v], pred);
 }
@@ -201,7 +208,8 @@ static inline void relax(vertices_t& V, const matrix_t& W,
 /**
  * @brief  辺(u, v)を緩和すると同時に、頂点vおよび道s~>vの重みをmin優先度付きキューQに挿入する
  * 
- * @tparam PriorityQueue min優先度付きキューの型
+ * @tparam PriorityQueue min優先度付きキューの型. emplace(v, d)を持つもの(std::priority_queue<state>またはdary_heap<D>)
+ *                       dary_heapを渡した場合、vがすでにキューに置かれていればemplaceはDECREASE-KEYとして働く
  * @param vertices_t&    V 頂点集合V
  * @param const edge&    e 辺(u, v)
  * @param PriorityQueue& Q min優先度付きキュー
@@ -210,11 +218,127 @@ template<class PriorityQueue>
 void relax_with_heap(vertices_t& V, const edge& e, PriorityQueue& Q)
 {
     index_t u = e.src, v = e.dst;
+    GRAPH_STAT_ADD(edges_scanned, 1);
     if (V[v].color != vcolor::black && V[v].d > V[u].d + e.w) {
         V[v].d     = V[u].d + e.w;
         V[v].pi    = u;
         V[v].color = vcolor::gray;
         Q.emplace(v, V[v].d);
+        GRAPH_STAT_ADD(relaxations, 1);
+    }
+}
+
+
+
+// 配列の構造体vertices_soaに対する初期化と緩和の関数群
+// d値、π値、色を別々の配列で持つので、それぞれの走査は必要な配列だけに触れる
+
+/**
+ * @brief  Θ(V)の手続きによって最短路推定値と先行点を初期化する
+ * @note   初期化の後、すべてのv ∈ Vについてv.π = NIL、すべてのv ∈ V - {s}についてv.d = ∞である
+ */
+template<class Traits>
+inline void initialize_single_source(basic_vertices_soa<Traits>& S, typename Traits::index_type s)
+{
+    std::fill(S.d.begin(), S.d.end(), Traits::inf());
+    std::fill(S.pi.begin(), S.pi.end(), Traits::nil());
+    S.d[s] = 0;
+}
+
+
+/**
+ * @brief  Θ(V)の手続きによって最短路推定値と先行点および頂点色を初期化する
+ * @note   初期化の後、すべてのv ∈ Vについてv.π = NIL、
+ *         すべてのv ∈ V - {s}についてv.d = ∞、 v.color = WHITEである
+ */
+template<class Traits>
+inline void initialize_single_source_with_color(basic_vertices_soa<Traits>& S, typename Traits::index_type s)
+{
+    initialize_single_source(S, s);
+    std::fill(S.state.begin(), S.state.end(), static_cast<std::uint8_t>(vcolor::white));
+    S.paint(s, vcolor::gray);
+}
+
+
+/**
+ * @brief  辺(u, v)を緩和する
+ * @param  basic_vertices_soa<Traits>& S  頂点集合V
+ * @param  const basic_edge<Traits>&   e  辺(u, v)
+ * @param  Predicate                pred  relax可能な前提条件を記述した述語pred(S, u)
+ * @return v.dを減らしたか？
+ */
+template<class Traits, class Predicate>
+inline bool relax(basic_vertices_soa<Traits>& S, const basic_edge<Traits>& e, Predicate pred)
+{
+    auto u = e.src, v = e.dst;
+    GRAPH_STAT_ADD(edges_scanned, 1);
+    if (pred(S, u) && S.d[v] > S.d[u] + e.w) {
+        S.d[v]  = S.d[u] + e.w;
+        S.pi[v] = u;
+        GRAPH_STAT_ADD(relaxations, 1);
+        return true;
+    }
+    return false;
+}
+
+
+/**
+ * @brief  辺(u, v)を緩和すると同時に、頂点vおよび道s~>vの重みをmin優先度付きキューQに挿入する
+ *
+ * @tparam PriorityQueue min優先度付きキューの型. emplace(v, d)を持つもの(std::priority_queue<state>またはdary_heap<D>)
+ *                       dary_heapを渡した場合、vがすでにキューに置かれていればemplaceはDECREASE-KEYとして働く
+ * @param basic_vertices_soa<Traits>& S 頂点集合V
+ * @param const basic_edge<Traits>&   e 辺(u, v)
+ * @param PriorityQueue&              Q min優先度付きキュー
+ */
+template<class Traits, class PriorityQueue>
+void relax_with_heap(basic_vertices_soa<Traits>& S, const basic_edge<Traits>& e, PriorityQueue& Q)
+{
+    auto u = e.src, v = e.dst;
+    GRAPH_STAT_ADD(edges_scanned, 1);
+    if (S.color(v) != vcolor::black && S.d[v] > S.d[u] + e.w) {
+        S.d[v]  = S.d[u] + e.w;
+        S.pi[v] = u;
+        S.paint(v, vcolor::gray);
+        Q.emplace(v, S.d[v]);
+        GRAPH_STAT_ADD(relaxations, 1);
+    }
+}
+
+
+
+// 作業領域search_workspaceに対する初期化と緩和の関数群
+// 頂点の属性は最初に触れたときに初期化されるので、初期化はΘ(V)ではなくΟ(1)時間で済む
+
+/**
+ * @brief  最短路推定値と先行点および頂点色を初期化する
+ * @note   新しい問い合わせを始めるだけなので、Θ(V)ではなくΟ(1)時間で済む. 初期化の後の性質はvertices_soaの場合と同じである
+ */
+static inline void initialize_single_source_with_color(search_workspace& W, index_t s)
+{
+    W.clear();
+    W.paint(s, vcolor::gray);
+    W.d[s] = 0;
+}
+
+
+/**
+ * @brief  辺(u, v)を緩和すると同時に、頂点vおよび道s~>vの重みをmin優先度付きキューQに挿入する
+ * @note   vに初めて触れたときは、vの属性を初期値に戻してから緩和する
+ */
+template<class PriorityQueue>
+void relax_with_heap(search_workspace& W, const edge& e, PriorityQueue& Q)
+{
+    index_t u = e.src, v = e.dst;
+    GRAPH_STAT_ADD(edges_scanned, 1);
+    if (W.color(v) == vcolor::black) { return; }
+    W.touch(v);
+    if (W.d[v] > W.d[u] + e.w) {
+        W.d[v]  = W.d[u] + e.w;
+        W.pi[v] = u;
+        W.paint(v, vcolor::gray);
+        Q.emplace(v, W.d[v]);
+        GRAPH_STAT_ADD(relaxations, 1);
     }
 }
 
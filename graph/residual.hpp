@@ -0,0 +1,158 @@
+/**
+ * @brief  最大フロー問題で用いる疎な残余ネットワーク(residual network)を扱う
+ *
+ * @note   残余ネットワークGfの辺はEの辺かその逆向きの辺であり、|Ef| <= 2|E|である
+ *         容量とフローをV x Vの行列に持つと、辺の少ないネットワークでもΘ(V^2)の記憶量が必要になる
+ *
+ *         residual_networkは、各辺(u, v) ∈ Eについて残余辺(u, v)と逆向きの残余辺(v, u)を対にして格納し、
+ *         各残余辺aには逆向きの残余辺の添字rev[a]と残余容量cf[a]を持たせる. フローを残余辺aに沿ってxだけ増やすには
+ *           cf[a] -= x, cf[rev[a]] += x
+ *         とすればよい. 残余辺はCSR表現と同様に始点ごとに区間[offset[u], offset[u + 1])に並べるので、記憶量はΘ(V + E)である
+ *
+ * @note   add_edgeで加えた辺は、最初に残余辺を参照したとき(build())にCSR表現へ並べ直す. その後に辺を加えると、
+ *         それまでのフローを保ったまま並べ直す. k番目に加えた辺の順方向の残余辺の位置はpos[k]で分かる
+ *         set_capacityで容量を変更したときも、フローは容量を超えない範囲で保たれる. したがって、解いた後のネットワークを少し変えて
+ *         解き直すときは、それまでのフローから増加可能経路を探せばよい
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef RESIDUAL_HPP
+#define RESIDUAL_HPP
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "graph.hpp"
+#include <cstddef>
+#include <algorithm>
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief 対になった残余辺の配列で表した残余ネットワークGf
+ */
+struct residual_network {
+    edges_t   E;       /**< 加えた辺(u, v)とその容量c(u, v) */
+    indices_t offset;  /**< 頂点uから出る残余辺の開始位置 */
+    indices_t dst;     /**< 残余辺aの終点 */
+    indices_t rev;     /**< 残余辺aの逆向きの残余辺の添字 */
+    array_t   cf;      /**< 残余辺aの残余容量 */
+    indices_t pos;     /**< k番目に加えた辺の順方向の残余辺の添字 */
+
+    explicit residual_network(std::size_t n = 0) : offset(n + 1, 0), n(static_cast<index_t>(n)) {}
+
+    /**< @brief 頂点数|V|を返す */
+    index_t size() const { return n; }
+
+    /**< @brief 加えた辺の数|E|を返す */
+    index_t edge_count() const { return static_cast<index_t>(E.size()); }
+
+    /**
+     * @brief  容量capの辺(u, v)を加え、その番号kを返す
+     * @note   辺(u, v)の残余辺の対を作る. 順方向の残余容量はcap、逆方向の残余容量は0である
+     */
+    index_t add_edge(index_t u, index_t v, capacity_t cap)
+    {
+        E.emplace_back(u, v, cap);
+        built = false;
+        return static_cast<index_t>(E.size()) - 1;
+    }
+
+    /**< @brief 加えた辺を残余辺の配列に並べる. すでに流れているフローは保たれる */
+    void build()
+    {
+        if (built) { return; }
+        index_t m = edge_count();
+        array_t flow(m, 0);
+        for (index_t k = 0; k < static_cast<index_t>(pos.size()); ++k) { flow[k] = E[k].c - cf[pos[k]]; }
+
+        offset.assign(n + 1, 0);
+        for (auto&& e : E) { ++offset[e.src + 1]; ++offset[e.dst + 1]; }
+        for (index_t u = 0; u < n; ++u) { offset[u + 1] += offset[u]; }
+        indices_t next(offset.begin(), offset.end() - 1);
+        dst.resize(2 * m); rev.resize(2 * m); cf.resize(2 * m); pos.resize(m);
+        for (index_t k = 0; k < m; ++k) {
+            const edge& e = E[k];
+            index_t a = next[e.src]++, b = next[e.dst]++;
+            dst[a] = e.dst; rev[a] = b; cf[a] = e.c - flow[k];
+            dst[b] = e.src; rev[b] = a; cf[b] = flow[k];
+            pos[k] = a;
+        }
+        built = true;
+    }
+
+    /**< @brief 残余辺aに沿ってフローをxだけ増やす */
+    void push(index_t a, capacity_t x) { cf[a] -= x; cf[rev[a]] += x; }
+
+    /**< @brief k番目に加えた辺のフローf(u, v)を返す */
+    capacity_t flow(index_t k) const { return E[k].c - cf[pos[k]]; }
+
+    /**< @brief 頂点sからの正味の流出量(フローの値|f|)を返す */
+    capacity_t value(index_t s) const
+    {
+        capacity_t x = 0;
+        for (index_t k = 0; k < static_cast<index_t>(pos.size()); ++k) {
+            if (E[k].src == s) { x += flow(k); }
+            if (E[k].dst == s) { x -= flow(k); }
+        }
+        return x;
+    }
+
+    /**
+     * @brief  k番目に加えた辺の容量をcapに変更する. 流れているフローは容量を超えない範囲で保たれる
+     * @return 容量を超えたために辺から取り除いたフローの量. 始点には同じ量の超過が、終点には同じ量の不足が生じる
+     */
+    capacity_t set_capacity(index_t k, capacity_t cap)
+    {
+        build();
+        capacity_t x = flow(k), y = std::min(x, cap);
+        E[k].c = cap;
+        cf[pos[k]] = cap - y; cf[rev[pos[k]]] = y;
+        return x - y;
+    }
+
+    /**< @brief すべてのフローを0に戻す */
+    void reset()
+    {
+        build();
+        for (index_t k = 0; k < edge_count(); ++k) { cf[pos[k]] = E[k].c; cf[rev[pos[k]]] = 0; }
+    }
+
+private:
+    index_t n;           /**< 頂点数|V| */
+    bool built = true;   /**< 加えた辺がすべて残余辺の配列に並んでいるか？ */
+};
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
+
+
+
+#endif  // end of RESIDUAL_HPP
@@ -0,0 +1,120 @@
+/**
+ * @brief  頂点属性を構造体の配列(array of structures)ではなく配列の構造体(structure of arrays)として保持する
+ *
+ * @note   vertices_tは頂点vertexの配列であり、d値(key値)、π値、色(訪問済みフラグ)が同じキャッシュラインに同居している
+ *         距離だけが欲しい呼び出し元もπ値や色の分のメモリを読み書きすることになり、緩和の内側のループは3つの属性すべてに触れる
+ *
+ *         vertices_soaでは、d値、π値、色をそれぞれ別の配列d、pi、stateに格納する. 色は1頂点あたり1バイトに詰める
+ *         これにより、たとえばd値だけを走査する処理はd値の配列だけを連続して読めばよい
+ *
+ * @note   従来のvertices_tが必要な場合はto_vertices()で変換できる
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef SOA_HPP
+#define SOA_HPP
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "graph.hpp"
+#include <algorithm>
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 型シノニム
+//****************************************
+
+using states_t = std::vector<std::uint8_t>;  /**< 1バイトに詰めた頂点色vcolorの配列 */
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief  配列の構造体として保持した頂点集合V
+ * @tparam Traits 添字と重みの型を与える特性(graph_traits)
+ */
+template<class Traits>
+struct basic_vertices_soa {
+    using traits_type = Traits;
+    using index_type  = typename Traits::index_type;
+    using weight_type = typename Traits::weight_type;
+
+    std::vector<weight_type> d;      /**< 始点sからの距離(Primのアルゴリズムではkey値) */
+    std::vector<index_type>  pi;     /**< 先行頂点(の添字) */
+    states_t                 state;  /**< 頂点の色(vcolorを1バイトに詰めたもの) */
+
+    basic_vertices_soa() = default;
+    explicit basic_vertices_soa(std::size_t n) { resize(n); }
+
+    /**< @brief vertices_tから変換する */
+    explicit basic_vertices_soa(const basic_vertices_t<Traits>& V) : d(V.size()), pi(V.size()), state(V.size())
+    {
+        for (std::size_t v = 0; v < V.size(); ++v) {
+            d[v] = V[v].d; pi[v] = V[v].pi; state[v] = static_cast<std::uint8_t>(V[v].color);
+        }
+    }
+
+    /**< @brief 頂点数をnに変更する. d値は∞、π値はNIL、色は白に初期化される */
+    void resize(std::size_t n)
+    {
+        d.assign(n, Traits::inf());
+        pi.assign(n, Traits::nil());
+        state.assign(n, static_cast<std::uint8_t>(vcolor::white));
+    }
+
+    /**< @brief 頂点数|V|を返す */
+    index_type size() const { return static_cast<index_type>(d.size()); }
+
+    /**< @brief 頂点vの色を返す */
+    vcolor color(index_type v) const { return static_cast<vcolor>(state[v]); }
+
+    /**< @brief 頂点vを色cで彩色する */
+    void paint(index_type v, vcolor c) { state[v] = static_cast<std::uint8_t>(c); }
+
+    /**< @brief 従来のvertices_tに変換する */
+    basic_vertices_t<Traits> to_vertices() const
+    {
+        basic_vertices_t<Traits> V(d.size());
+        for (std::size_t v = 0; v < d.size(); ++v) {
+            V[v].d = d[v]; V[v].pi = pi[v]; V[v].color = static_cast<vcolor>(state[v]);
+        }
+        return V;
+    }
+};
+
+using vertices_soa = basic_vertices_soa<default_traits>;  /**< 既定の特性による頂点集合V */
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
+
+
+
+#endif  // end of SOA_HPP
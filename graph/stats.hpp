@@ -0,0 +1,217 @@
+/**
+ * @brief  探索とフローのアルゴリズムの内側のループで起きた事象を数える統計と、段階ごとの時間を知らせる呼び出しを扱う
+ *
+ * @note   問い合わせが遅いとき、原因がヒープの出し入れか、同じ辺の緩和のやり直しか、増加可能経路の数かを見分けるために、
+ *         アルゴリズムは次の事象を数える
+ *           edges_scanned        : relax, relax_with_heapおよびbfsで調べた辺の数
+ *           relaxations          : 上のうち、v.dを減らした(緩和に成功した)辺の数
+ *           heap_pushes          : min優先度付きキュー(dary_heap, radix_heap, bucket_queue)への挿入の数
+ *           heap_decrease_keys   : dary_heapでのDECREASE-KEYの数
+ *           heap_pops            : min優先度付きキューからの取り出しの数
+ *           heap_peak            : min優先度付きキューの要素の数の最大値
+ *           bfs_levels           : 幅優先探索bfsの段の数(始点からの最大の距離 + 1)
+ *           augmentations        : edmonds_karp::compute, ford_fulkerson::computeでフローを増やした増加可能経路の数
+ *           augmenting_path_total: それらの経路の辺の数の合計
+ *           augmenting_path_max  : それらの経路の辺の数の最大値
+ *         std::priority_queue<state>への出し入れは数えない
+ *
+ * @note   統計はGRAPH_ENABLE_STATSを定義してコンパイルしたときだけ集める. 定義しなければGRAPH_STAT_*のマクロは何もしない式になり、
+ *         アルゴリズムの機械語は統計を持たない場合と同じである(費用はない). 関数の多くは翻訳単位(.cpp)にあるので、
+ *         GRAPH_ENABLE_STATSはすべての翻訳単位で同じように定義すること
+ *
+ * @note   使い方
+ *           graph::search_stats st;
+ *           st.on_phase = [](const char* phase, double seconds) { ... };  // 省略してもよい
+ *           {
+ *               graph::stats_scope scope(st);  // このスコープの中で、このスレッドが呼んだアルゴリズムの統計をstに加える
+ *               auto V = graph::dijkstra(G, s);
+ *           }
+ *           // st.edges_scanned, st.heap_pops, ...
+ *         stats_scopeは入れ子にでき、内側のスコープが終わると外側のstに戻る. 統計はスレッドごとに集めるので、
+ *         並列版のアルゴリズムが起動した別のスレッドの事象は数えない
+ *
+ * @note   on_phaseは、アルゴリズムの段階(phase)が終わるたびに、その名前と経過時間[s]を引数に呼ばれる
+ *           dijkstra      : "initialize"(頂点属性の初期化), "search"(探索)
+ *           bfs           : "initialize", "search"
+ *           edmonds_karp  : "build"(残余ネットワークの構築), "augment"(フローの増加)
+ *           ford_fulkerson: "build", "augment"
+ *         アルゴリズムの中ではGRAPH_STAT_PHASE(name)で段階を示す. 段階はそのスコープの終わりで終わるので、1つのスコープに1つしか置けない
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef STATS_HPP
+#define STATS_HPP
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "graph.hpp"
+#include <cstdint>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+
+
+
+//****************************************
+// オブジェクト形式マクロの定義
+//****************************************
+
+#if defined(GRAPH_ENABLE_STATS)
+#define GRAPH_STAT_ADD(field, x) (::graph::detail::stat_add(&::graph::search_stats::field, (x)))  /**< @brief 統計fieldにxを加える */
+#define GRAPH_STAT_MAX(field, x) (::graph::detail::stat_max(&::graph::search_stats::field, (x)))  /**< @brief 統計fieldをxとの大きい方にする */
+#define GRAPH_STAT_AUGMENT(len)  (::graph::detail::stat_augment(len))                              /**< @brief 辺の数lenの増加可能経路を数える */
+#define GRAPH_STAT_PHASE(name)   ::graph::detail::phase_timer graph_phase_timer_(name)              /**< @brief このスコープの終わりにon_phase(name, 経過時間)を呼ぶ */
+#else
+#define GRAPH_STAT_ADD(field, x) ((void)0)
+#define GRAPH_STAT_MAX(field, x) ((void)0)
+#define GRAPH_STAT_AUGMENT(len)  ((void)0)
+#define GRAPH_STAT_PHASE(name)   ((void)0)
+#endif
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief 探索とフローのアルゴリズムの統計
+ */
+struct search_stats {
+    std::uint64_t edges_scanned         = 0;  /**< 調べた辺の数 */
+    std::uint64_t relaxations           = 0;  /**< 緩和に成功した辺の数 */
+    std::uint64_t heap_pushes           = 0;  /**< min優先度付きキューへの挿入の数 */
+    std::uint64_t heap_decrease_keys    = 0;  /**< DECREASE-KEYの数 */
+    std::uint64_t heap_pops             = 0;  /**< min優先度付きキューからの取り出しの数 */
+    std::uint64_t heap_peak             = 0;  /**< min優先度付きキューの要素の数の最大値 */
+    std::uint64_t bfs_levels            = 0;  /**< 幅優先探索の段の数 */
+    std::uint64_t augmentations         = 0;  /**< 増加可能経路の数 */
+    std::uint64_t augmenting_path_total = 0;  /**< 増加可能経路の辺の数の合計 */
+    std::uint64_t augmenting_path_max   = 0;  /**< 増加可能経路の辺の数の最大値 */
+
+    std::function<void(const char*, double)> on_phase;  /**< 段階が終わるたびに(名前, 経過時間[s])で呼ばれる */
+
+    /**< @brief 数をすべて0に戻す(on_phaseは残す) */
+    void clear()
+    {
+        auto f = std::move(on_phase);
+        *this = search_stats();
+        on_phase = std::move(f);
+    }
+};
+
+
+/**< @brief 統計を集めるように作られているか？ */
+#if defined(GRAPH_ENABLE_STATS)
+constexpr bool stats_enabled = true;
+#else
+constexpr bool stats_enabled = false;
+#endif
+
+
+namespace detail {
+
+    /**< @brief このスレッドで統計を加えるsearch_stats(stats_scopeがなければnullptr) */
+    inline search_stats*& current_stats()
+    {
+        static thread_local search_stats* st = nullptr;
+        return st;
+    }
+
+    inline void stat_add(std::uint64_t search_stats::* field, std::uint64_t x)
+    {
+        if (search_stats* st = current_stats()) { st->*field += x; }
+    }
+
+    inline void stat_max(std::uint64_t search_stats::* field, std::uint64_t x)
+    {
+        if (search_stats* st = current_stats()) { st->*field = std::max(st->*field, x); }
+    }
+
+    inline void stat_augment(std::uint64_t len)
+    {
+        if (search_stats* st = current_stats()) {
+            ++st->augmentations;
+            st->augmenting_path_total += len;
+            st->augmenting_path_max = std::max(st->augmenting_path_max, len);
+        }
+    }
+
+    /**
+     * @brief 構築から破棄までの時間を測り、on_phaseに知らせる
+     */
+    class phase_timer {
+    public:
+        explicit phase_timer(const char* name) : name(name), st(current_stats())
+        {
+            if (st && st->on_phase) { start = std::chrono::steady_clock::now(); }
+            else                    { st = nullptr; }
+        }
+        phase_timer(const phase_timer&) = delete;
+        phase_timer& operator = (const phase_timer&) = delete;
+        ~phase_timer()
+        {
+            if (!st) { return; }
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            st->on_phase(name, elapsed.count());
+        }
+
+    private:
+        const char*                           name;
+        search_stats*                         st;
+        std::chrono::steady_clock::time_point start;
+    };
+
+}
+
+
+
+//****************************************
+// クラスの定義
+//****************************************
+
+/**
+ * @brief  スコープの中でこのスレッドが呼んだアルゴリズムの統計をstに加える
+ * @note   GRAPH_ENABLE_STATSを定義していなければ何もしない
+ */
+class stats_scope {
+public:
+    explicit stats_scope(search_stats& st) : prev(detail::current_stats()) { detail::current_stats() = &st; }
+    stats_scope(const stats_scope&) = delete;
+    stats_scope& operator = (const stats_scope&) = delete;
+    ~stats_scope() { detail::current_stats() = prev; }
+
+private:
+    search_stats* prev;  /**< 外側のスコープのsearch_stats */
+};
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
+
+
+
+#endif  // end of STATS_HPP
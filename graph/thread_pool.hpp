@@ -0,0 +1,203 @@
+/**
+ * @brief  作業を盗む(work-stealing)スレッドプールを扱う
+ *
+ * @note   parallel_run(parallel.hpp)は呼び出しごとにスレッドを生成するので、1回の処理が短い問い合わせを大量に捌くには起動の費用が大きすぎる
+ *         thread_poolは生成時にthreads本の作業スレッドを起動し、破棄するまで使い回す
+ *
+ *         各作業スレッドは自分の両端キュー(deque)を持つ. 作業スレッドの中から投入した作業は自分のキューの末尾に置き、外から投入した作業は
+ *         キューに順番に振り分ける. 作業スレッドは自分のキューの末尾から作業を取り出し、空ならば他のスレッドのキューの先頭から盗む
+ *         キューごとに別のmutexで守るので、投入と取り出しが1つのロックに集中しない. 盗むときはtry_lockを用い、使用中のキューは飛ばす
+ *
+ * @note   作業はf(tid)の形で呼ばれる(tidは実行する作業スレッドの番号0, 1, ..., threads - 1). 番号ごとに作業領域を持てば、作業の間でロックは要らない
+ *         破棄するときは、キューに残ったすべての作業を実行してからスレッドを終了する
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "parallel.hpp"
+#include <cstddef>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief  作業を盗むスレッドプール
+ */
+struct thread_pool {
+    using task = std::function<void(unsigned)>;  /**< 作業. 引数は実行する作業スレッドの番号 */
+
+
+    /**< @brief threads本(0ならばハードウェアの並列度)の作業スレッドを起動する */
+    explicit thread_pool(unsigned threads = 0) : queues(resolve_threads(threads))
+    {
+        workers.reserve(queues.size());
+        for (unsigned tid = 0; tid < queues.size(); ++tid) { workers.emplace_back([this, tid] { run(tid); }); }
+    }
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator = (const thread_pool&) = delete;
+
+    /**< @brief 残った作業をすべて実行してから、作業スレッドを終了する */
+    ~thread_pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            stopping = true;
+        }
+        cv.notify_all();
+        for (auto&& t : workers) { t.join(); }
+    }
+
+    /**< @brief 作業スレッドの数を返す */
+    unsigned size() const { return static_cast<unsigned>(queues.size()); }
+
+    /**
+     * @brief  作業fを投入する
+     * @note   作業スレッドから呼ばれたときは、そのスレッドのキューの末尾に置く(直後に同じスレッドが取り出すので、キャッシュに残った値を使える)
+     */
+    void post(task f)
+    {
+        unsigned q = current() == this ? current_tid() : static_cast<unsigned>(next++ % queues.size());
+        pending.fetch_add(1);  // 取り出す側が先に減らして負にならないよう、キューに置く前に数える
+        {
+            std::lock_guard<std::mutex> lock(queues[q].mtx);
+            queues[q].tasks.push_back(std::move(f));
+        }
+        if (sleeping.load() == 0) { return; }        // 眠っている作業スレッドがなければ、共有のmutexに触れない
+        { std::lock_guard<std::mutex> lock(mtx); }  // 待ちに入ろうとしている作業スレッドが通知を取りこぼさないようにする
+        cv.notify_one();
+    }
+
+    /**
+     * @brief  作業f(tid)を投入し、その戻り値を受け取るfutureを返す
+     * @note   fが例外を送出したときは、futureのget()で再送出される
+     */
+    template<class F>
+    auto async(F f) -> std::future<decltype(f(0u))>
+    {
+        using result_type = decltype(f(0u));
+        auto p = std::make_shared<std::promise<result_type>>();
+        std::future<result_type> r = p->get_future();
+        post([p, f = std::move(f)](unsigned tid) mutable {
+            try {
+                if constexpr (std::is_void_v<result_type>) { f(tid); p->set_value(); }
+                else { p->set_value(f(tid)); }
+            }
+            catch (...) { p->set_exception(std::current_exception()); }
+        });
+        return r;
+    }
+
+private:
+    /**< @brief 作業スレッドごとのキュー */
+    struct alignas(64) worker_queue {
+        std::mutex       mtx;
+        std::deque<task> tasks;
+    };
+
+    /**< @brief 呼び出したスレッドが作業スレッドであれば、そのスレッドプールを返す */
+    static thread_pool*& current() { static thread_local thread_pool* pool = nullptr; return pool; }
+    static unsigned& current_tid() { static thread_local unsigned tid = 0; return tid; }
+
+    /**< @brief 自分のキューの末尾、または他のキューの先頭から作業を1つ取り出す */
+    bool take(unsigned tid, task& f)
+    {
+        {
+            std::lock_guard<std::mutex> lock(queues[tid].mtx);
+            if (!queues[tid].tasks.empty()) {
+                f = std::move(queues[tid].tasks.back());
+                queues[tid].tasks.pop_back();
+                return true;
+            }
+        }
+        for (std::size_t k = 1; k < queues.size(); ++k) {
+            worker_queue& q = queues[(tid + k) % queues.size()];
+            std::unique_lock<std::mutex> lock(q.mtx, std::try_to_lock);
+            if (!lock.owns_lock() || q.tasks.empty()) { continue; }
+            f = std::move(q.tasks.front());
+            q.tasks.pop_front();
+            return true;
+        }
+        return false;
+    }
+
+    /**< @brief 作業スレッドtidの本体. 作業がなければ投入されるまで眠る */
+    void run(unsigned tid)
+    {
+        current() = this;
+        current_tid() = tid;
+        for (task f; ; ) {
+            if (take(tid, f)) {
+                pending.fetch_sub(1, std::memory_order_relaxed);
+                f(tid);
+                f = nullptr;
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(mtx);
+            if (pending.load() > 0) { continue; }  // 使用中のキューを飛ばしただけならば、もう一度探す
+            if (stopping) { return; }
+            // sleepingを増やしてからpendingを読むので、post側がsleeping = 0を読んだならば、ここでpending > 0が見える
+            sleeping.fetch_add(1);
+            cv.wait(lock, [&] { return stopping || pending.load() > 0; });
+            sleeping.fetch_sub(1);
+        }
+    }
+
+    std::vector<worker_queue>  queues;        /**< 作業スレッドごとのキュー */
+    std::vector<std::thread>   workers;       /**< 作業スレッド */
+    std::atomic<std::size_t>   pending{0};    /**< キューに置かれている作業の数 */
+    std::atomic<std::size_t>   next{0};       /**< 外から投入した作業を振り分ける次のキュー */
+    std::atomic<std::size_t>   sleeping{0};   /**< 眠っている(眠ろうとしている)作業スレッドの数 */
+    std::mutex                 mtx;           /**< 眠っている作業スレッドを起こすためのmutex */
+    std::condition_variable    cv;
+    bool                       stopping = false;
+};
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
+
+
+
+#endif  // end of THREAD_POOL_HPP
@@ -0,0 +1,197 @@
+/**
+ * @brief  何度も繰り返す単一始点の問い合わせのために、探索の作業領域を使い回す
+ *
+ * @note   bfs, dijkstra, bellman_ford, primは呼び出しのたびに|V|個の頂点属性とキューを確保し、INITIALIZE-SINGLE-SOURCEでΘ(V)時間かけて初期化する
+ *         始点の近くの少数の頂点にしか到達しない問い合わせを何度も繰り返すと、探索そのものより確保と初期化に時間がかかる
+ *
+ *         epoch_marksは、頂点ごとの刻印mark[v]と問い合わせの番号epochを持ち、mark[v] == epochのときに限りvに印が付いているとみなす
+ *         epochを1つ進めるだけですべての印が消えるので、問い合わせの開始はΟ(1)時間で済む. epochが一巡したときだけ刻印を0で埋め直す
+ *
+ *         search_workspaceは、d値、π値、色をvertices_soaと同じ形で持ち、そのうえで各頂点に最初に触れたとき(touch)に限って
+ *         その頂点の属性を初期値(∞, NIL, 白)に戻す. 触れていない頂点は初期値を持つものとして扱うので、1回の問い合わせの時間は
+ *         到達した頂点とそこから出る辺の数に比例し、|V|には依存しない. min優先度付きキューとFIFOキューも作業領域に持ち、使い回す
+ *
+ * @note   d[v], pi[v]を直接読んでよいのは、その問い合わせでtouchした頂点(色が白でない頂点)だけである
+ *         任意の頂点を読むときはdist(v), pred(v)を用いる. paint(v, c)はvに触れてから彩色する
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef WORKSPACE_HPP
+#define WORKSPACE_HPP
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "graph.hpp"
+#include "soa.hpp"
+#include "heap.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief Ο(1)時間ですべて消すことのできる頂点の印の集合
+ */
+struct epoch_marks {
+    std::vector<std::uint32_t> mark;  /**< 頂点vに最後に印を付けたときの問い合わせの番号 */
+    std::uint32_t epoch = 1;          /**< 現在の問い合わせの番号 */
+
+    explicit epoch_marks(std::size_t n = 0) : mark(n, 0) {}
+
+    /**< @brief 頂点数をnに変更し、すべての印を消す */
+    void resize(std::size_t n) { mark.assign(n, 0); epoch = 1; }
+
+    /**< @brief 頂点数|V|を返す */
+    std::size_t size() const { return mark.size(); }
+
+    /**< @brief すべての印を消す. 番号が一巡したときだけΘ(V)時間かかる */
+    void clear()
+    {
+        if (++epoch == 0) { std::fill(mark.begin(), mark.end(), 0); epoch = 1; }
+    }
+
+    /**< @brief 頂点vに印が付いているか？ */
+    bool operator [] (index_t v) const { return mark[v] == epoch; }
+
+    /**< @brief 頂点vに印を付ける. すでに付いていればfalseを返す */
+    bool insert(index_t v)
+    {
+        if (mark[v] == epoch) { return false; }
+        mark[v] = epoch;
+        return true;
+    }
+};
+
+
+/**
+ * @brief 問い合わせのたびに触れた頂点だけを初期化する、単一始点の探索の作業領域
+ */
+struct search_workspace {
+    using traits_type = default_traits;
+    using index_type  = index_t;
+    using weight_type = weight_t;
+
+    array_t      d;       /**< 始点sからの距離(Primのアルゴリズムではkey値) */
+    indices_t    pi;      /**< 先行頂点(の添字) */
+    states_t     state;   /**< 頂点の色(vcolorを1バイトに詰めたもの) */
+    indices_t    len;     /**< v.dを与えた歩道の辺数(キューを用いるBellman-Fordアルゴリズムで用いる) */
+    epoch_marks  seen;    /**< この問い合わせで触れた頂点 */
+    indices_t    trail;   /**< この問い合わせで触れた頂点を触れた順に並べたもの */
+    indices_t    fifo;    /**< 幅優先探索などで用いるFIFOキューの領域 */
+    dary_heap<4> Q;       /**< DijkstraおよびPrimのアルゴリズムで用いるmin優先度付きキュー */
+
+    search_workspace() = default;
+    explicit search_workspace(std::size_t n) { resize(n); }
+
+    /**
+     * @brief  頂点数をnとして新しい問い合わせを始める. すべての頂点はd値∞、π値NIL、色白を持つものとみなされる
+     * @note   頂点数が前回と同じであれば、領域を確保し直さずにΟ(1)時間(とキューに残った要素の数)で済む
+     */
+    void resize(std::size_t n)
+    {
+        if (seen.size() != n) {
+            d.resize(n); pi.resize(n); state.resize(n); len.resize(n);
+            seen.resize(n);
+            Q.resize(n);
+        }
+        clear();
+    }
+
+    /**< @brief 頂点数を変えずに新しい問い合わせを始める */
+    void clear()
+    {
+        seen.clear();
+        trail.clear();
+        fifo.clear();
+        Q.clear();
+    }
+
+    /**< @brief 頂点数|V|を返す */
+    index_t size() const { return static_cast<index_t>(seen.size()); }
+
+    /**< @brief 頂点vに触れる. この問い合わせで初めて触れたならば、vの属性を初期値に戻す */
+    void touch(index_t v)
+    {
+        if (!seen.insert(v)) { return; }
+        d[v]     = limits::inf;
+        pi[v]    = limits::nil;
+        state[v] = static_cast<std::uint8_t>(vcolor::white);
+        len[v]   = 0;
+        trail.push_back(v);
+    }
+
+    /**< @brief 頂点vのd値を返す(触れていなければ∞) */
+    weight_t dist(index_t v) const { return seen[v] ? d[v] : limits::inf; }
+
+    /**< @brief 頂点vのπ値を返す(触れていなければNIL) */
+    index_t pred(index_t v) const { return seen[v] ? pi[v] : limits::nil; }
+
+    /**< @brief 頂点vの色を返す(触れていなければ白) */
+    vcolor color(index_t v) const { return seen[v] ? static_cast<vcolor>(state[v]) : vcolor::white; }
+
+    /**< @brief 頂点vに触れてから、色cで彩色する */
+    void paint(index_t v, vcolor c) { touch(v); state[v] = static_cast<std::uint8_t>(c); }
+
+    /**
+     * @brief  先行点を始点まで辿り、始点からvへの道上の頂点を始点から順に並べて返す
+     * @note   vに到達していなければ空の列を返す. printpathと異なり、道を印刷せずに列として返す
+     */
+    indices_t path_to(index_t v) const
+    {
+        indices_t p;
+        if (dist(v) == limits::inf) { return p; }
+        for (; v != limits::nil; v = pred(v)) { p.push_back(v); }
+        std::reverse(p.begin(), p.end());
+        return p;
+    }
+
+    /**< @brief この問い合わせで触れた頂点の列を返す */
+    const indices_t& touched() const { return trail; }
+
+    /**< @brief 配列の構造体vertices_soaに変換する. Θ(V)時間かかる */
+    vertices_soa to_soa() const
+    {
+        vertices_soa S(seen.size());
+        for (auto&& v : trail) { S.d[v] = d[v]; S.pi[v] = pi[v]; S.state[v] = state[v]; }
+        return S;
+    }
+
+    /**< @brief 従来のvertices_tに変換する. Θ(V)時間かかる */
+    vertices_t to_vertices() const { return to_soa().to_vertices(); }
+};
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
+
+
+
+#endif  // end of WORKSPACE_HPP
@@ -0,0 +1,126 @@
+/**
+ * @brief  全点対最短路問題(all-pairs shortest paths problem)における
+ *         Johnsonのアルゴリズム(Johnson's algorithm)の実装を行う
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <atomic>
+#include <algorithm>
+#include "../graph/parallel.hpp"
+#include "../graph/heap.hpp"
+#include "../graph/soa.hpp"
+#include "../bellman_ford/bellman_ford.hpp"
+#include "../dijkstra/dijkstra.hpp"
+#include "johnson.hpp"
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+namespace {
+
+    /**
+     * @brief  新しい頂点qを加えたグラフG'上でBellman-Fordアルゴリズムを実行し、h(v) = δ(q, v)を求める
+     * @note   G'はGのCSR表現の末尾にqの隣接リスト(各頂点への重み0の辺)を加えたものである. 負辺がなければh = 0である
+     * @return Gが負閉路を含まないか？
+     */
+    bool potential(const csr_graph& G, array_t& h)
+    {
+        const index_t n = G.size(), m = G.edge_count();
+        h.assign(n, 0);
+        if (std::all_of(G.w.begin(), G.w.end(), [](weight_t w) { return w >= 0; })) { return true; }
+
+        csr_graph Gq;
+        Gq.offset = G.offset; Gq.offset.push_back(m + n);
+        Gq.dst = G.dst; Gq.w = G.w;
+        for (index_t v = 0; v < n; ++v) { Gq.dst.push_back(v); Gq.w.push_back(0); }
+
+        vertices_soa V;
+        if (!bellman_ford_queue(Gq, n, V)) { return false; }
+        std::copy(V.d.begin(), V.d.begin() + n, h.begin());
+        return true;
+    }
+
+}
+
+
+/**
+ * @brief  Johnsonのアルゴリズム
+ * @note   始点は1つずつ取ってスレッドで分担する. 各スレッドの作業領域(S, Q, 行d)は最初に1回だけ確保する
+ */
+bool johnson(const csr_graph& G, const johnson_row& row, unsigned threads)
+{
+    const index_t n = G.size();
+    threads = static_cast<unsigned>(std::min<std::size_t>(resolve_threads(threads), std::max<index_t>(n, 1)));
+
+    array_t h;
+    if (!potential(G, h)) { return false; }  // 負閉路があれば、FALSEを返す
+
+    // ŵ(u, v) = w(u, v) + h(u) - h(v)で再重み付けする
+    csr_graph Gh = G;
+    weight_t* wh = Gh.w.mutable_data();
+    for (index_t u = 0; u < n; ++u) {
+        for (index_t i = G.offset[u]; i < G.offset[u + 1]; ++i) { wh[i] = G.w[i] + h[u] - h[G.dst[i]]; }
+    }
+
+    std::atomic<index_t> next(0);
+    parallel_run(threads, [&](unsigned) {
+        vertices_soa S;
+        dary_heap<4> Q(n);
+        array_t d(n);
+        for (index_t s; (s = next.fetch_add(1, std::memory_order_relaxed)) < n; ) {
+            dijkstra(Gh, s, S, Q);  // ŵのもとで始点sからの最短路を求め、
+            for (index_t v = 0; v < n; ++v) {
+                d[v] = S.d[v] == limits::inf ? limits::inf : S.d[v] - h[s] + h[v];  // 元の重みに戻す
+            }
+            row(s, d, S.pi);
+        }
+    });
+    return true;
+}
+
+
+/**< @brief 隣接リスト表現のグラフGをCSR表現に変換してから、Johnsonのアルゴリズムを実行する */
+bool johnson(const graph_t& G, const johnson_row& row, unsigned threads)
+{
+    return johnson(csr_graph(G), row, threads);
+}
+
+
+/**< @brief Johnsonのアルゴリズムの各行を|V| x |V|の行列Dに書き込む. 各行は1本のスレッドだけが書き込む */
+template<class Matrix>
+static bool johnson_matrix_impl(const csr_graph& G, Matrix& D, unsigned threads)
+{
+    D = make_matrix<Matrix>(G.size(), limits::inf);
+    return johnson(G, [&D](index_t s, const array_t& d, const indices_t&) { std::copy(d.begin(), d.end(), D[s].begin()); }, threads);
+}
+
+
+bool johnson(const csr_graph& G, matrix_t& D, unsigned threads)     { return johnson_matrix_impl(G, D, threads); }
+bool johnson(const graph_t& G, matrix_t& D, unsigned threads)       { return johnson_matrix_impl(csr_graph(G), D, threads); }
+bool johnson(const csr_graph& G, dense_matrix& D, unsigned threads) { return johnson_matrix_impl(G, D, threads); }
+bool johnson(const graph_t& G, dense_matrix& D, unsigned threads)   { return johnson_matrix_impl(csr_graph(G), D, threads); }
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
@@ -0,0 +1,104 @@
+/**
+ * @brief  全点対最短路問題(all-pairs shortest paths problem)における
+ *         Johnsonのアルゴリズム(Johnson's algorithm)の宣言を行う
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef JOHNSON_HPP
+#define JOHNSON_HPP
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "../graph/graph.hpp"
+#include "../graph/csr.hpp"
+#include "../graph/matrix.hpp"
+#include <functional>
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 型シノニム
+//****************************************
+
+/**
+ * @brief  Johnsonのアルゴリズムが始点sからの最短路を1行求めるたびに呼び出す手続き row(s, d, pi)
+ * @note   d[v] = δ(s, v)(到達できなければlimits::inf)、pi[v]はsを根とする最短路木でのvの先行点である
+ *         異なる始点の行は複数のスレッドから同時に渡されるので、手続きはそれを前提に書くこと. dとpiは手続きから戻った後に書き換えられる
+ */
+using johnson_row = std::function<void(index_t s, const array_t& d, const indices_t& pi)>;
+
+
+
+//****************************************
+// 関数の宣言
+//****************************************
+
+/**
+ * @brief  Johnsonのアルゴリズム
+ *
+ * @note   Johnsonのアルゴリズムは、疎なグラフに対してΟ(V^2lgV + VElgV)時間で全点対最短路を求める
+ *         辺重みの再重み付け(reweighting)によって負辺を取り除いてから、各頂点を始点としてDijkstraのアルゴリズムを実行する
+ *
+ *         新しい頂点qと、qから各頂点vへの重み0の辺を加えたグラフG'上でBellman-Fordアルゴリズムを実行し、h(v) = δ(q, v)とする
+ *         三角不等式からh(v) <= h(u) + w(u, v)なので、
+ *           ŵ(u, v) = w(u, v) + h(u) - h(v) >= 0
+ *         である. 道pの重みはŵのもとでw(p) + h(s) - h(t)となり、始点と終点だけで決まる量しか変わらないので、最短路は変わらない
+ *         ŵのもとでの最短路重みδ̂(s, v)から、δ(s, v) = δ̂(s, v) - h(s) + h(v)として元の最短路重みを得る
+ *
+ * @note   各始点のDijkstraのアルゴリズムは互いに独立なので、始点をthreads本のスレッドで分担する
+ *         各スレッドは最短路の結果SとヒープQを1組だけ確保し、すべての始点で使い回す
+ *         求めた行は手続きrowに渡すだけで保持しないので、V x Vの行列を記憶する必要はない
+ *
+ * @param  const csr_graph&   G       重み付き有向グラフG
+ * @param  const johnson_row& row     始点sの行を受け取る手続き
+ * @param  unsigned           threads スレッド数(0ならばハードウェアの並列度)
+ * @return Gが負閉路を含まないか？(含むときはrowを呼び出さない)
+ */
+bool johnson(const csr_graph& G, const johnson_row& row, unsigned threads = 0);
+bool johnson(const graph_t& G, const johnson_row& row, unsigned threads = 0);
+
+
+
+/**
+ * @brief  Johnsonのアルゴリズムにより、最短路重みを表す|V| x |V|の行列Dを求める
+ * @note   D[s][v] = δ(s, v)である. sからvに到達できなければlimits::infとする(floyd_warshallと同じ形の出力)
+ *
+ * @param  const csr_graph& G       重み付き有向グラフG
+ * @param  matrix_t&        D       最短路重みの行列
+ * @param  unsigned         threads スレッド数(0ならばハードウェアの並列度)
+ * @return Gが負閉路を含まないか？
+ */
+bool johnson(const csr_graph& G, matrix_t& D, unsigned threads = 0);
+bool johnson(const graph_t& G, matrix_t& D, unsigned threads = 0);
+bool johnson(const csr_graph& G, dense_matrix& D, unsigned threads = 0);
+bool johnson(const graph_t& G, dense_matrix& D, unsigned threads = 0);
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
+
+
+
+#endif  // end of JOHNSON_HPP
@@ -0,0 +1,100 @@
+/**
+ * @brief 複数のスレッドから同時に操作できる素集合森構造体
+ * @date  2026/10/14
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef CONCURRENT_DISJOINT_SETS_HPP
+#define CONCURRENT_DISJOINT_SETS_HPP
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief 並行素集合森
+ * @note  親の配列pの各要素を不可分(atomic)に持ち、書き換えはすべて比較交換で行うので、ロックを用いない(lock-free)
+ *        p[x] = xならばxは根である. 2つの根x < yを合併するときは、yの親を比較交換でxにする(添字による合併(linking by index))
+ *        比較交換に失敗したのは、その間に別のスレッドがyを別の根の下に付けたときなので、代表元を求め直してやり直す
+ *        大きい添字の根が常に小さい添字の根の下に付くので、木に閉路はできず、各集合の代表元はその集合の最小の要素になる
+ *
+ * @note  find_setは経路半分化を比較交換で行う. 比較交換に失敗しても、別のスレッドがより根に近い節点に付け替えただけなので無視してよい
+ *        Anderson and Woll, "Wait-free Parallel Algorithms for the Union-Find Problem", STOC 1991
+ */
+struct concurrent_disjoint_sets {
+    using index_t = std::int32_t;
+
+    std::vector<std::atomic<index_t>> p;  /**< xの親(xが根ならばx自身) */
+
+    /**< @brief 要素0, 1, ..., size - 1をそれぞれ唯一の要素とするsize個の集合を生成する */
+    explicit concurrent_disjoint_sets(std::size_t size) : p(size) { make_all(); }
+
+    /**< @brief すべての要素について、それを唯一の要素とする集合を一度に生成する(他のスレッドが操作していないときに呼ぶこと) */
+    void make_all()
+    {
+        for (std::size_t x = 0; x < p.size(); ++x) { p[x].store(static_cast<index_t>(x), std::memory_order_relaxed); }
+    }
+
+    /**
+     * @brief  xを含む集合の代表元を返す
+     * @note   他のスレッドが同時に合併していると、返した代表元はすぐに根でなくなりうる
+     */
+    index_t find_set(index_t x)
+    {
+        while (true) {
+            index_t y = p[x].load(std::memory_order_relaxed);
+            if (y == x) { return x; }
+            index_t z = p[y].load(std::memory_order_relaxed);
+            if (y != z) { p[x].compare_exchange_weak(y, z, std::memory_order_relaxed); }  // xの親を祖父に付け替える
+            x = z;
+        }
+    }
+
+    /**
+     * @brief  xを含む集合とyを含む集合を合併する
+     * @return 2つの集合を合併したか？(同じ集合を合併しようとした複数のスレッドのうち、ちょうど1本だけがtrueを得る)
+     */
+    bool merge(index_t x, index_t y)
+    {
+        while (true) {
+            x = find_set(x); y = find_set(y);
+            if (x == y) { return false; }
+            if (x > y) { std::swap(x, y); }
+            index_t root = y;
+            if (p[y].compare_exchange_strong(root, x, std::memory_order_relaxed)) { return true; }  // yがまだ根ならば、xの下に付ける
+        }
+    }
+
+    /**< @brief xとyが同じ集合に属するか？ */
+    bool same(index_t x, index_t y)
+    {
+        while (true) {
+            x = find_set(x); y = find_set(y);
+            if (x == y) { return true; }
+            if (p[x].load(std::memory_order_relaxed) == x) { return false; }  // xがまだ根ならば、この時点でxとyは別の集合に属する
+        }
+    }
+};
+
+
+
+#endif  // end of CONCURRENT_DISJOINT_SETS_HPP
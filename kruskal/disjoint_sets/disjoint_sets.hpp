@@ -1,7 +1,7 @@
 /**
  * @brief 素集合森構造体
  * @date  作成日     : 2016/01/25
- * @date  最終更新日 : 2016/01/25
+ * @date  最終更新日 : 2026/10/14
  */
 
 
@@ -21,6 +21,7 @@
 
 #include <vector>
 #include <cstdint>
+#include <algorithm>
 
 
 
@@ -28,15 +29,20 @@
 // 構造体の定義
 //****************************************
 
-/**< @brief 素集合森 */
+/**
+ * @brief 素集合森
+ * @note  親の配列pだけで素集合森を表す. p[x] >= 0ならばp[x]はxの親であり、p[x] < 0ならばxは根で、-p[x]はその木の大きさ(要素数)である
+ *        ランクの代わりに大きさによる合併(union by size)を行うので、ランクのための配列は要らない. 木の高さはどちらもΟ(lgn)に抑えられる
+ *        find_setは再帰の代わりに経路半分化(path halving)を行う. 経路圧縮と同じくm回の操作の総実行時間はΟ(mα(n))であり、
+ *        根までの経路が長くてもスタックを消費しない
+ */
 struct disjoint_sets {
     using index_t = std::int32_t;
-    using rank_t  = std::int32_t;
 
-    std::vector<index_t> p;
-    std::vector<rank_t> rank;
+    std::vector<index_t> p;  /**< xの親、またはxが根ならば木の大きさの符号を反転したもの */
 
-    explicit disjoint_sets(std::size_t size) : p(size, -1), rank(size, -1) {}
+    /**< @brief 要素0, 1, ..., size - 1をそれぞれ唯一の要素とするsize個の集合を生成する */
+    explicit disjoint_sets(std::size_t size) : p(size, -1) {}
 
     /**
      * @brief xを唯一の要素(従って、代表元)としてもつ新しい集合を生成する.
@@ -44,61 +50,63 @@ struct disjoint_sets {
      *
      * @param int x 節点x
      */
-    void make_set(index_t x) {
-        p[x]    = x;
-        rank[x] = 0;
-    }
+    void make_set(index_t x) { p[x] = -1; }
+
+    /**< @brief すべての要素について、それを唯一の要素とする集合を一度に生成する */
+    void make_all() { std::fill(p.begin(), p.end(), -1); }
 
     /**
-     * @brief     xを含む動的集合Sxとyを含む動的集合Syを合併(統合)し、
-     *            これらの和集合である新しい集合を生成する.
-     * @attention SxとSyはこの操作を実行する前は互いに素であると仮定する.
+     * @brief  xを含む動的集合Sxとyを含む動的集合Syを合併(統合)し、
+     *         これらの和集合である新しい集合を生成する.
+     * @note   xとyがすでに同じ集合に属するときは何もしない
      *
-     * @param int x   動的集合Sxの元x
-     * @param int y   動的集合Syの元y
+     * @param  int x   動的集合Sxの元x
+     * @param  int y   動的集合Syの元y
+     * @return 2つの集合を合併したか？(合併の前にSxとSyが互いに素であったか？)
      */
-    void merge(index_t x, index_t y) {
-        link(find_set(x), find_set(y));
+    bool merge(index_t x, index_t y)
+    {
+        x = find_set(x); y = find_set(y);
+        if (x == y) { return false; }
+        link(x, y);
+        return true;
     }
 
-
     /**
-     * @brief 手続きmergeの補助関数
+     * @brief 手続きmergeの補助関数. 小さい方の木の根を大きい方の木の根の子にする
      *
      * @param int x 動的集合Sxの代表元x(Sxの根)
      * @param int y 動的集合Syの代表元y(Syの根)
      */
-    void link(index_t x, index_t y) {
-        // xのランク > yのランクかどうか判定
-        if (rank[x] > rank[y]) {  // x.rank > y.rankならば、
-            p[y] = x;             // yの親はxを指す
-        }
-        else {                    // x.rank <= y.rankならば、
-            p[x] = y;             // xの親はyを指す
-
-            if (rank[x] == rank[y]) {   // x.rank == y.rankならば、
-                rank[y] = rank[y] + 1;  // y.rankをひとつ増やす
-            }
-        }
+    void link(index_t x, index_t y)
+    {
+        if (p[x] > p[y]) { std::swap(x, y); }  // |Sx| >= |Sy|となるようにする
+        p[x] += p[y];                          // 大きさを足し合わせ、
+        p[y] = x;                              // yの親はxを指す
     }
 
     /**
-     * @brief  xを含む(唯一の)集合の代表元へのポインタを返す.
-     *         手続きfindsetは2パス法に基づく.再帰が進行するのに従って、
-     *         find経路を根に向かって上向きに走査して根を発見し、つぎに、
-     *         再帰が巻き戻されるにつれて、辿ってきたfind経路を下る2度目の走査を行って、
-     *         find経路上の各節点のポインタを直接根を指すように更新する.
+     * @brief  xを含む(唯一の)集合の代表元を返す.
+     * @note   find経路を根に向かって上向きに1回だけ走査し、その途中で各節点の親を祖父に付け替える(経路半分化)
+     *         経路の長さはおよそ半分になり、2パス法と同じ計算量の上界が得られる
      *
      * @param  int x   集合Sxの元x
      * @return int y   集合Sxの代表元(根)
      */
-    index_t find_set(index_t x) {
-        // find経路を根に向かって上向きに走査
-        if (x != p[x]) {
-            p[x] = find_set(p[x]);  // 再帰を進行させる
+    index_t find_set(index_t x)
+    {
+        while (p[x] >= 0) {
+            if (p[p[x]] >= 0) { p[x] = p[p[x]]; }  // xの親を祖父に付け替え、
+            x = p[x];                               // 祖父へ進む
         }
-        return p[x];  // 再帰が底をついてから、根を返す
+        return x;
     }
+
+    /**< @brief xとyが同じ集合に属するか？ */
+    bool same(index_t x, index_t y) { return find_set(x) == find_set(y); }
+
+    /**< @brief xを含む集合の大きさ|Sx|を返す */
+    index_t size(index_t x) { return -p[find_set(x)]; }
 };
 
 
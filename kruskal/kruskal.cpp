@@ -12,7 +12,9 @@
 
 #include "kruskal.hpp"
 #include "./disjoint_sets/disjoint_sets.hpp"
+#include "../graph/radix_sort.hpp"
 #include <iostream>
+#include <algorithm>
 
 
 
@@ -28,6 +30,83 @@ GRAPH_BEGIN
 // 関数の定義
 //****************************************
 
+namespace {
+
+    /**< @brief 辺を重みの非減少順に並べるための比較 */
+    struct weight_less { template<class Edge> bool operator()(const Edge& e, const Edge& f) const { return e.w < f.w; } };
+
+
+    /**< @brief 重みの型Weightの値を32ビットの基数ソートのキー(radix_key)に直せるか？ */
+    template<class Weight>
+    constexpr bool has_radix_key = std::is_integral_v<Weight> && sizeof(Weight) <= sizeof(std::int32_t)
+                                && (std::is_signed_v<Weight> || sizeof(Weight) < sizeof(std::int32_t));
+
+
+    /**< @brief グラフGから集合G.Eを取り出す */
+    template<class Graph>
+    basic_edges_t<traits_of<Graph>> collect_edges(const Graph& G)
+    {
+        using index_type = typename traits_of<Graph>::index_type;
+        basic_edges_t<traits_of<Graph>> E;
+        for (index_type u = 0; u < static_cast<index_type>(G.size()); ++u) { for (auto&& e : G[u]) { E.push_back(e); } }
+        return E;
+    }
+
+
+    /**
+     * @brief  重みの非減少順に並んだ辺の区間[first, last)を順に検討し、異なる木を連結する辺をAに加える
+     * @note   Aが|V| - 1本の辺を含んだ時点で全域木は完成しているので、残りの辺は調べない
+     */
+    template<class Iterator, class Edges, class Weight>
+    void kruskal_scan(Iterator first, Iterator last, disjoint_sets& ds, index_t n, Edges& A, Weight& w)
+    {
+        for (; first != last && static_cast<index_t>(A.size()) < n - 1; ++first) {  // 辺を重みの小さいものから順に検討する
+            // このループでは、各辺(u, v)について、端点uとvが同じ木に属するかどうかを調べ、
+            // 両端点が同じ木に属さないならば、2つの木の頂点集合をマージする(両端点の代表元はmergeの中で1回ずつ求める)
+            if (ds.merge(first->src, first->dst)) {
+                A.push_back(*first); w += first->w;  // 辺(u, v)をAに加える
+            }
+        }
+    }
+
+
+    /**
+     * @brief  Filter-Kruskalの再帰部分. 辺の区間[first, last)を扱う
+     * @note   区間の辺の重みから軸pを選び、重みがp以下の辺とpより大きい辺に分割する. 軽い方を再帰的に処理した後、
+     *         重い方から両端点がすでに同じ木に属する辺を取り除き(filter)、残った辺だけを再帰的に処理する
+     *         区間が十分に短くなったら、整列してKruskalのアルゴリズムをそのまま適用する
+     */
+    template<class Edges, class Weight>
+    void filter_kruskal(typename Edges::iterator first, typename Edges::iterator last, disjoint_sets& ds, index_t n, Edges& A, Weight& w)
+    {
+        constexpr std::ptrdiff_t threshold = 1024;  // 整列に切り替える区間の長さ
+        if (static_cast<index_t>(A.size()) >= n - 1 || first == last) { return; }
+        if (last - first <= threshold) {
+            std::sort(first, last, weight_less());
+            kruskal_scan(first, last, ds, n, A, w);
+            return;
+        }
+
+        // 軸pは区間の先頭、中央、末尾の辺の重みの中央値とする
+        Weight a = first->w, b = first[(last - first) / 2].w, c = (last - 1)->w;
+        Weight p = std::max(std::min(a, b), std::min(std::max(a, b), c));
+        auto mid = std::partition(first, last, [p](const auto& e) { return e.w <= p; });
+        if (mid == last) {  // すべての重みがp以下ならば、pより小さい辺と重みがpの辺に分ける
+            mid = std::partition(first, last, [p](const auto& e) { return e.w < p; });
+            filter_kruskal(first, mid, ds, n, A, w);
+            kruskal_scan(mid, last, ds, n, A, w);  // 重みがすべて等しいので、整列する必要はない
+            return;
+        }
+
+        filter_kruskal(first, mid, ds, n, A, w);
+        if (static_cast<index_t>(A.size()) >= n - 1) { return; }
+        last = std::partition(mid, last, [&ds](const auto& e) { return !ds.same(e.src, e.dst); });  // filter
+        filter_kruskal(mid, last, ds, n, A, w);
+    }
+
+}
+
+
 /**
  * @brief  Kruskalのアルゴリズム
  *
@@ -40,33 +119,104 @@ GRAPH_BEGIN
  *
  * @note   Kruskalのアルゴリズムの総実行時間はΟ(ElgV)である
  *
- * @param  const graph& G グラフG
+ * @note   添字と重みの型はGの特性traits_of<Graph>から定まる. 重みが32ビットの整数のキーに直せない型(std::int64_t, double)では、
+ *         kruskal_kind::radixを指定しても比較に基づく整列を用いる
+ *
+ * @tparam Graph          グラフGの表現(graph_tまたはcsr_graph)
+ * @param  const Graph& G グラフG
+ * @param  kruskal_kind k 辺の整列の方法
+ * @param  unsigned threads 基数ソートのスレッド数
  * @return 辺集合Aとその重み(最小全域木の重み)
  */
-std::pair<edges_t, weight_t> kruskal(const graph_t& G)
+template<class Graph, class Traits = traits_of<Graph>>
+static std::pair<basic_edges_t<Traits>, typename Traits::weight_type> kruskal_impl(const Graph& G, kruskal_kind k = kruskal_kind::sort, unsigned threads = 1)
 {
+    using weight_type = typename Traits::weight_type;
+    static_assert(sizeof(typename Traits::index_type) <= sizeof(disjoint_sets::index_t), "disjoint_sets holds 32-bit indices");
+
     const index_t n = G.size();
     disjoint_sets ds(static_cast<std::size_t>(n));  // 互いな素な集合族のためのデータ構造を準備
-    struct cmp { bool operator()(const edge& e, const edge& f) { return e.w < f.w; } };
-    edges_t E;  // グラフGから集合G.Eを取り出す
-    for (auto&& es : G) { for (auto&& e : es) { E.push_back(e); } }
+    basic_edges_t<Traits> E = collect_edges(G);     // グラフGから集合G.Eを取り出す
 
-    weight_t w = 0; edges_t A;             // Aを空集合に初期化し、
-    for (index_t v = 0; v < n; ++v) {      // 各頂点がそれぞれ1つの木である|V|本の木を生成する
-        ds.make_set(v);
-    }
-    std::sort(E.begin(), E.end(), cmp());  // 重みwの非減少順でG.Eの辺をソートする
-    for (auto&& e : E) { // 辺を重みの小さいものから順に検討する
-        // このループでは、各辺(u, v)について、端点uとvが同じ木に属するかどうかを調べる
-        if (ds.find_set(e.src) != ds.find_set(e.dst)) {  // 両端点が同じ木に属さないならば、
-            A.push_back(e); w += e.w;                    // 辺(u, v)をAに加え、
-            ds.merge(e.src, e.dst);                      // 2つの木の頂点集合をマージする
+    weight_type w = 0; basic_edges_t<Traits> A;  // Aを空集合に初期化し、
+    ds.make_all();                               // 各頂点がそれぞれ1つの木である|V|本の木を生成する
+    switch (k) {
+    case kruskal_kind::filter:
+        filter_kruskal(E.begin(), E.end(), ds, n, A, w);
+        break;
+    case kruskal_kind::radix:
+        if constexpr (has_radix_key<weight_type>) {
+            // 重みwの非減少順でG.Eの辺を並列に整列する
+            radix_sort(E, [](const basic_edge<Traits>& e) { return radix_key(static_cast<std::int32_t>(e.w)); }, threads);
+            kruskal_scan(E.begin(), E.end(), ds, n, A, w);
+            break;
         }
+        [[fallthrough]];
+    default:
+        std::sort(E.begin(), E.end(), weight_less());  // 重みwの非減少順でG.Eの辺をソートする
+        kruskal_scan(E.begin(), E.end(), ds, n, A, w);
+        break;
     }
     return std::make_pair(A, w);
 }
 
 
+/**< @brief 隣接リスト表現のグラフGに対してKruskalのアルゴリズムを実行する */
+std::pair<edges_t, weight_t> kruskal(const graph_t& G)
+{
+    return kruskal_impl(G);
+}
+
+
+/**< @brief CSR表現のグラフGに対してKruskalのアルゴリズムを実行する */
+std::pair<edges_t, weight_t> kruskal(const csr_graph& G)
+{
+    return kruskal_impl(G);
+}
+
+
+/**< @brief 辺の整列の方法kを指定して、隣接リスト表現のグラフGに対してKruskalのアルゴリズムを実行する */
+std::pair<edges_t, weight_t> kruskal(const graph_t& G, kruskal_kind k, unsigned threads)
+{
+    return kruskal_impl(G, k, threads);
+}
+
+
+/**< @brief 辺の整列の方法kを指定して、CSR表現のグラフGに対してKruskalのアルゴリズムを実行する */
+std::pair<edges_t, weight_t> kruskal(const csr_graph& G, kruskal_kind k, unsigned threads)
+{
+    return kruskal_impl(G, k, threads);
+}
+
+
+/**< @brief 特性Traitsによる隣接リスト表現のグラフGに対してKruskalのアルゴリズムを実行する */
+template<class Traits>
+std::pair<basic_edges_t<Traits>, typename Traits::weight_type> kruskal(const basic_graph_t<Traits>& G, kruskal_kind k, unsigned threads)
+{
+    return kruskal_impl(G, k, threads);
+}
+
+
+/**< @brief 特性TraitsによるCSR表現のグラフGに対してKruskalのアルゴリズムを実行する */
+template<class Traits>
+std::pair<basic_edges_t<Traits>, typename Traits::weight_type> kruskal(const basic_csr_graph<Traits>& G, kruskal_kind k, unsigned threads)
+{
+    return kruskal_impl(G, k, threads);
+}
+
+
+// 既定以外の特性による版の明示的な実体化. 既定の特性の版と同じkruskal_implを用いる
+#define GRAPH_INSTANTIATE_KRUSKAL(Traits)                                                                                                          \
+    template std::pair<basic_edges_t<Traits>, Traits::weight_type> kruskal<Traits>(const basic_graph_t<Traits>&, kruskal_kind, unsigned);   \
+    template std::pair<basic_edges_t<Traits>, Traits::weight_type> kruskal<Traits>(const basic_csr_graph<Traits>&, kruskal_kind, unsigned);
+
+GRAPH_INSTANTIATE_KRUSKAL(wide_traits)
+GRAPH_INSTANTIATE_KRUSKAL(narrow_traits)
+GRAPH_INSTANTIATE_KRUSKAL(real_traits)
+
+#undef GRAPH_INSTANTIATE_KRUSKAL
+
+
 
 //****************************************
 // 名前空間の終端
@@ -80,6 +230,8 @@ GRAPH_END
 // エントリポイント
 //****************************************
 
+#if !defined(GRAPH_NO_MAIN)  // 他のプログラムにリンクするときはGRAPH_NO_MAINを定義して動作例を除く
+
 int main(void)
 {
     using namespace std;
@@ -115,3 +267,4 @@ int main(void)
     return 0;
 }
 
+#endif  // !defined(GRAPH_NO_MAIN)
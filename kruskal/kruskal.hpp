@@ -20,6 +20,7 @@
 //****************************************
 
 #include "../graph/graph.hpp"
+#include "../graph/csr.hpp"
 
 
 
@@ -31,6 +32,21 @@ GRAPH_BEGIN
 
 
 
+//****************************************
+// 列挙型の定義
+//****************************************
+
+/**
+ * @brief  Kruskalのアルゴリズムで辺を重みの順に検討する方法
+ */
+enum struct kruskal_kind : std::int32_t {
+    sort,    /**< すべての辺を比較に基づいて整列する(Ο(ElgE)) */
+    filter,  /**< Filter-Kruskal. 軸で分割し、軽い辺で森を作ってから、両端点が同じ木に属する重い辺を整列する前に取り除く */
+    radix,   /**< すべての辺を重みのキーで並列に基数ソートする(Ο(E)) */
+};
+
+
+
 //****************************************
 // 関数の宣言
 //****************************************
@@ -54,6 +70,56 @@ std::pair<edges_t, weight_t> kruskal(const graph_t& G);
 
 
 
+/**
+ * @brief  CSR表現のグラフGに対してKruskalのアルゴリズムを実行する
+ * @note   結果はgraph_tに対するkruskalと同じである
+ *
+ * @param  const csr_graph& G グラフG
+ * @return 辺集合Aとその重み(最小全域木の重み)
+ */
+std::pair<edges_t, weight_t> kruskal(const csr_graph& G);
+
+
+
+/**
+ * @brief  辺を重みの順に検討する方法kを指定してKruskalのアルゴリズムを実行する
+ *
+ * @note   最小全域木に含まれる辺は|V| - 1本だけなので、辺の多いグラフではすべての辺を整列するのは無駄が多い
+ *         k = kruskal_kind::filterのときはFilter-Kruskal(Osipov, Sanders and Singler, 2009)を用いる. 辺を軸の重みで分割し、
+ *         軽い辺だけで再帰的に森を作ってから、両端点がすでに同じ木に属する重い辺を取り除いて残りを再帰的に処理する
+ *         取り除かれた辺は整列されないので、密なグラフでは整列の仕事量が大きく減る. 全域木が完成した時点で残りの辺は調べない
+ *
+ * @note   k = kruskal_kind::radixのときは、整数の辺重みをキーとしてthreads本のスレッドで基数ソートを行う(graph/radix_sort.hpp)
+ *         同じ重みの辺が複数あるとき、得られる辺集合Aはkによって異なりうるが、その重みは等しい
+ *
+ * @param  const graph_t& G       グラフG
+ * @param  kruskal_kind   k       辺の整列の方法
+ * @param  unsigned       threads 基数ソートのスレッド数(0ならばハードウェアの並列度)
+ * @return 辺集合Aとその重み(最小全域木の重み)
+ */
+std::pair<edges_t, weight_t> kruskal(const graph_t& G, kruskal_kind k, unsigned threads = 0);
+std::pair<edges_t, weight_t> kruskal(const csr_graph& G, kruskal_kind k, unsigned threads = 0);
+
+
+
+/**
+ * @brief  添字と重みの型を特性Traitsで選んだグラフGに対してKruskalのアルゴリズムを実行する
+ * @note   既定の特性の版と同じ実装(kruskal.cpp)を実体化したものであり、異なるのは添字と重みの型だけである
+ *         kruskal.cppでwide_traits, narrow_traits, real_traitsについて実体化する. 既定の特性による呼び出しには非テンプレートの版が選ばれる
+ *         重みが32ビットの整数のキーに直せない型(wide_traits, real_traits)では、kruskal_kind::radixは比較に基づく整列になる
+ *
+ * @param  const basic_graph_t<Traits>& G       グラフG(またはbasic_csr_graph<Traits>)
+ * @param  kruskal_kind                 k       辺の整列の方法
+ * @param  unsigned                     threads 基数ソートのスレッド数(0ならばハードウェアの並列度)
+ * @return 辺集合Aとその重み(最小全域木の重み)
+ */
+template<class Traits>
+std::pair<basic_edges_t<Traits>, typename Traits::weight_type> kruskal(const basic_graph_t<Traits>& G, kruskal_kind k = kruskal_kind::sort, unsigned threads = 0);
+template<class Traits>
+std::pair<basic_edges_t<Traits>, typename Traits::weight_type> kruskal(const basic_csr_graph<Traits>& G, kruskal_kind k = kruskal_kind::sort, unsigned threads = 0);
+
+
+
 //****************************************
 // 名前空間の終端
 //****************************************
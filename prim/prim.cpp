@@ -11,8 +11,9 @@
 //****************************************
 
 #include <iostream>
-#include <queue>
 #include "../graph/greedy.hpp"
+#include "../graph/heap.hpp"
+#include "../graph/matrix.hpp"
 #include "prim.hpp"
 
 
@@ -29,13 +30,6 @@ GRAPH_BEGIN
 // 関数の定義
 //****************************************
 
-/**< @brief 優先度付きキューをmin優先度付きキューにするための < 演算子定義 */
-static bool operator < (const edge& e, const edge& f) {
-    return e.w > f.w;
-}
-
-
-
 /**
  * @brief  Primのアルゴリズム
  *
@@ -45,45 +39,122 @@ static bool operator < (const edge& e, const edge& f) {
  *         Aに対して安全な辺だけがこの規則によってAに加えられるから、アルゴリズムが終了したとき、Aの辺は最小全域木を形成する
  *         各ステップでは木の重みの増加を限りなく小さく抑える辺を用いて木を成長させるので、これは貪欲戦略である
  *
- * @note   優先度付きキューの優先度更新を行わないため、優先度付きキューが空になるまでに行われる挿入の回数はΟ(E)であるが、
- *         EXTRACT-MIN呼び出し時に、黒頂点であれば無視をすることで、全体としての実行時間をΟ(ElgV)としている
+ * @note   木に属さない各頂点vをキーv.key(vと木に属するある頂点とを結ぶ辺の最小重み)に基づくmin優先度付きキューQに置く
+ *         Qには既定でDECREASE-KEY操作を持つ添字付き4分ヒープを用いるので、各頂点は高々1回しかQに置かれず、
+ *         Qの大きさは|V|で抑えられる. 全体としての実行時間はΟ(ElgV)である
  *
- * @param  const graph_t& G グラフG
- * @param  index_t        r 最小全域木の根
+ * @note   木に含まれた頂点は黒、Qに置かれている頂点は灰で彩色する. v.keyはv.d(Qに置かれたキー)として記録する
+ *
+ * @tparam Heap           DECREASE-KEY操作を持つmin優先度付きキューの型(dary_heap<D>)
+ * @tparam Graph          グラフGの表現(graph_tまたはcsr_graph)
+ * @tparam Vertices       頂点集合の表現(basic_vertices_soa<Traits>またはsearch_workspace). 添字と重みの型はその特性Traitsから定まる
+ * @param  const Graph& G グラフG
+ * @param  index_type   r 最小全域木の根
+ * @param  Vertices&    V 頂点集合V(各頂点のkey値、親、色)
+ * @param  Heap&        Q 空のmin優先度付きキューQ
  */
-std::pair<edges_t, weight_t> prim(const graph_t& G, index_t r)
+template<class Heap, class Graph, class Vertices, class Traits = typename Vertices::traits_type>
+static std::pair<basic_edges_t<Traits>, typename Traits::weight_type> prim_impl(const Graph& G, typename Traits::index_type r, Vertices& V, Heap& Q)
 {
-    index_t n = G.size();
-    stamps_t visited(n);
-    edges_t A;
-    weight_t w;
-
-    for (index_t u = 0; u < n; u++) {
-        visited[u] = false;  // 各頂点を白色に初期化
-    }
-
-    std::priority_queue<edge> Q;
-    Q.emplace(limits::nil, r, w = 0);       // 根rはキーを0に設定する
+    using index_type  = typename Traits::index_type;
+    using weight_type = typename Traits::weight_type;
+    index_type n = G.size();
+    V.resize(n);                     // 各頂点を白色に、親をNILに初期化する
+    basic_edges_t<Traits> A;
+    weight_type w = 0;
+
+    V.paint(r, vcolor::gray);
+    V.d[r] = 0;
+    Q.push(r, 0);                       // 根rはキーを0に設定する
     while (!Q.empty()) {
-        edge e = Q.top(); Q.pop();          // 軽い辺を取り出す
-        index_t u = e.dst;
-        if (visited[u]) { continue; }       // 取り出した辺が安全な辺ではない場合、再びループに戻り条件判定を行う
+        auto p = Q.top(); Q.pop();      // 軽い辺で木と連結される頂点uを取り出す
+        index_type u = p.u;
 
-        for (auto&& f : G[u]) {             // uと隣接し、木に属さない各頂点vの更新を行う
-            if (!visited[f.dst/*頂点v*/]) {
-                Q.push(f);
-            }
+        V.paint(u, vcolor::black);      // 頂点uを黒色に彩色し、
+        w += p.d;                       // 最小重みを更新する
+        if (V.pi[u] != Traits::nil()) { // アルゴリズムが終了したとき、min優先度付きキューは空であり、
+            A.emplace_back(V.pi[u], u, p.d);  // Gに対する最小全域木AはA = { (v.π, v) : v ∈ V - { r } }である
         }
-        visited[u] = true;                  // 頂点uを黒色に彩色し、
-        w += e.w;                           // 最小重みを更新する
-        if (e.src != limits::nil) {  // アルゴリズムが終了したとき、min優先度付きキューは空であり、
-            A.emplace_back(e);       // Gに対する最小全域木AはA = { (v, v.π) : v ∈ V - { r } }である
+
+        for (auto&& e : G[u]) {         // uと隣接し、木に属さない各頂点vの更新を行う
+            index_type v = e.dst;
+            if (V.color(v) != vcolor::black && Q.push(v, e.w)) {  // w(u, v) < v.keyならば、v.keyを減らし(DECREASE-KEY)、
+                V.paint(v, vcolor::gray);
+                V.d[v]  = e.w;
+                V.pi[v] = u;                                      // v.πを更新する
+            }
         }
     }
     return std::make_pair(A, w);
 }
 
 
+/**< @brief 頂点集合とmin優先度付きキューQ(省略すればdary_heap<4, Traits>)を生成してPrimのアルゴリズムを実行する */
+template<class Heap = void, class Graph, class Traits = traits_of<Graph>>
+static std::pair<basic_edges_t<Traits>, typename Traits::weight_type> prim_impl(const Graph& G, typename Traits::index_type r)
+{
+    basic_vertices_soa<Traits> V;
+    std::conditional_t<std::is_void_v<Heap>, dary_heap<4, Traits>, Heap> Q(G.size());
+    return prim_impl(G, r, V, Q);
+}
+
+
+/**< @brief 隣接リスト表現のグラフGに対してPrimのアルゴリズムを実行する */
+std::pair<edges_t, weight_t> prim(const graph_t& G, index_t r)
+{
+    return prim_impl(G, r);
+}
+
+
+/**< @brief CSR表現のグラフGに対してPrimのアルゴリズムを実行する */
+std::pair<edges_t, weight_t> prim(const csr_graph& G, index_t r)
+{
+    return prim_impl(G, r);
+}
+
+
+/**< @brief 隣接リスト表現のグラフGに対して、作業領域Wを使い回してPrimのアルゴリズムを実行する */
+std::pair<edges_t, weight_t> prim(const graph_t& G, index_t r, search_workspace& W)
+{
+    return prim_impl(G, r, W, W.Q);
+}
+
+
+/**< @brief CSR表現のグラフGに対して、作業領域Wを使い回してPrimのアルゴリズムを実行する */
+std::pair<edges_t, weight_t> prim(const csr_graph& G, index_t r, search_workspace& W)
+{
+    return prim_impl(G, r, W, W.Q);
+}
+
+
+/**< @brief 特性Traitsによる隣接リスト表現のグラフGに対してPrimのアルゴリズムを実行する */
+template<class Traits>
+std::pair<basic_edges_t<Traits>, typename Traits::weight_type> prim(const basic_graph_t<Traits>& G, typename Traits::index_type r)
+{
+    return prim_impl(G, r);
+}
+
+
+/**< @brief 特性TraitsによるCSR表現のグラフGに対してPrimのアルゴリズムを実行する */
+template<class Traits>
+std::pair<basic_edges_t<Traits>, typename Traits::weight_type> prim(const basic_csr_graph<Traits>& G, typename Traits::index_type r)
+{
+    return prim_impl(G, r);
+}
+
+
+// 既定以外の特性による版の明示的な実体化. 既定の特性の版と同じprim_implを用いる
+#define GRAPH_INSTANTIATE_PRIM(Traits)                                                                                                    \
+    template std::pair<basic_edges_t<Traits>, Traits::weight_type> prim<Traits>(const basic_graph_t<Traits>&, Traits::index_type);   \
+    template std::pair<basic_edges_t<Traits>, Traits::weight_type> prim<Traits>(const basic_csr_graph<Traits>&, Traits::index_type);
+
+GRAPH_INSTANTIATE_PRIM(wide_traits)
+GRAPH_INSTANTIATE_PRIM(narrow_traits)
+GRAPH_INSTANTIATE_PRIM(real_traits)
+
+#undef GRAPH_INSTANTIATE_PRIM
+
+
 /**
  * @brief  Primのアルゴリズム
  *
@@ -98,39 +169,60 @@ std::pair<edges_t, weight_t> prim(const graph_t& G, index_t r)
  *
  * @note   グラフG = (V, E)が隣接行列によって与えられたとき、Ο(V^2)で走るPrimのアルゴリズムは以下のように実現できる
  *
- * @param  const matrix_t& W 隣接行列W
- * @param  index_t         r 最小全域木の根
+ * @note   頂点の属性は配列の構造体として持つ. qは木Aに属さない頂点ではv.key、属する頂点では∞であり、extract_minはqだけを走査する
+ *         第u行の走査は、選択(条件が偽ならば元の値を残す)だけで書いた分岐のないループなので、-O3などでコンパイラが自動でベクトル化できる
+ *         結果(キー、親、選ばれる頂点の順序)はvertices_tを直接更新する場合と同じである
+ *
+ * @tparam Matrix            隣接行列の表現(matrix_tまたはdense_matrix)
+ * @param  const Matrix& W   隣接行列W
+ * @param  index_t       r   最小全域木の根
  */
-std::pair<vertices_t, weight_t> prim(const matrix_t& W, index_t r)
+template<class Matrix>
+static std::pair<vertices_t, weight_t> prim_matrix_impl(const Matrix& W, index_t r)
 {
     index_t n = W.size();
-    vertices_t A(n);
-    weight_t w;
-
-    for (auto&& u : A) {
-        u.key = limits::inf;  // 各頂点のキーを∞に設定する
-        u.pi  = limits::nil;  // 各頂点の親をNILに設定する
-        u.visited = false;
-    }
+    array_t   key(n, limits::inf), q(n, limits::inf);  // 各頂点のキーを∞に設定する
+    indices_t pi(n, limits::nil);                      // 各頂点の親をNILに設定する
+    stamps_t  visited(n, false);
+    weight_t  w;
 
-    A[r].key = w = 0;         // 根rは例外で最初に処理されるようにキーの値を0に設定する
+    q[r] = w = 0;             // 根rは例外で最初に処理されるようにキーの値を0に設定する
     while (true) {
         // 最小全域木Aに属さないある孤立点(Aの辺と接続していない頂点)を連結する軽い辺を探す
-        index_t u = extract_min(A, n);
+        index_t u = extract_min(q.data(), n);
         if (u == limits::nil) { break; }   // 頂点uがNILを指すならば、探索は終了であり、最小全域木Aは A = {(v, v.π) : v ∈ V - { r } }である
-        for (index_t v = 0; v < n; ++v) {  // 頂点uの隣接行列の走査を行う
-            if (W[u][v] < A[v].key) {      // 白または、灰頂点に対しては、属性の更新確認を行う必要がある
-                A[v].pi  = u;              // vのπ属性と
-                A[v].key = W[u][v];        // key属性を更新する
-            }
+        visited[u] = true;    // 辺(u, u.π)を最小全域木Aに加える(ただし、根rは例外)
+        key[u] = q[u];
+        w += key[u];          // 最小重みを更新
+        q[u] = limits::inf;
+        const weight_t* wu = W[u].data();
+        for (index_t v = 0; v < n; ++v) {                   // 頂点uの隣接行列の走査を行う
+            bool c = !visited[v] && wu[v] < q[v];           // 白または、灰頂点に対しては、属性の更新確認を行う必要がある
+            pi[v] = c ? u : pi[v];                          // vのπ属性と
+            q[v]  = c ? wu[v] : q[v];                       // key属性を更新する
         }
-        A[u].visited = true;  // 辺(u, u.π)を最小全域木Aに加える(ただし、根rは例外)
-        w += A[u].key;        // 最小重みを更新
     }
+
+    vertices_t A(n);
+    for (index_t v = 0; v < n; ++v) { A[v].key = visited[v] ? key[v] : q[v]; A[v].pi = pi[v]; A[v].visited = visited[v]; }
     return std::make_pair(A, w);
 }
 
 
+/**< @brief 隣接行列Wで表されたグラフに対してPrimのアルゴリズムを実行する */
+std::pair<vertices_t, weight_t> prim(const matrix_t& W, index_t r)
+{
+    return prim_matrix_impl(W, r);
+}
+
+
+/**< @brief 密な行列Wで表されたグラフに対してPrimのアルゴリズムを実行する */
+std::pair<vertices_t, weight_t> prim(const dense_matrix& W, index_t r)
+{
+    return prim_matrix_impl(W, r);
+}
+
+
 
 //****************************************
 // 名前空間の終端
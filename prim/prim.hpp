@@ -20,6 +20,9 @@
 //****************************************
 
 #include "../graph/graph.hpp"
+#include "../graph/csr.hpp"
+#include "../graph/matrix.hpp"
+#include "../graph/workspace.hpp"
 
 
 
@@ -44,8 +47,8 @@ GRAPH_BEGIN
  *         Aに対して安全な辺だけがこの規則によってAに加えられるから、アルゴリズムが終了したとき、Aの辺は最小全域木を形成する
  *         各ステップでは木の重みの増加を限りなく小さく抑える辺を用いて木を成長させるので、これは貪欲戦略である
  *
- * @note   優先度付きキューの優先度更新を行わないため、優先度付きキューが空になるまで行われる挿入の回数はΟ(E)であるが、
- *         EXTRACT-MIN呼び出し時に、黒頂点であれば無視をすることで、全体としての実行時間をΟ(ElgV)としている
+ * @note   min優先度付きキューにはDECREASE-KEY操作を持つ添字付き4分ヒープを用いる(graph/heap.hpp)
+ *         各頂点は高々1回しかキューに置かれないので、キューの大きさは|V|で抑えられ、全体としての実行時間はΟ(ElgV)である
  *
  * @param  const graph_t& G グラフG
  * @param  index_t        r 最小全域木の根
@@ -54,6 +57,46 @@ std::pair<edges_t, weight_t> prim(const graph_t& G, index_t r = 0);
 
 
 
+/**
+ * @brief  CSR表現のグラフGに対してPrimのアルゴリズムを実行する
+ * @note   結果はgraph_tに対するprimと同じである
+ *
+ * @param  const csr_graph& G グラフG
+ * @param  index_t          r 最小全域木の根
+ */
+std::pair<edges_t, weight_t> prim(const csr_graph& G, index_t r = 0);
+
+
+
+/**
+ * @brief  作業領域Wを使い回してPrimのアルゴリズムを実行する
+ * @note   Wの頂点属性は触れた頂点だけが初期化されるので、1回の呼び出しの時間はrを含む連結成分の頂点と辺の数だけで決まり、|V|には依存しない
+ *         実行後、木に含まれた頂点は黒色であり、W.pred(v)は木におけるvの親、W.dist(v)はvを木に加えた辺の重みである
+ *
+ * @param  const graph_t&    G グラフG
+ * @param  index_t           r 最小全域木の根
+ * @param  search_workspace& W 作業領域(ヒープW.Qも使い回す)
+ */
+std::pair<edges_t, weight_t> prim(const graph_t& G, index_t r, search_workspace& W);
+std::pair<edges_t, weight_t> prim(const csr_graph& G, index_t r, search_workspace& W);
+
+
+
+/**
+ * @brief  添字と重みの型を特性Traitsで選んだグラフGに対してPrimのアルゴリズムを実行する
+ * @note   既定の特性の版と同じ実装(prim.cpp)を実体化したものであり、異なるのは添字と重みの型だけである
+ *         prim.cppでwide_traits, narrow_traits, real_traitsについて実体化する. 既定の特性による呼び出しには非テンプレートの版が選ばれる
+ *
+ * @param  const basic_graph_t<Traits>& G グラフG(またはbasic_csr_graph<Traits>)
+ * @param  index_type                   r 最小全域木の根
+ */
+template<class Traits>
+std::pair<basic_edges_t<Traits>, typename Traits::weight_type> prim(const basic_graph_t<Traits>& G, typename Traits::index_type r = 0);
+template<class Traits>
+std::pair<basic_edges_t<Traits>, typename Traits::weight_type> prim(const basic_csr_graph<Traits>& G, typename Traits::index_type r = 0);
+
+
+
 /**
  * @brief  Primのアルゴリズム
  *
@@ -72,6 +115,14 @@ std::pair<vertices_t, weight_t> prim(const matrix_t& M, index_t r = 0);
 
 
 
+/**
+ * @brief  1本の整列された領域に格納した密な行列Mで表されたグラフに対してPrimのアルゴリズムを実行する
+ * @note   結果はmatrix_tに対するprimと同じである
+ */
+std::pair<vertices_t, weight_t> prim(const dense_matrix& M, index_t r = 0);
+
+
+
 //****************************************
 // 名前空間の終端
 //****************************************
@@ -0,0 +1,503 @@
+/**
+ * @brief  最大フローを求めるプッシュ再ラベル法(push-relabel method)を扱う
+ *
+ * @note   Ford-Fulkerson法が増加可能経路に沿ってフローを流すのに対し、プッシュ再ラベル法は各頂点を局所的に処理する
+ *         処理の途中ではフロー保存則の代わりに、各頂点u ∈ V - { s }への流入量が流出量以上であることだけを要請する(プリフロー(preflow))
+ *         流入量と流出量の差を超過(excess)u.eと呼び、u.e > 0である頂点uをあふれている(overflowing)という
+ *
+ *         各頂点uは高さ(height)u.hを持ち、残余辺(u, v)について常にu.h <= v.h + 1が成り立つ(高さ関数)
+ *           PUSH(u, v)  : uがあふれていて、cf(u, v) > 0かつu.h = v.h + 1ならば、min(u.e, cf(u, v))をuからvへ押し出す
+ *           RELABEL(u)  : uがあふれていて、どの残余辺(u, v)についてもu.h <= v.hならば、u.hを1 + min{ v.h : (u, v) ∈ Ef }に上げる
+ *         あふれている頂点がなくなったとき、プリフローは最大フローになっている
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef PUSH_RELABEL_HPP
+#define PUSH_RELABEL_HPP
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "../graph/graph.hpp"
+#include "../graph/residual.hpp"
+#include "../graph/parallel.hpp"
+#include <cstdint>
+#include <atomic>
+#include <algorithm>
+#include <queue>
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief 最高ラベル(highest-label)プッシュ再ラベルアルゴリズム
+ *
+ * @note  あふれている頂点のうち最も高いものから順に放出(discharge)する. 実行時間はΟ(V^2√E)である
+ *        実用上の速さは次の2つの発見的手法による
+ *          ギャップ(gap) : 高さk < |V|の頂点がなくなったならば、高さがkより大きく|V|より小さい頂点からは出口tに到達できない
+ *                          これらの頂点の高さを一度に|V| + 1まで上げる
+ *          大域的再ラベル(global relabeling) : 一定量の仕事ごとに、出口tから残余辺を逆向きに幅優先探索し、すべての高さを残余ネットワークでのtへの距離にする
+ *                          tに到達できない頂点の高さは|V|にする
+ *
+ * @note  処理は2段階に分ける. 第1段階では高さが|V|未満の頂点だけを放出し、最小カットの値(= 最大フローの値)を求める
+ *        第2段階では残りのあふれている頂点からフローを入口sへ押し戻し、プリフローをフローにする
+ *        残余ネットワークGfは対になった残余辺の配列(residual_network)で表す. 記憶量はΘ(V + E)である
+ */
+struct push_relabel {
+    residual_network Gf;                 /**< 残余ネットワークGf */
+    indices_t h;                         /**< 頂点uの高さu.h */
+    indices_t cur;                       /**< 現在の弧 */
+    std::vector<std::int64_t> ex;        /**< 頂点uの超過u.e */
+    std::vector<indices_t> active;       /**< active[k] : 高さkのあふれている頂点(古い要素を含みうる) */
+    std::vector<indices_t> layer;        /**< layer[k] : 高さk < |V|のすべての頂点 */
+    indices_t where;                     /**< 頂点uのlayer[u.h]での位置 */
+    index_t n;                           /**< 頂点v ∈ Vの数 */
+
+    explicit push_relabel(std::size_t size) : Gf(size), n(size) { }
+    explicit push_relabel(const graph_t& G) : push_relabel(G.size())
+    {
+        for (index_t i = 0; i < n; ++i) { for (auto&& e : G[i]) { add_edge(e.src, e.dst, e.c); } }
+    }
+
+    /**
+     * @brief  容量capの辺(u, v)を加える
+     * @return 加えた辺の番号(flowで辺のフローを調べるときに用いる)
+     */
+    index_t add_edge(index_t u, index_t v, capacity_t cap) { return Gf.add_edge(u, v, cap); }
+
+    /**
+     * @brief  最高ラベルプッシュ再ラベルアルゴリズムを実行する
+     * @note   すでにフローが流れていれば、そのフローから始めて増やした量を返す
+     * @param  index_t s フローネットワークの入口(source) s
+     * @param  index_t t フローネットワークの出口(sink) t
+     * @return フローネットワークの最大フロー
+     */
+    capacity_t compute(index_t s, index_t t)
+    {
+        Gf.build();
+        if (s == t) { return 0; }
+        initialize(s, t);
+
+        // 第1段階 : 高さが|V|未満の頂点だけを放出する. 終了時のtの超過が最大フローの値である
+        limit = n;
+        global_relabel();
+        run(true);
+
+        // 第2段階 : 残りのあふれている頂点からフローをsへ押し戻す
+        return_excess();
+        return static_cast<capacity_t>(ex[t]);
+    }
+
+    /**< @brief k番目に加えた辺のフローを返す */
+    capacity_t flow(index_t k) const { return Gf.flow(k); }
+
+protected:
+    /**< @brief INITIALIZE-PREFLOW : 作業領域を初期化し、sから出るすべての残余辺を飽和させる */
+    void initialize(index_t s, index_t t)
+    {
+        h.assign(n, 0); ex.assign(n, 0);
+        cur.assign(Gf.offset.begin(), Gf.offset.end() - 1);
+        active.assign(2 * n + 1, indices_t());
+        layer.assign(n, indices_t());
+        where.assign(n, 0);
+        this->s = s; this->t = t;
+
+        h[s] = n;
+        for (index_t a = Gf.offset[s]; a < Gf.offset[s + 1]; ++a) {
+            capacity_t x = Gf.cf[a];
+            if (x == 0) { continue; }
+            Gf.push(a, x);
+            ex[Gf.dst[a]] += x; ex[s] -= x;
+        }
+    }
+
+    /**
+     * @brief  第2段階 : 高さ関数hとプリフローから始めて、あふれているすべての頂点の超過をsへ押し戻す
+     * @note   第1段階の後ではtに到達できない頂点だけがあふれているので、ギャップと大域的再ラベルは用いない
+     */
+    void return_excess()
+    {
+        limit = 2 * n;
+        highest = -1;
+        for (auto&& A : active) { A.clear(); }
+        for (index_t v = 0; v < n; ++v) {
+            cur[v] = Gf.offset[v];
+            if (ex[v] > 0) { activate(v); }
+        }
+        run(false);
+    }
+
+    index_t s = 0, t = 0;        /**< 入口sと出口t */
+    index_t limit = 0;           /**< 放出する頂点の高さの上限 */
+    index_t highest = -1;        /**< あふれている頂点の高さの上界 */
+    index_t maxlayer = -1;       /**< 空でないlayerの高さの上界 */
+    std::size_t work = 0;        /**< 前回の大域的再ラベルからの仕事量 */
+
+    /**< @brief あふれている頂点vを放出の候補にする */
+    void activate(index_t v)
+    {
+        if (v == s || v == t || h[v] >= limit) { return; }
+        active[h[v]].push_back(v);
+        highest = std::max(highest, h[v]);
+    }
+
+    void add_layer(index_t v)
+    {
+        where[v] = static_cast<index_t>(layer[h[v]].size());
+        layer[h[v]].push_back(v);
+        maxlayer = std::max(maxlayer, h[v]);
+    }
+
+    void remove_layer(index_t v)
+    {
+        indices_t& L = layer[h[v]];
+        index_t u = L.back();
+        L[where[v]] = u; where[u] = where[v];
+        L.pop_back();
+    }
+
+    /**< @brief 高さがkより大きく|V|より小さいすべての頂点の高さを|V| + 1にする(ギャップ) */
+    void gap(index_t k)
+    {
+        for (index_t j = k + 1; j <= maxlayer; ++j) {
+            for (auto&& u : layer[j]) { h[u] = n + 1; }
+            layer[j].clear();
+        }
+        maxlayer = k - 1;
+    }
+
+    /**< @brief 出口tから残余辺を逆向きに幅優先探索し、すべての頂点の高さをtへの距離にする */
+    void global_relabel()
+    {
+        h.assign(n, n);
+        for (auto&& L : layer)  { L.clear(); }
+        for (auto&& A : active) { A.clear(); }
+        highest = maxlayer = -1;
+
+        std::queue<index_t> Q;
+        h[t] = 0;
+        Q.push(t);
+        while (!Q.empty()) {
+            index_t u = Q.front(); Q.pop();
+            for (index_t b = Gf.offset[u]; b < Gf.offset[u + 1]; ++b) {
+                index_t v = Gf.dst[b];
+                if (h[v] != n || v == s || Gf.cf[Gf.rev[b]] == 0) { continue; }  // 残余辺(v, u)が存在するか？
+                h[v] = h[u] + 1;
+                Q.push(v);
+            }
+        }
+        for (index_t v = 0; v < n; ++v) {
+            cur[v] = Gf.offset[v];
+            if (h[v] < n) { add_layer(v); }
+            if (ex[v] > 0) { activate(v); }
+        }
+        work = 0;
+    }
+
+    /**< @brief RELABEL(v) : vの高さを1 + min{ w.h : (v, w) ∈ Ef }に上げる */
+    void relabel(index_t v, bool first)
+    {
+        index_t old = h[v], nh = 2 * n;
+        for (index_t a = Gf.offset[v]; a < Gf.offset[v + 1]; ++a) {
+            if (Gf.cf[a] > 0) { nh = std::min(nh, h[Gf.dst[a]] + 1); }
+        }
+        work += Gf.offset[v + 1] - Gf.offset[v] + 12;
+        cur[v] = Gf.offset[v];
+
+        if (!first) { h[v] = nh; return; }
+        remove_layer(v);
+        if (layer[old].empty()) {  // 高さoldの頂点がなくなったので、ギャップの発見的手法を適用する
+            gap(old);
+            h[v] = n + 1;
+            return;
+        }
+        h[v] = nh;
+        if (nh < n) { add_layer(v); }
+    }
+
+    /**< @brief あふれている頂点vを、超過がなくなるか高さがlimitに達するまで放出する */
+    void discharge(index_t v, bool first)
+    {
+        while (ex[v] > 0) {
+            if (cur[v] == Gf.offset[v + 1]) {
+                relabel(v, first);
+                if (h[v] >= limit) { break; }
+                continue;
+            }
+            index_t a = cur[v], w = Gf.dst[a];
+            if (Gf.cf[a] > 0 && h[v] == h[w] + 1) {  // PUSH(v, w)
+                capacity_t x = static_cast<capacity_t>(std::min<std::int64_t>(ex[v], Gf.cf[a]));
+                Gf.push(a, x);
+                if (ex[w] == 0) { activate(w); }
+                ex[w] += x; ex[v] -= x;
+            }
+            else {
+                ++cur[v];
+            }
+        }
+    }
+
+    /**< @brief 最も高いあふれている頂点から順に放出する */
+    void run(bool first)
+    {
+        const std::size_t period = 6 * static_cast<std::size_t>(n) + Gf.cf.size();
+        while (true) {
+            while (highest >= 0 && active[highest].empty()) { --highest; }
+            if (highest < 0) { break; }
+            index_t v = active[highest].back(); active[highest].pop_back();
+            if (h[v] != highest || ex[v] <= 0) { continue; }  // 古い要素は捨てる
+            discharge(v, first);
+            if (first && work > period) { global_relabel(); }
+        }
+    }
+};
+
+
+
+/**
+ * @brief 複数のスレッドで同時に放出を行う同期型のプッシュ再ラベルアルゴリズム
+ *
+ * @note  各ラウンドでは、あふれているすべての頂点を古い高さhに基づいてスレッドで分担して放出し、ラウンドの終わりに新しい高さを一斉に反映する
+ *        あふれている2頂点v, wが互いに押し出し合うことのないように、vからwへ押し出せるのはwがあふれていないか、vがwに勝つ場合だけとする
+ *          vがwに勝つ  ⇔  v.h = w.h + 1  または  v.h < w.h - 1  または  (v.h = w.h かつ v < w)
+ *        残余容量と、押し出された頂点の超過の増分は不可分操作(atomic)で更新するので、ロックは用いない
+ *        ある頂点に押し出したスレッドのうち、比較交換に勝った1本だけがその頂点を次のラウンドのあふれている頂点の列に加える
+ *
+ * @note  第1段階(高さが|V|未満の頂点の放出)をthreads本のスレッドで行う. 一定量の仕事ごとに、大域的再ラベルを段同期の並列幅優先探索で行う
+ *        第2段階(超過をsへ押し戻す)はpush_relabelと同じく逐次に行う. 第1段階でほとんどの仕事が済むので、全体の実行時間には大きく影響しない
+ *
+ * @note  J. Baumstark, G. Blelloch, J. Shun, "Efficient Implementation of a Synchronous Parallel Push-Relabel Algorithm", ESA 2015
+ */
+struct parallel_push_relabel : push_relabel {
+    explicit parallel_push_relabel(std::size_t size, unsigned threads = 0) : push_relabel(size), threads(resolve_threads(threads)) { }
+    explicit parallel_push_relabel(const graph_t& G, unsigned threads = 0) : push_relabel(G), threads(resolve_threads(threads)) { }
+
+    /**
+     * @brief  同期型の並列プッシュ再ラベルアルゴリズムを実行する
+     * @param  index_t s フローネットワークの入口(source) s
+     * @param  index_t t フローネットワークの出口(sink) t
+     * @return フローネットワークの最大フロー
+     */
+    capacity_t compute(index_t s, index_t t)
+    {
+        Gf.build();
+        if (s == t) { return 0; }
+        initialize(s, t);
+
+        const std::size_t na = Gf.cf.size();
+        cf = std::vector<std::atomic<capacity_t>>(na);
+        for (std::size_t a = 0; a < na; ++a) { cf[a].store(Gf.cf[a], std::memory_order_relaxed); }
+        label = std::vector<std::atomic<index_t>>(n);
+        added = std::vector<std::atomic<std::int64_t>>(n);
+        claimed = std::vector<std::atomic<std::uint8_t>>(n);
+        for (index_t v = 0; v < n; ++v) { added[v].store(0, std::memory_order_relaxed); claimed[v].store(0, std::memory_order_relaxed); }
+        next_label.assign(n, 0);
+        is_active.assign(n, 0);
+        local.assign(threads, indices_t());
+
+        run_parallel();
+
+        // 第2段階のために、残余容量と高さを逐次版の作業領域に戻す
+        for (std::size_t a = 0; a < na; ++a) { Gf.cf[a] = cf[a].load(std::memory_order_relaxed); }
+        for (index_t v = 0; v < n; ++v) { h[v] = label[v].load(std::memory_order_relaxed); }
+        h[s] = n;
+        return_excess();
+        return static_cast<capacity_t>(ex[t]);
+    }
+
+private:
+    unsigned threads;                                  /**< スレッド数 */
+    std::vector<std::atomic<capacity_t>> cf;           /**< 残余辺aの残余容量 */
+    std::vector<std::atomic<index_t>> label;           /**< ラウンドの始めの高さ */
+    std::vector<std::atomic<std::int64_t>> added;      /**< ラウンド中に押し出された超過の増分 */
+    std::vector<std::atomic<std::uint8_t>> claimed;    /**< 次のラウンドのあふれている頂点の列にすでに加えたか？ */
+    indices_t next_label;                              /**< ラウンドの終わりに反映する新しい高さ */
+    std::vector<std::uint8_t> is_active;               /**< ラウンドの始めにあふれているか？ */
+    indices_t A;                                       /**< このラウンドで放出する頂点の列 */
+    std::vector<indices_t> local;                      /**< スレッドごとの次のラウンドの頂点の列 */
+    std::atomic<std::size_t> cursor{0}, total_work{0};
+
+    index_t height(index_t v) const { return label[v].load(std::memory_order_relaxed); }
+
+    /**< @brief 頂点wを次のラウンドの列に加える(加えるのは比較交換に勝ったスレッドだけ) */
+    void claim(index_t w, indices_t& out)
+    {
+        if (w == s || w == t) { return; }
+        if (claimed[w].exchange(1, std::memory_order_relaxed) == 0) { out.push_back(w); }
+    }
+
+    /**< @brief vがwに勝つか？(古い高さで判定する) */
+    bool wins(index_t v, index_t w) const
+    {
+        index_t hv = height(v), hw = height(w);
+        return hv == hw + 1 || hv < hw - 1 || (hv == hw && v < w);
+    }
+
+    /**< @brief あふれている頂点vを古い高さに基づいて放出する. 新しい高さはnext_label[v]に置く */
+    std::size_t discharge_round(index_t v, indices_t& out)
+    {
+        std::int64_t e = ex[v];
+        index_t d = height(v);
+        std::size_t scanned = 0;
+        while (e > 0) {
+            index_t nh = n;
+            bool skipped = false;
+            for (index_t a = Gf.offset[v]; a < Gf.offset[v + 1] && e > 0; ++a) {
+                capacity_t c = cf[a].load(std::memory_order_relaxed);
+                if (c == 0) { continue; }
+                index_t w = Gf.dst[a], hw = height(w);
+                bool admissible = d == hw + 1;
+                if (admissible && is_active[w] && !wins(v, w)) { admissible = false; skipped = true; }
+                if (admissible) {  // PUSH(v, w)
+                    capacity_t x = static_cast<capacity_t>(std::min<std::int64_t>(e, c));
+                    cf[a].fetch_sub(x, std::memory_order_relaxed);
+                    cf[Gf.rev[a]].fetch_add(x, std::memory_order_relaxed);
+                    added[w].fetch_add(x, std::memory_order_relaxed);
+                    claim(w, out);
+                    e -= x; c -= x;
+                }
+                if (c > 0 && hw >= d) { nh = std::min(nh, hw + 1); }
+            }
+            scanned += Gf.offset[v + 1] - Gf.offset[v] + 12;
+            if (e == 0 || skipped) { break; }
+            d = nh;            // RELABEL(v)
+            if (d >= n) { break; }
+        }
+        ex[v] = e;
+        next_label[v] = d;
+        if (e > 0 && d < n) { claim(v, out); }
+        return scanned;
+    }
+
+    /**< @brief 第1段階をthreads本のスレッドで行う */
+    void run_parallel()
+    {
+        constexpr std::size_t chunk = 16;
+        const std::size_t period = 6 * static_cast<std::size_t>(n) + Gf.cf.size();
+        indices_t frontier, nextfrontier;   // 大域的再ラベルの幅優先探索のフロンティア
+        bool relabel_now = true, done = false;
+        barrier sync(threads);
+
+        parallel_run(threads, [&](unsigned tid) {
+            const std::size_t first = static_cast<std::size_t>(n) * tid / threads;
+            const std::size_t last  = static_cast<std::size_t>(n) * (tid + 1) / threads;
+            while (true) {
+                if (relabel_now) {
+                    // 大域的再ラベル : tから残余辺を逆向きに段同期で幅優先探索する
+                    for (std::size_t v = first; v < last; ++v) { label[v].store(n, std::memory_order_relaxed); }
+                    sync.arrive_and_wait();
+                    if (tid == 0) { label[t].store(0, std::memory_order_relaxed); frontier.assign(1, t); cursor = 0; }
+                    sync.arrive_and_wait();
+                    for (index_t level = 1; !frontier.empty(); ++level) {
+                        for (std::size_t i; (i = cursor.fetch_add(chunk, std::memory_order_relaxed)) < frontier.size(); ) {
+                            for (std::size_t j = i; j < std::min(i + chunk, frontier.size()); ++j) {
+                                index_t u = frontier[j];
+                                for (index_t b = Gf.offset[u]; b < Gf.offset[u + 1]; ++b) {
+                                    index_t v = Gf.dst[b], unvisited = n;
+                                    if (v == s || cf[Gf.rev[b]].load(std::memory_order_relaxed) == 0) { continue; }
+                                    if (label[v].load(std::memory_order_relaxed) == n &&
+                                        label[v].compare_exchange_strong(unvisited, level, std::memory_order_relaxed)) {
+                                        local[tid].push_back(v);
+                                    }
+                                }
+                            }
+                        }
+                        sync.arrive_and_wait();
+                        if (tid == 0) {
+                            nextfrontier.clear();
+                            for (auto&& L : local) { nextfrontier.insert(nextfrontier.end(), L.begin(), L.end()); L.clear(); }
+                            frontier.swap(nextfrontier);
+                            cursor = 0;
+                        }
+                        sync.arrive_and_wait();
+                    }
+                    // 高さが|V|未満のあふれている頂点を集める
+                    for (std::size_t v = first; v < last; ++v) {
+                        index_t u = static_cast<index_t>(v);
+                        if (u != s && u != t && ex[u] > 0 && height(u) < n) { local[tid].push_back(u); }
+                    }
+                    sync.arrive_and_wait();
+                    if (tid == 0) {
+                        for (auto&& v : A) { is_active[v] = 0; }
+                        A.clear();
+                        for (auto&& L : local) { A.insert(A.end(), L.begin(), L.end()); L.clear(); }
+                        for (auto&& v : A) { is_active[v] = 1; }
+                        relabel_now = false;
+                        total_work = 0;
+                        cursor = 0;
+                        done = A.empty();
+                    }
+                    sync.arrive_and_wait();
+                }
+                if (done) { break; }
+
+                // 1ラウンド : Aの頂点を古い高さに基づいて放出する
+                std::size_t work_done = 0;
+                for (std::size_t i; (i = cursor.fetch_add(chunk, std::memory_order_relaxed)) < A.size(); ) {
+                    for (std::size_t j = i; j < std::min(i + chunk, A.size()); ++j) { work_done += discharge_round(A[j], local[tid]); }
+                }
+                total_work.fetch_add(work_done, std::memory_order_relaxed);
+                sync.arrive_and_wait();
+
+                // 新しい高さと超過の増分を反映する(Aの各頂点の高さと、次の列の各頂点の超過はそれぞれ1本のスレッドだけが書き換える)
+                for (std::size_t j = first * A.size() / n; j < last * A.size() / n; ++j) {
+                    label[A[j]].store(next_label[A[j]], std::memory_order_relaxed);
+                }
+                for (auto&& w : local[tid]) {
+                    ex[w] += added[w].exchange(0, std::memory_order_relaxed);
+                    claimed[w].store(0, std::memory_order_relaxed);
+                }
+                sync.arrive_and_wait();
+
+                if (tid == 0) {
+                    ex[t] += added[t].exchange(0, std::memory_order_relaxed);
+                    ex[s] += added[s].exchange(0, std::memory_order_relaxed);
+                    for (auto&& v : A) { is_active[v] = 0; }
+                    A.clear();
+                    for (auto&& L : local) {
+                        for (auto&& v : L) { if (ex[v] > 0 && height(v) < n) { A.push_back(v); } }
+                        L.clear();
+                    }
+                    for (auto&& v : A) { is_active[v] = 1; }
+                    cursor = 0;
+                    relabel_now = total_work.load(std::memory_order_relaxed) > period;
+                    done = A.empty() && !relabel_now;
+                }
+                sync.arrive_and_wait();
+            }
+        });
+    }
+};
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
+
+
+
+#endif  // end of PUSH_RELABEL_HPP
@@ -0,0 +1,166 @@
+/**
+ * @brief  共有グラフに対する問い合わせエンジンの実装
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "query_engine.hpp"
+#include "../dijkstra/dijkstra.hpp"
+#include <algorithm>
+#include <exception>
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+namespace {
+
+    /**< @brief Gから、残余辺の配列を並べ終えたフローネットワークを作る */
+    dinic make_network(const graph_t& G)
+    {
+        dinic D(G);
+        D.Gf.build();
+        return D;
+    }
+
+
+    /**
+     * @brief  作業領域Wを用いた幅優先探索で、sからtに到達できるかを調べる
+     * @note   tを発見した時点で打ち切る
+     */
+    bool reach(const csr_graph& G, index_t s, index_t t, search_workspace& W)
+    {
+        if (s == t) { return true; }
+        W.resize(G.size());
+        W.paint(s, vcolor::gray);
+        W.fifo.assign(1, s);
+        for (std::size_t head = 0; head < W.fifo.size(); ) {
+            index_t u = W.fifo[head++];
+            for (auto&& e : G[u]) {
+                if (W.color(e.dst) != vcolor::white) { continue; }
+                if (e.dst == t) { return true; }
+                W.paint(e.dst, vcolor::gray);
+                W.fifo.push_back(e.dst);
+            }
+        }
+        return false;
+    }
+
+}
+
+
+/**< @brief 隣接リスト表現Gを複製して、threads本の作業スレッドを持つエンジンを生成する */
+query_engine::query_engine(const graph_t& G, unsigned threads, std::size_t chunk)
+    : G(G), network(make_network(G)), chunk(std::max<std::size_t>(chunk, 1)), local(resolve_threads(threads)), pool(threads)
+{
+    for (auto&& x : local) { x.W.resize(G.size()); }
+}
+
+
+/**< @brief 作業スレッドtidの作業領域を用いて、問い合わせqに答える */
+weight_t query_engine::answer(const query& q, unsigned tid)
+{
+    const index_t n = size();
+    const bool valid = 0 <= q.s && q.s < n && 0 <= q.t && q.t < n;
+    workspace& x = local[tid];
+
+    switch (q.kind) {
+    case query_kind::distance:
+        return valid ? dijkstra(G, q.s, q.t, x.W) : limits::inf;
+    case query_kind::reachable:
+        return valid && reach(G, q.s, q.t, x.W) ? 1 : 0;
+    case query_kind::max_flow:
+        if (!valid || q.s == q.t) { return 0; }
+        if (!x.flow) { x.flow = std::make_unique<dinic>(network); }
+        x.flow->Gf.reset();  // 前回の問い合わせのフローを0に戻す
+        return x.flow->compute(q.s, q.t);
+    }
+    return limits::inf;
+}
+
+
+/**< @brief 最短路重みδ(s, t)を求める */
+std::future<weight_t> query_engine::distance(index_t s, index_t t)
+{
+    return pool.async([this, s, t](unsigned tid) { return answer({ query_kind::distance, s, t }, tid); });
+}
+
+
+/**< @brief sからtに到達できるかを調べる */
+std::future<bool> query_engine::reachable(index_t s, index_t t)
+{
+    return pool.async([this, s, t](unsigned tid) { return answer({ query_kind::reachable, s, t }, tid) != 0; });
+}
+
+
+/**< @brief sからtへの最大フローの値を求める */
+std::future<capacity_t> query_engine::max_flow(index_t s, index_t t)
+{
+    return pool.async([this, s, t](unsigned tid) { return answer({ query_kind::max_flow, s, t }, tid); });
+}
+
+
+/**< @brief sからの単一始点最短路を求める */
+std::future<vertices_soa> query_engine::shortest_paths(index_t s)
+{
+    return pool.async([this, s](unsigned tid) {
+        if (s < 0 || s >= size()) { return vertices_soa(size()); }
+        search_workspace& W = local[tid].W;
+        dijkstra(G, s, W);
+        return W.to_soa();
+    });
+}
+
+
+/**
+ * @brief  問い合わせの列batchをまとめて投入する
+ * @note   約束(promise)の配列は作業の間で共有するが、各作業は自分の区間の要素だけに書き込む
+ */
+std::vector<std::future<weight_t>> query_engine::submit(const std::vector<query>& batch)
+{
+    struct shared_batch {
+        std::vector<query>                 queries;
+        std::vector<std::promise<weight_t>> answers;
+    };
+    auto b = std::make_shared<shared_batch>();
+    b->queries = batch;
+    b->answers.resize(batch.size());
+
+    std::vector<std::future<weight_t>> futures;
+    futures.reserve(batch.size());
+    for (auto&& p : b->answers) { futures.push_back(p.get_future()); }
+
+    for (std::size_t first = 0; first < batch.size(); first += chunk) {
+        std::size_t last = std::min(first + chunk, batch.size());
+        pool.post([this, b, first, last](unsigned tid) {
+            for (std::size_t i = first; i < last; ++i) {
+                try { b->answers[i].set_value(answer(b->queries[i], tid)); }
+                catch (...) { b->answers[i].set_exception(std::current_exception()); }
+            }
+        });
+    }
+    return futures;
+}
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
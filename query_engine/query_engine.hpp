@@ -0,0 +1,154 @@
+/**
+ * @brief  1つの共有グラフに対する多数の読み取り専用の問い合わせを、スレッドプールで並行に処理する
+ *
+ * @note   dijkstra, bfs, dinicなどの関数は呼び出しのたびに頂点属性や残余ネットワークを確保し、呼び出したスレッドで実行する
+ *         多数の利用者から問い合わせを受けるサービスに組み込むと、確保と初期化の費用がかさみ、問い合わせの割り振りも呼び出し側で行う必要がある
+ *
+ *         query_engineは次のものを持つ
+ *           1. 生成時にCSR表現に変換した不変のグラフG(すべての作業スレッドが読むだけなので、ロックを取らない)
+ *           2. 作業を盗むスレッドプール(graph/thread_pool.hpp)
+ *           3. 作業スレッドごとの作業領域(search_workspaceと、最大フローのための残余ネットワークの複製)
+ *         問い合わせは作業スレッドの作業領域だけを書き換えるので、作業スレッドの間で共有する可変な状態はスレッドプールのキューだけである
+ *
+ * @note   問い合わせの種類は次のとおりである. いずれも結果をfutureで返す
+ *           distance(s, t)       : 最短路重みδ(s, t)(tを確定した時点で打ち切るDijkstraのアルゴリズム. 到達できなければ∞)
+ *           reachable(s, t)      : sからtに到達できるか(tを発見した時点で打ち切る幅優先探索)
+ *           max_flow(s, t)       : 辺の重みを容量とみなしたネットワークのsからtへの最大フローの値(Dinicのアルゴリズム)
+ *           shortest_paths(s)    : sからの単一始点最短路(d値とπ値)
+ *         submit(batch)は問い合わせの列を複数個ずつまとめて1つの作業として投入するので、1件ずつ投入するよりも割り振りの費用が小さい
+ *
+ * @note   頂点の番号が範囲外の問い合わせ、およびs = tの最大フローは、探索を行わずに∞(到達できない)または0を返す
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef QUERY_ENGINE_HPP
+#define QUERY_ENGINE_HPP
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "../graph/graph.hpp"
+#include "../graph/csr.hpp"
+#include "../graph/soa.hpp"
+#include "../graph/workspace.hpp"
+#include "../graph/thread_pool.hpp"
+#include "../dinic/dinic.hpp"
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <vector>
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief  問い合わせの種類
+ */
+enum struct query_kind : std::int32_t {
+    distance,   /**< 最短路重みδ(s, t) */
+    reachable,  /**< sからtに到達できるか(1または0) */
+    max_flow,   /**< sからtへの最大フローの値 */
+};
+
+
+/**
+ * @brief  まとめて投入する1件の問い合わせ
+ */
+struct query {
+    query_kind kind;  /**< 問い合わせの種類 */
+    index_t    s;     /**< 始点(フローネットワークの入口) */
+    index_t    t;     /**< 終点(フローネットワークの出口) */
+};
+
+
+/**
+ * @brief  共有グラフに対する問い合わせを並行に処理する問い合わせエンジン
+ *
+ * @note   使い方
+ *           graph::query_engine Q(G);                                // Gを複製し、ハードウェアの並列度の数の作業スレッドを起動する
+ *           std::future<weight_t> d = Q.distance(s, t);              // 1件ずつ投入する
+ *           auto answers = Q.submit(batch);                          // まとめて投入する(answers[i].get()がbatch[i]の結果)
+ */
+struct query_engine {
+    /**
+     * @brief  隣接リスト表現Gを複製して、threads本の作業スレッドを持つエンジンを生成する
+     * @param  const graph_t& G  重み(最大フローでは容量)付き有向グラフG
+     * @param  unsigned threads  作業スレッドの数(0ならばハードウェアの並列度)
+     * @param  std::size_t chunk submitで1つの作業にまとめる問い合わせの数
+     */
+    explicit query_engine(const graph_t& G, unsigned threads = 0, std::size_t chunk = 32);
+
+    /**< @brief 頂点数|V|を返す */
+    index_t size() const { return G.size(); }
+
+    /**< @brief 作業スレッドの数を返す */
+    unsigned threads() const { return pool.size(); }
+
+    /**< @brief 最短路重みδ(s, t)を求める */
+    std::future<weight_t> distance(index_t s, index_t t);
+
+    /**< @brief sからtに到達できるかを調べる */
+    std::future<bool> reachable(index_t s, index_t t);
+
+    /**< @brief sからtへの最大フローの値を求める */
+    std::future<capacity_t> max_flow(index_t s, index_t t);
+
+    /**< @brief sからの単一始点最短路を求める. 結果は|V|の大きさなのでΘ(V)時間の複製を含む */
+    std::future<vertices_soa> shortest_paths(index_t s);
+
+    /**
+     * @brief  問い合わせの列batchをまとめて投入する
+     * @note   batchをchunk件ずつの作業に分けて投入する. 各作業は1つの作業スレッドで、その作業領域を使って順に答える
+     * @return answers[i]はbatch[i]の結果(distanceは最短路重み、reachableは1または0、max_flowはフローの値)
+     */
+    std::vector<std::future<weight_t>> submit(const std::vector<query>& batch);
+
+    /**< @brief 作業スレッドtidの作業領域を用いて、問い合わせqに答える */
+    weight_t answer(const query& q, unsigned tid);
+
+private:
+    /**< @brief 作業スレッドごとの作業領域. 隣り合う作業領域が同じキャッシュラインに載らないように揃える */
+    struct alignas(64) workspace {
+        search_workspace       W;     /**< 最短路と幅優先探索の作業領域 */
+        std::unique_ptr<dinic> flow;  /**< 残余ネットワークの複製(最初の最大フローの問い合わせで作る) */
+    };
+
+    const csr_graph        G;        /**< 不変のグラフ */
+    const dinic            network;  /**< フローネットワークの原本(作業スレッドが複製する) */
+    std::size_t            chunk;    /**< 1つの作業にまとめる問い合わせの数 */
+    std::vector<workspace> local;    /**< 作業スレッドごとの作業領域 */
+    thread_pool            pool;     /**< スレッドプール(作業が他のメンバを参照するので、最後に宣言して最初に破棄する) */
+};
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
+
+
+
+#endif  // end of QUERY_ENGINE_HPP
@@ -0,0 +1,311 @@
+/**
+ * @brief  頂点の番号の付け替え(vertex reordering)の実装
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include "reorder.hpp"
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+namespace {
+
+    /**
+     * @brief  辺の向きを無視したグラフ、すなわち頂点uの隣接リストがG[u]とG^T[u]をつなげたものであるグラフを返す
+     * @note   頂点uの次数はuの出次数と入次数の和になる
+     */
+    csr_graph symmetrize(const csr_graph& G)
+    {
+        csr_graph GT = transpose(G);
+        index_t n = G.size();
+        csr_graph S;
+        S.offset.assign(n + 1, 0);
+        S.dst.resize(2 * static_cast<std::size_t>(G.edge_count()));
+        S.w.resize(2 * static_cast<std::size_t>(G.edge_count()));
+        index_t*  off = S.offset.mutable_data();
+        index_t*  pd  = S.dst.mutable_data();
+        weight_t* pw  = S.w.mutable_data();
+        for (index_t u = 0; u < n; ++u) {
+            off[u + 1] = off[u] + G.degree(u) + GT.degree(u);
+            for (index_t i = G.offset[u];  i < G.offset[u + 1];  ++i) { *pd++ = G.dst[i];  *pw++ = G.w[i]; }
+            for (index_t i = GT.offset[u]; i < GT.offset[u + 1]; ++i) { *pd++ = GT.dst[i]; *pw++ = GT.w[i]; }
+        }
+        return S;
+    }
+
+
+    /**
+     * @brief  頂点rから幅優先探索を行い、rからの距離level[v]を求め、発見した頂点を発見した順にQに並べる
+     * @note   levelの値が負の頂点を未発見とみなす. 呼び出し後はQの頂点のlevelを-1に戻してから次の探索に使うこと
+     * @return rの離心率(最も遠い頂点までの距離)
+     */
+    index_t bfs_levels(const csr_graph& S, index_t r, indices_t& level, indices_t& Q)
+    {
+        Q.assign(1, r);
+        level[r] = 0;
+        for (std::size_t head = 0; head < Q.size(); ++head) {
+            index_t u = Q[head];
+            for (index_t i = S.offset[u]; i < S.offset[u + 1]; ++i) {
+                index_t v = S.dst[i];
+                if (level[v] < 0) { level[v] = level[u] + 1; Q.push_back(v); }
+            }
+        }
+        return level[Q.back()];
+    }
+
+
+    /**< @brief levelを探索前の状態に戻す */
+    void reset_levels(indices_t& level, const indices_t& Q)
+    {
+        for (auto&& v : Q) { level[v] = -1; }
+    }
+
+
+    /**
+     * @brief  頂点vを含む成分の擬似周辺頂点をGeorge-Liuの方法で求める
+     * @note   成分の最小の次数の頂点rから始め、rから最も遠い段にある最小の次数の頂点xへの離心率がrの離心率を超える限り、xに移る
+     */
+    index_t pseudo_peripheral(const csr_graph& S, index_t v, indices_t& level, indices_t& Q)
+    {
+        bfs_levels(S, v, level, Q);
+        index_t r = v;
+        for (auto&& u : Q) { if (S.degree(u) < S.degree(r)) { r = u; } }
+        reset_levels(level, Q);
+
+        index_t ecc = bfs_levels(S, r, level, Q);
+        for (;;) {
+            index_t x = Q.back();
+            for (auto it = Q.rbegin(); it != Q.rend() && level[*it] == ecc; ++it) {
+                if (S.degree(*it) <= S.degree(x)) { x = *it; }
+            }
+            reset_levels(level, Q);
+            index_t e = bfs_levels(S, x, level, Q);
+            if (e <= ecc) { reset_levels(level, Q); return r; }
+            r = x; ecc = e;
+        }
+    }
+
+}
+
+
+/**
+ * @brief  出次数の降順に番号を付ける
+ * @note   count[k]を次数がkより大きい頂点の数とすれば、次数kの頂点には番号count[k]から順に番号を付ければよい
+ */
+indices_t degree_order(const csr_graph& G)
+{
+    index_t n = G.size(), maxdeg = 0;
+    for (index_t u = 0; u < n; ++u) { maxdeg = std::max(maxdeg, G.degree(u)); }
+    indices_t count(maxdeg + 2, 0);
+    for (index_t u = 0; u < n; ++u) { ++count[maxdeg - G.degree(u) + 1]; }
+    for (index_t k = 0; k <= maxdeg; ++k) { count[k + 1] += count[k]; }
+    indices_t perm(n);
+    for (index_t u = 0; u < n; ++u) { perm[u] = count[maxdeg - G.degree(u)]++; }
+    return perm;
+}
+
+
+/**< @brief 隣接リスト表現のグラフGに対して出次数の降順に番号を付ける */
+indices_t degree_order(const graph_t& G)
+{
+    return degree_order(csr_graph(G));
+}
+
+
+/**< @brief 幅優先探索で頂点を発見した順に番号を付ける */
+indices_t bfs_order(const csr_graph& G)
+{
+    csr_graph S = symmetrize(G);
+    index_t n = G.size(), next = 0;
+    indices_t perm(n, limits::nil), Q;
+    Q.reserve(n);
+    for (index_t r = 0; r < n; ++r) {
+        if (perm[r] != limits::nil) { continue; }
+        Q.assign(1, r);
+        perm[r] = next++;
+        for (std::size_t head = 0; head < Q.size(); ++head) {
+            index_t u = Q[head];
+            for (index_t i = S.offset[u]; i < S.offset[u + 1]; ++i) {
+                index_t v = S.dst[i];
+                if (perm[v] == limits::nil) { perm[v] = next++; Q.push_back(v); }
+            }
+        }
+    }
+    return perm;
+}
+
+
+/**< @brief 隣接リスト表現のグラフGに対して幅優先探索で頂点を発見した順に番号を付ける */
+indices_t bfs_order(const graph_t& G)
+{
+    return bfs_order(csr_graph(G));
+}
+
+
+/**
+ * @brief  逆Cuthill-McKee順に番号を付ける
+ * @note   Cuthill-McKee順での位置kの頂点に番号n - 1 - kを付ける. orderは成分をまたいで発見した順に頂点を並べる
+ */
+indices_t reverse_cuthill_mckee(const csr_graph& G)
+{
+    csr_graph S = symmetrize(G);
+    index_t n = G.size();
+    indices_t perm(n, limits::nil), level(n, -1), order, Q, adj;
+    order.reserve(n);
+    for (index_t v = 0; v < n; ++v) {
+        if (perm[v] != limits::nil) { continue; }
+        index_t r = pseudo_peripheral(S, v, level, Q);
+
+        std::size_t head = order.size();
+        order.push_back(r);
+        perm[r] = 0;  // 番号は後で付け直すので、ここでは発見済みの印とする
+        for (; head < order.size(); ++head) {
+            index_t u = order[head];
+            adj.clear();
+            for (index_t i = S.offset[u]; i < S.offset[u + 1]; ++i) {
+                index_t x = S.dst[i];
+                if (perm[x] == limits::nil) { perm[x] = 0; adj.push_back(x); }
+            }
+            std::stable_sort(adj.begin(), adj.end(), [&](index_t a, index_t b) { return S.degree(a) < S.degree(b); });
+            order.insert(order.end(), adj.begin(), adj.end());
+        }
+    }
+    for (index_t k = 0; k < n; ++k) { perm[order[k]] = n - 1 - k; }
+    return perm;
+}
+
+
+/**< @brief 隣接リスト表現のグラフGに対して逆Cuthill-McKee順に番号を付ける */
+indices_t reverse_cuthill_mckee(const graph_t& G)
+{
+    return reverse_cuthill_mckee(csr_graph(G));
+}
+
+
+/**< @brief 置換permの逆置換を返す */
+indices_t inverse_permutation(const indices_t& perm)
+{
+    indices_t inv(perm.size());
+    for (std::size_t v = 0; v < perm.size(); ++v) { inv[perm[v]] = static_cast<index_t>(v); }
+    return inv;
+}
+
+
+/**
+ * @brief  各頂点vの番号をperm[v]に付け替えたCSR表現のグラフHを返す
+ * @note   Hの頂点uの隣接リストは、Gの頂点inv[u]の隣接リストの終点を付け替えて並べ直したものである
+ */
+csr_graph relabel(const csr_graph& G, const indices_t& perm)
+{
+    index_t n = G.size();
+    indices_t inv = inverse_permutation(perm);
+    csr_graph H;
+    H.offset.assign(n + 1, 0);
+    H.dst.resize(G.edge_count()); H.w.resize(G.edge_count());
+    index_t*  off = H.offset.mutable_data();
+    index_t*  pd  = H.dst.mutable_data();
+    weight_t* pw  = H.w.mutable_data();
+
+    std::vector<std::pair<index_t, weight_t>> adj;
+    for (index_t u = 0; u < n; ++u) {
+        index_t x = inv[u];
+        off[u + 1] = off[u] + G.degree(x);
+        adj.clear();
+        for (index_t i = G.offset[x]; i < G.offset[x + 1]; ++i) { adj.emplace_back(perm[G.dst[i]], G.w[i]); }
+        std::stable_sort(adj.begin(), adj.end(), [](auto&& a, auto&& b) { return a.first < b.first; });
+        for (auto&& a : adj) { *pd++ = a.first; *pw++ = a.second; }
+    }
+    return H;
+}
+
+
+/**< @brief 各頂点vの番号をperm[v]に付け替えた隣接リスト表現のグラフHを返す */
+graph_t relabel(const graph_t& G, const indices_t& perm)
+{
+    graph_t H(G.size());
+    for (std::size_t u = 0; u < G.size(); ++u) {
+        edges_t& es = H[perm[u]];
+        es.reserve(G[u].size());
+        for (auto&& e : G[u]) { es.emplace_back(perm[e.src], perm[e.dst], e.w); }
+        std::stable_sort(es.begin(), es.end(), [](const edge& a, const edge& b) { return a.dst < b.dst; });
+    }
+    return H;
+}
+
+
+/**< @brief 付け替えたグラフで求めた頂点集合Vを元の番号による頂点集合に戻す */
+vertices_t restore(const vertices_t& V, const indices_t& perm)
+{
+    vertices_t R(V.size());
+    indices_t inv = inverse_permutation(perm);
+    for (std::size_t v = 0; v < V.size(); ++v) {
+        R[v] = V[perm[v]];
+        if (R[v].pi != limits::nil) { R[v].pi = inv[R[v].pi]; }
+    }
+    return R;
+}
+
+
+/**< @brief 付け替えたグラフで求めた配列の構造体Vを元の番号による配列の構造体に戻す */
+vertices_soa restore(const vertices_soa& V, const indices_t& perm)
+{
+    vertices_soa R(V.size());
+    indices_t inv = inverse_permutation(perm);
+    for (std::size_t v = 0; v < perm.size(); ++v) {
+        index_t x = perm[v];
+        R.d[v]     = V.d[x];
+        R.pi[v]    = V.pi[x] == limits::nil ? static_cast<index_t>(limits::nil) : inv[V.pi[x]];
+        R.state[v] = V.state[x];
+    }
+    return R;
+}
+
+
+/**< @brief 付け替えたグラフで求めた辺集合の端点を元の番号に戻す */
+edges_t restore(const edges_t& T, const indices_t& perm)
+{
+    indices_t inv = inverse_permutation(perm);
+    edges_t R;
+    R.reserve(T.size());
+    for (auto&& e : T) { R.emplace_back(inv[e.src], inv[e.dst], e.w); }
+    return R;
+}
+
+
+/**< @brief 付け替えたグラフで求めた頂点の列を元の番号に戻す */
+indices_t restore_path(const indices_t& path, const indices_t& perm)
+{
+    indices_t inv = inverse_permutation(perm);
+    indices_t R;
+    R.reserve(path.size());
+    for (auto&& v : path) { R.push_back(inv[v]); }
+    return R;
+}
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
@@ -0,0 +1,144 @@
+/**
+ * @brief  頂点の番号を付け替えて(vertex reordering)、隣接リストの走査でのキャッシュの局所性を高める
+ *
+ * @note   bfs, dijkstra, primの内側のループは、辺(u, v)ごとにv.dやv.πを読み書きする. 頂点の番号が乱雑であれば、
+ *         隣接する頂点の属性は配列の離れた位置にあり、ほとんどの読み込みがキャッシュを外す
+ *         隣接する頂点に近い番号を与え直せば、同じキャッシュラインに載る属性が増え、探索はそのまま速くなる
+ *
+ * @note   番号の付け替えは置換permで表す. perm[v]は元のグラフの頂点vの新しい番号である
+ *           1. permを求める     : degree_order, bfs_order, reverse_cuthill_mckee
+ *           2. グラフを付け替える: H = relabel(G, perm)
+ *           3. Hで探索する       : 始点sはperm[s]として渡す
+ *           4. 結果を元の番号に戻す: restore(V, perm), restore(T, perm), restore_path(p, perm)
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef REORDER_HPP
+#define REORDER_HPP
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "../graph/graph.hpp"
+#include "../graph/csr.hpp"
+#include "../graph/soa.hpp"
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 関数の宣言
+//****************************************
+
+/**
+ * @brief  出次数の降順に番号を付ける
+ * @note   次数の大きい頂点ほど多くの辺の終点になるので、それらの属性を配列の先頭にまとめればキャッシュに残りやすい
+ *         次数の分布が偏ったグラフ(べき乗則のグラフ)で効く. 同じ次数の頂点は元の番号の順を保つ. 計数ソートによりΘ(V + E)時間で走る
+ *
+ * @param  const csr_graph& G  グラフG
+ * @return 置換perm(perm[v]は頂点vの新しい番号)
+ */
+indices_t degree_order(const csr_graph& G);
+indices_t degree_order(const graph_t& G);
+
+
+
+/**
+ * @brief  幅優先探索で頂点を発見した順に番号を付ける
+ * @note   辺の向きを無視して探索し、まだ番号のない最小の頂点から次の成分を探索する
+ *         同じ段の頂点と隣の段の頂点が近い番号を持つので、幅優先探索のフロンティアが配列の狭い区間に収まる. Ο(V + E)時間で走る
+ *
+ * @param  const csr_graph& G  グラフG
+ * @return 置換perm
+ */
+indices_t bfs_order(const csr_graph& G);
+indices_t bfs_order(const graph_t& G);
+
+
+
+/**
+ * @brief  逆Cuthill-McKee順(reverse Cuthill-McKee, RCM)に番号を付ける
+ *
+ * @note   Cuthill-McKee順は、各成分の周辺の頂点から幅優先探索を行い、各頂点の未発見の隣接頂点を次数の昇順に発見して番号を付ける
+ *         これを逆順にしたものがRCM順であり、隣接行列の帯幅(|perm[u] - perm[v]|の最大値)を小さくする
+ *         各成分の始点は、最小の次数の頂点から幅優先探索を繰り返して最も遠い段の最小次数の頂点に移る、George-Liuの擬似周辺頂点である
+ *
+ * @note   辺の向きを無視して探索し、次数は出次数と入次数の和とする. Ο(V + E log Δ)時間で走る(Δは最大の次数)
+ *
+ * @param  const csr_graph& G  グラフG
+ * @return 置換perm
+ */
+indices_t reverse_cuthill_mckee(const csr_graph& G);
+indices_t reverse_cuthill_mckee(const graph_t& G);
+
+
+
+/**
+ * @brief  置換permの逆置換を返す(戻り値のinv[perm[v]] = v)
+ */
+indices_t inverse_permutation(const indices_t& perm);
+
+
+
+/**
+ * @brief  各頂点vの番号をperm[v]に付け替えたグラフHを返す
+ * @note   辺(u, v, w)は辺(perm[u], perm[v], w)になる. 各隣接リストは新しい終点の番号の昇順に並べるので、走査が配列を前に進む
+ *
+ * @param  const csr_graph& G  グラフG
+ * @param  const indices_t& perm  置換
+ * @return 付け替えたグラフH
+ */
+csr_graph relabel(const csr_graph& G, const indices_t& perm);
+graph_t   relabel(const graph_t& G, const indices_t& perm);
+
+
+
+/**
+ * @brief  付け替えたグラフHで求めた頂点集合Vを、元の番号による頂点集合に戻す
+ * @note   頂点vの属性は元の頂点inv[v]に移し、先行頂点v.πも元の番号に戻す(NILはNILのまま)
+ *
+ * @param  const vertices_t& V  Hの頂点集合
+ * @param  const indices_t& perm  Hを作った置換
+ * @return 元のグラフの頂点集合
+ */
+vertices_t   restore(const vertices_t& V, const indices_t& perm);
+vertices_soa restore(const vertices_soa& V, const indices_t& perm);
+
+
+
+/**< @brief Hで求めた辺集合(primやkruskalの最小全域木など)の端点を元の番号に戻す */
+edges_t restore(const edges_t& T, const indices_t& perm);
+
+
+
+/**< @brief Hで求めた頂点の列(最短路など)を元の番号に戻す */
+indices_t restore_path(const indices_t& path, const indices_t& perm);
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
+
+
+
+#endif  // end of REORDER_HPP
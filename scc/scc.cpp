@@ -1,6 +1,6 @@
 /**
  * @brief 強連結成分(分解)アルゴリズムの実装
- * @date  2016/02/14 ~ 2017/01/03
+ * @date  2016/02/14 ~ 2026/10/14
  */
 
 
@@ -9,8 +9,12 @@
 //****************************************
 
 #include "../graph/graph.hpp"
-#include "../topological_sort/tsort.hpp"
-#include <iostream>
+#include "scc.hpp"
+#include "../transitive_closure/transitive_closure.hpp"
+#include <algorithm>
+#include <utility>
+#include <numeric>
+#include <vector>
 
 
 
@@ -32,64 +36,111 @@ GRAPH_BEGIN
  * @note   グラフを強連結成分に分解した後、個々の強連結成分上でアルゴリズムを実行し、
  *         得られた解を成分間の連結構造にしたがって組み合わせて最終的に解を得る
  *
- * @note   グラフG = (V, E)の強連結成分を求めるアルゴリズムはGの転置を用いる
- *         Gの転置はグラフG^T = (V, E^T), E^T = { (u, v) : (v, u) ∈ E }である
- *         すなわち、E^TはGの辺の方向を逆にしたものである. Gの隣接リストが与えられると、
- *         G^TをΟ(V + E)時間で生成できる. 興味深いことに、GとG^Tはまったく同じ強連結成分を持つ
- *         G上でuとvが互いに到達可能であることと、G^T上でこれらが互いに到達可能であることとは等価である
+ * @note   Tarjanのアルゴリズムは、深さ優先探索を1回だけ行い、G^Tを生成せずに強連結成分を求める
+ *         各頂点uに発見順の番号u.ordと、uの子孫から1本の後退辺または横断辺で到達できるスタック上の頂点の最小の番号u.lowを持たせる
+ *         発見した頂点はスタックSに積み、uの探索が終了したときu.low = u.ordならば、uはその強連結成分で最初に発見された頂点(根)なので、
+ *         Sからuまでの頂点を取り出して1つの強連結成分として出力する
  *
- * @note   以下の線形時間(すなわち、Θ(V + E)時間)アルゴリズムは、深さ優先探索を2回、最初にG上で、
- *         つぎにG^T上で実行することによって有向グラフG = (V, E)の強連結成分を求める
+ * @note   深さ優先探索は再帰を用いず、訪問中の頂点と次に調べる隣接リストの位置の組を明示的なスタックに積んで行う
+ *         Tarjanのアルゴリズムは成分グラフのトポロジカルソートの逆順に成分を出力するので、最後に番号を付け直して、
+ *         成分グラフのトポロジカルソート順に0, 1, ...となるようにする
  *
- *         STRONGLY-CONNECTED-COMPONENTS(G)
- *         1 DFS(G)を呼び出し、各頂点uに対して終了時刻u.fを計算する
- *         2 G^Tを計算する
- *         3 DFS(G^T)を呼び出すが、DFSの主ループでは(第1行で計算した)u.fの降順で頂点を探索する
- *         4 第3行で生成した深さ優先森の各木の頂点を、それぞれ分離された強連結成分として出力する
- *
- * @param  const graph_t& G グラフG
+ * @tparam Graph          グラフGの表現(graph_t, csr_graphまたはcompressed_graph)
+ * @param  const Graph& G グラフG
  * @return components[v] 頂点vが含まれる連結成分の番号となるような集合
  */
-indices_t scc(const graph_t& G)
+template<class Graph>
+static indices_t scc_impl(const Graph& G)
 {
-    index_t n = G.size(); vertices_t vs(n);
-    indices_t components(n, -1);
-    std::vector<vcolor> color(n, vcolor::white);
-    graph_t GT(n);
-
-    // 再帰的に白頂点を訪れる
-    std::function<void(index_t, index_t)> dfs_visit = [&](index_t u, index_t k) {
-        color[u] = vcolor::gray;
-        components[u] = k;
-        for (auto&& e : GT[u]) {
-            index_t w = e.dst;
-            if (color[w] == vcolor::white) {
-                dfs_visit(w, k);
+    index_t n = G.size();
+    indices_t components(n, limits::nil), ord(n, limits::nil), low(n);
+    indices_t S;                                         // 強連結成分がまだ決まっていない発見済みの頂点
+    using position = decltype(G[0].begin());
+    std::vector<std::pair<index_t, position>> stack;     // 訪問中の頂点uと次に調べる隣接リストの位置
+    index_t time = 0, k = 0;
+
+    auto discover = [&](index_t u) {
+        ord[u] = low[u] = time++;
+        S.push_back(u);
+        stack.emplace_back(u, G[u].begin());
+    };
+
+    for (index_t s = 0; s < n; ++s) {
+        if (ord[s] != limits::nil) { continue; }
+        discover(s);
+        while (!stack.empty()) {
+            index_t u = stack.back().first;
+            position& i = stack.back().second;
+            if (i != G[u].end()) {
+                index_t w = (*i).dst; ++i;
+                if (ord[w] == limits::nil) { discover(w); }                                        // 木辺
+                else if (components[w] == limits::nil) { low[u] = std::min(low[u], ord[w]); }     // wはまだS上にある
+                continue;
+            }
+            stack.pop_back();
+            if (low[u] == ord[u]) {  // uは強連結成分の根なので、Sからuまでを取り出す
+                index_t v;
+                do { v = S.back(); S.pop_back(); components[v] = k; } while (v != u);
+                ++k;
             }
+            if (!stack.empty()) { index_t p = stack.back().first; low[p] = std::min(low[p], low[u]); }
         }
-        color[u] = vcolor::black;
-    };
+    }
 
+    // 成分グラフのトポロジカルソート順に番号を付け直す
+    for (auto&& c : components) { c = k - 1 - c; }
+    return components;
+}
 
-    // DFS(G)を呼び出し、各頂点uに対して終了時刻u.fを計算する
-    array_t tlst = tsort(G);
 
-    // G^Tを計算する
-    for (auto&& es : G) {
-        for (auto&& e : es) {
-            GT[e.dst].emplace_back(e.dst, e.src);
-        }
-    }
+/**< @brief 隣接リスト表現のグラフGを強連結成分に分解する */
+indices_t scc(const graph_t& G)
+{
+    return scc_impl(G);
+}
+
+
+/**< @brief CSR表現のグラフGを強連結成分に分解する */
+indices_t scc(const csr_graph& G)
+{
+    return scc_impl(G);
+}
 
-    // DFS(G^T)を呼び出す
-    index_t k = 0;
-    for (auto&& u : tlst) { // 成分グラフの頂点をトポロジカルソートされた順序で訪問する
-        if (color[u] == vcolor::white) {
-            dfs_visit(u, k++);
+
+/**< @brief 圧縮表現のグラフGを強連結成分に分解する */
+indices_t scc(const compressed_graph& G)
+{
+    return scc_impl(G);
+}
+
+
+/**< @brief ビット行列で表したグラフAを、推移閉包を用いて強連結成分に分解する */
+indices_t scc(const bit_matrix& A)
+{
+    using word_t = bit_matrix::word_t;
+    const index_t n = static_cast<index_t>(A.size());
+    bit_matrix T = transitive_closure(A), TT = T.transpose();
+
+    // 各成分の最小の頂点を代表rとし、T[r] & T^T[r]の頂点に仮の番号を付ける
+    indices_t components(n, limits::nil), roots;
+    for (index_t r = 0; r < n; ++r) {
+        if (components[r] != limits::nil) { continue; }
+        index_t c = static_cast<index_t>(roots.size());
+        roots.push_back(r);
+        const word_t* t = T.row(r), * tt = TT.row(r);
+        for (std::size_t k = 0; k < T.words(); ++k) {
+            for (word_t x = t[k] & tt[k]; x != 0; x &= x - 1) { components[k * bit_matrix::bits + __builtin_ctzll(x)] = c; }
         }
     }
 
-    // 分離された強連結成分を出力
+    // 到達できる頂点の数の降順(同数ならば代表の番号の順)に成分を並べ、番号を付け直す
+    std::vector<std::size_t> reach(roots.size());
+    for (std::size_t c = 0; c < roots.size(); ++c) { reach[c] = T.count(roots[c]); }
+    indices_t order(roots.size()), rank(roots.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](index_t a, index_t b) { return reach[a] > reach[b]; });
+    for (std::size_t i = 0; i < order.size(); ++i) { rank[order[i]] = static_cast<index_t>(i); }
+    for (auto&& c : components) { c = rank[c]; }
     return components;
 }
 
@@ -19,6 +19,9 @@
 //****************************************
 
 #include "../graph/graph.hpp"
+#include "../graph/csr.hpp"
+#include "../graph/compressed.hpp"
+#include "../graph/bitmatrix.hpp"
 
 
 
@@ -40,20 +43,15 @@ GRAPH_BEGIN
  * @note   グラフを強連結成分に分解した後、個々の強連結成分上でアルゴリズムを実行し、
  *         得られた解を成分間の連結構造にしたがって組み合わせて最終的に解を得る
  *
- * @note   グラフG = (V, E)の強連結成分を求めるアルゴリズムはGの転置を用いる
- *         Gの転置はグラフG^T = (V, E^T), E^T = { (u, v) : (v, u) ∈ E }である
- *         すなわち、E^TはGの辺の方向を逆にしたものである. Gの隣接リストが与えられると、
- *         G^TをΟ(V + E)時間で生成できる. 興味深いことに、GとG^Tはまったく同じ強連結成分を持つ
- *         G上でuとvが互いに到達可能であることと、G^T上でこれらが互いに到達可能であることとは等価である
- *
- * @note   以下の線形時間(すなわち、Θ(V + E)時間)アルゴリズムは、深さ優先探索を2回、最初にG上で、
- *         つぎにG^T上で実行することによって有向グラフG = (V, E)の強連結成分を求める
+ * @note   以下の線形時間(すなわち、Θ(V + E)時間)のTarjanのアルゴリズムは、深さ優先探索を1回だけ行うことで有向グラフG = (V, E)の強連結成分を求める
+ *         Gの転置G^Tは生成しない. 深さ優先探索は明示的なスタックで行うので、長い道を含むグラフでもコールスタックを消費しない
  *
  *         STRONGLY-CONNECTED-COMPONENTS(G)
- *         1 DFS(G)を呼び出し、各頂点uに対して終了時刻u.fを計算する
- *         2 G^Tを計算する
- *         3 DFS(G^T)を呼び出すが、DFSの主ループでは(第1行で計算した)u.fの降順で頂点を探索する
- *         4 第3行で生成した深さ優先森の各木の頂点を、それぞれ分離された強連結成分として出力する
+ *         1 DFS(G)を呼び出し、各頂点uに発見順の番号u.ordを付けて、発見した頂点をスタックSに積む
+ *         2 uの探索中に、uの子孫からS上の頂点への辺を用いてu.low = min{ u.ord, w.ord, (子).low }を計算する
+ *         3 uの探索が終了したときu.low = u.ordならば、Sからuまでの頂点を取り出し、1つの強連結成分として出力する
+ *
+ * @note   成分の番号は、成分グラフのトポロジカルソート順に0, 1, ...と付ける
  *
  * @param  const graph_t& G グラフG
  * @return components[v] 頂点vが含まれる連結成分の番号となるような集合
@@ -62,6 +60,46 @@ indices_t scc(const graph_t& G);
 
 
 
+/**
+ * @brief  CSR表現のグラフGを強連結成分に分解する
+ * @note   結果はgraph_tに対するsccと同じである
+ *
+ * @param  const csr_graph& G グラフG
+ * @return components[v] 頂点vが含まれる連結成分の番号となるような集合
+ */
+indices_t scc(const csr_graph& G);
+
+
+
+/**
+ * @brief  圧縮表現のグラフGを強連結成分に分解する
+ * @note   隣接リストは終点の昇順に並び直されているので、結果は同じ順に並べたgraph_tに対するsccと同じである
+ *         成分への分解そのものは隣接リストの順序によらないが、成分の番号(成分グラフのトポロジカルソート順)は異なりうる
+ *
+ * @param  const compressed_graph& G グラフG
+ * @return components[v] 頂点vが含まれる連結成分の番号となるような集合
+ */
+indices_t scc(const compressed_graph& G);
+
+
+
+/**
+ * @brief  ビット行列で表した密なグラフAを、推移閉包Tを用いて強連結成分に分解する
+ *
+ * @note   頂点uを含む強連結成分は、uから到達でき、かつuへ到達できる頂点の集合であり、ビット列T[u] & T^T[u]として1語で64頂点ずつ求まる
+ *         成分Cから別の成分Dへ到達できるならば、Cから到達できる頂点の集合はDから到達できる頂点の集合を真に含むので、
+ *         到達できる頂点の数の降順に成分を並べると成分グラフのトポロジカルソート順になる(同数の成分は最小の頂点の番号の順とする)
+ *
+ * @note   推移閉包(transitive_closure/transitive_closure.hpp)にΘ(V^3 / 64)時間かかる. 辺の多い密なグラフや、推移閉包も必要な場合に向く
+ *         成分への分解はgraph_tに対するsccと同じであるが、同じ段の成分の番号の付け方は異なりうる
+ *
+ * @param  const bit_matrix& A 隣接行列A
+ * @return components[v] 頂点vが含まれる連結成分の番号となるような集合
+ */
+indices_t scc(const bit_matrix& A);
+
+
+
 //****************************************
 // 名前空間の終端
 //****************************************
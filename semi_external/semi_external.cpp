@@ -0,0 +1,344 @@
+/**
+ * @brief  スナップショットのファイルから辺を順に読み込む最小全域森と連結成分の実装
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <cstdio>
+#include <cstdint>
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "../graph/heap.hpp"
+#include "../graph/radix_sort.hpp"
+#include "../kruskal/disjoint_sets/disjoint_sets.hpp"
+#include "../snapshot/snapshot.hpp"
+#include "semi_external.hpp"
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+namespace {
+
+    struct file_closer { void operator () (std::FILE* fp) const { std::fclose(fp); } };
+    using file_ptr = std::unique_ptr<std::FILE, file_closer>;
+
+
+    /**
+     * @brief  ファイルの区間から型Tの値の列を、大きさblock[byte]のブロックごとに順に読む
+     * @note   1回のfreadでブロック全体を読むので、標準入出力のバッファを経由せずに済む(バッファより大きい読み込みは直接行われる)
+     */
+    template<class T>
+    struct block_reader {
+        std::FILE*     fp   = nullptr;
+        std::vector<T> buf;
+        std::size_t    i    = 0, len = 0;
+        std::uint64_t  left = 0;      /**< まだ読んでいない値の数 */
+        bool           failed = false;
+
+        /**< @brief ファイルfpの位置pos[byte]から始まるcount個の値を読むよう準備する */
+        bool open(std::FILE* f, std::uint64_t pos, std::uint64_t count, std::size_t block)
+        {
+            fp = f; i = len = 0; left = count; failed = false;
+            buf.resize(std::max<std::size_t>(block / sizeof(T), 1));
+            return std::fseek(fp, static_cast<long>(pos), SEEK_SET) == 0;
+        }
+
+        /**< @brief 次の値をxに読む. 列の終わりか読み込みに失敗したときはfalseを返す */
+        bool next(T& x)
+        {
+            if (i == len && !refill()) { return false; }
+            x = buf[i++];
+            return true;
+        }
+
+    private:
+        bool refill()
+        {
+            if (left == 0 || failed) { return false; }
+            std::size_t k = static_cast<std::size_t>(std::min<std::uint64_t>(buf.size(), left));
+            len = std::fread(buf.data(), sizeof(T), k, fp);
+            i = 0;
+            if (len != k) { failed = true; return false; }
+            left -= k;
+            return true;
+        }
+    };
+
+
+    /**< @brief 型Tの値の列を、大きさblock[byte]のブロックごとにファイルfpに書く */
+    template<class T>
+    struct block_writer {
+        std::FILE*     fp = nullptr;
+        std::vector<T> buf;
+        bool           failed = false;
+
+        block_writer(std::FILE* fp, std::size_t block) : fp(fp) { buf.reserve(std::max<std::size_t>(block / sizeof(T), 1)); }
+
+        void put(const T& x)
+        {
+            buf.push_back(x);
+            if (buf.size() == buf.capacity()) { flush(); }
+        }
+
+        /**< @brief ブロックに残った値を書き出す */
+        bool flush()
+        {
+            if (!buf.empty() && std::fwrite(buf.data(), sizeof(T), buf.size(), fp) != buf.size()) { failed = true; }
+            buf.clear();
+            return !failed;
+        }
+    };
+
+
+    /**
+     * @brief  整列済みの辺の連を置く一時ファイル
+     * @note   dirが空ならばstd::tmpfileを用い、そうでなければdirに名前を付けて作り、破棄するときに削除する
+     */
+    struct run_file {
+        file_ptr      fp;
+        std::string   name;
+        std::uint64_t count = 0;  /**< 連の辺の数 */
+
+        run_file() = default;
+        run_file(run_file&&) = default;
+        run_file& operator = (run_file&& r) noexcept
+        {
+            if (this != &r) { remove(); fp = std::move(r.fp); name = std::move(r.name); count = r.count; }
+            return *this;
+        }
+        ~run_file() { remove(); }
+
+        /**< @brief ファイルを閉じて削除する */
+        void remove()
+        {
+            if (fp) { fp.reset(); if (!name.empty()) { std::remove(name.c_str()); } }
+            name.clear(); count = 0;
+        }
+
+        bool create(const std::string& dir)
+        {
+            if (dir.empty()) { fp.reset(std::tmpfile()); return fp != nullptr; }
+            static std::mt19937_64 rng{std::random_device()()};
+            for (int retry = 0; retry < 16 && !fp; ++retry) {
+                name = dir + "/graph_run_" + std::to_string(rng()) + ".tmp";
+                fp.reset(std::fopen(name.c_str(), "w+bx"));  // 既存のファイルは上書きしない
+            }
+            if (!fp) { name.clear(); }
+            return fp != nullptr;
+        }
+    };
+
+
+    /**< @brief スナップショットの配列offset, dst, wを順に読み、辺(u, v, w)を列挙する */
+    struct edge_stream {
+        file_ptr                offset_fp, dst_fp, w_fp;
+        block_reader<index_t>   offset, dst;
+        block_reader<weight_t>  weight;
+        std::uint64_t           n = 0, m = 0;
+        index_t                 u = 0, end = 0;  /**< 読み込み中の頂点uと、その辺の終わりoffset[u + 1] */
+        index_t                 i = 0;           /**< 次に読む辺の添字 */
+        bool                    with_weight = true;
+        bool                    broken = false;  /**< ファイルの中身が壊れていたか？ */
+
+        /**< @brief ファイルpathを開く. with_weight = falseならば配列wを読まない */
+        bool open(const std::string& path, std::size_t block, bool with_weight)
+        {
+            snapshot_header h;
+            if (!read_snapshot_header(path, h)) { return false; }
+            n = h.n; m = h.m;
+            this->with_weight = with_weight;
+            offset_fp.reset(std::fopen(path.c_str(), "rb"));
+            dst_fp.reset(std::fopen(path.c_str(), "rb"));
+            if (with_weight) { w_fp.reset(std::fopen(path.c_str(), "rb")); }
+            if (!offset_fp || !dst_fp || (with_weight && !w_fp)) { return false; }
+            bool ok = offset.open(offset_fp.get(), h.offset_pos, n + 1, block) && dst.open(dst_fp.get(), h.dst_pos, m, block)
+                   && (!with_weight || weight.open(w_fp.get(), h.w_pos, m, block));
+            index_t first = -1;
+            if (!ok || !offset.next(first) || first != 0) { return false; }
+            u = -1; end = 0; i = 0;
+            return true;
+        }
+
+        /**
+         * @brief  次の辺をeに読む
+         * @return 辺があったか？(列の終わりか、ファイルが壊れていればfalse. 区別はfailedで行う)
+         */
+        bool next(edge& e)
+        {
+            while (i == end) {  // 辺を調べ終えた頂点を飛ばす
+                if (static_cast<std::uint64_t>(u + 1) >= n) { return false; }
+                ++u;
+                index_t last;
+                if (!offset.next(last) || last < end || static_cast<std::uint64_t>(last) > m) { broken = true; return false; }
+                end = last;
+            }
+            ++i;
+            e.src = u;
+            e.w = 1;
+            if (!dst.next(e.dst) || e.dst < 0 || static_cast<std::uint64_t>(e.dst) >= n) { broken = true; return false; }
+            if (with_weight && !weight.next(e.w)) { broken = true; return false; }
+            return true;
+        }
+
+        /**< @brief 読み込みに失敗したか、ファイルの中身が壊れていたか？ */
+        bool failed() const { return broken || offset.failed || dst.failed || weight.failed || static_cast<std::uint64_t>(i) != m; }
+    };
+
+
+    /**< @brief 辺を重みの非減少順に安定に整列する */
+    void sort_run(edges_t& R, unsigned threads)
+    {
+        radix_sort(R, [](const edge& e) { return radix_key(e.w); }, threads);
+    }
+
+
+    /**< @brief 整列した辺の列Rを一時ファイルに書き出し、連の列runsに加える */
+    bool write_run(const edges_t& R, const external_options& opt, std::vector<run_file>& runs)
+    {
+        run_file r;
+        if (!r.create(opt.temp_dir)) { return false; }
+        if (!R.empty() && std::fwrite(R.data(), sizeof(edge), R.size(), r.fp.get()) != R.size()) { return false; }
+        if (std::fflush(r.fp.get()) != 0) { return false; }
+        r.count = R.size();
+        runs.push_back(std::move(r));
+        return true;
+    }
+
+
+    /**
+     * @brief  連の列[first, last)を重みの非減少順に併合し、各辺をsinkに渡す
+     * @note   各連の先頭の辺の重みをキーとして、連の番号をmin優先度付きキューに置く. sinkがfalseを返したら併合をやめる
+     *
+     * @return 読み込みに失敗しなかったか？
+     */
+    template<class Sink>
+    bool merge_runs(std::vector<run_file>::iterator first, std::vector<run_file>::iterator last, std::size_t block, Sink sink)
+    {
+        const std::size_t k = static_cast<std::size_t>(last - first);
+        std::vector<block_reader<edge>> in(k);
+        edges_t head(k);
+        dary_heap<4> Q(k);
+        for (std::size_t r = 0; r < k; ++r) {
+            if (!in[r].open(first[r].fp.get(), 0, first[r].count, block)) { return false; }
+            if (in[r].next(head[r])) { Q.push(static_cast<index_t>(r), head[r].w); }
+        }
+        while (!Q.empty()) {
+            index_t r = Q.top().u; Q.pop();
+            if (!sink(head[r])) { return true; }
+            if (in[r].next(head[r])) { Q.push(r, head[r].w); }
+        }
+        return std::none_of(in.begin(), in.end(), [](const block_reader<edge>& x) { return x.failed; });
+    }
+
+}
+
+
+/**
+ * @brief  スナップショットのファイルpathのグラフに対して、辺をメモリに取り出さずにKruskalのアルゴリズムを実行する
+ */
+bool external_kruskal(const std::string& path, edges_t& A, weight_t& w, const external_options& opt)
+{
+    edge_stream S;
+    if (!S.open(path, opt.block, true)) { return false; }
+    const index_t n = static_cast<index_t>(S.n);
+    disjoint_sets ds(static_cast<std::size_t>(n));
+    A.clear(); w = 0;
+    auto scan = [&](const edge& e) {  // 辺を重みの小さいものから順に検討する(kruskal_scanと同じ)
+        if (ds.merge(e.src, e.dst)) { A.push_back(e); w += e.w; }
+        return static_cast<index_t>(A.size()) < n - 1;
+    };
+
+    // 1. 辺を連に区切って読み込み、整列して書き出す
+    const std::size_t run_edges = std::max<std::size_t>(opt.memory / (2 * sizeof(edge)), 1);
+    std::vector<run_file> runs;
+    edges_t R;
+    R.reserve(static_cast<std::size_t>(std::min<std::uint64_t>(run_edges, S.m)));
+    for (edge e; S.next(e); ) {
+        if (e.src == e.dst || (opt.symmetric && e.src > e.dst)) { continue; }  // 自己ループは森に加わらない
+        R.push_back(e);
+        if (R.size() < run_edges) { continue; }
+        sort_run(R, opt.threads);
+        if (!write_run(R, opt, runs)) { return false; }
+        R.clear();
+    }
+    if (S.failed()) { return false; }
+    sort_run(R, opt.threads);
+    if (runs.empty()) {  // すべての辺がメモリに収まったので、一時ファイルは要らない
+        for (auto&& e : R) { if (!scan(e)) { break; } }
+        return true;
+    }
+    if (!R.empty() && !write_run(R, opt, runs)) { return false; }
+    edges_t().swap(R);
+
+    // 2. 一度に併合できる数まで連を減らしてから、最後の併合の順に辺を検討する
+    const std::size_t fan_in = std::max<std::size_t>(opt.memory / std::max<std::size_t>(opt.block, 1), 2);
+    while (runs.size() > fan_in) {
+        std::vector<run_file> merged;
+        for (std::size_t r = 0; r < runs.size(); r += fan_in) {
+            auto first = runs.begin() + r, last = runs.begin() + std::min(r + fan_in, runs.size());
+            run_file out;
+            if (!out.create(opt.temp_dir)) { return false; }
+            block_writer<edge> W(out.fp.get(), opt.block);
+            if (!merge_runs(first, last, opt.block, [&](const edge& e) { W.put(e); ++out.count; return true; })) { return false; }
+            if (!W.flush() || std::fflush(out.fp.get()) != 0) { return false; }
+            std::for_each(first, last, [](run_file& f) { f.remove(); });  // 併合した連はすぐに削除する
+            merged.push_back(std::move(out));
+        }
+        runs.swap(merged);
+    }
+    return n == 0 || merge_runs(runs.begin(), runs.end(), opt.block, scan);
+}
+
+
+/**
+ * @brief  スナップショットのファイルpathのグラフの連結成分を、辺を1回だけ順に読んで求める
+ */
+bool external_connected_components(const std::string& path, indices_t& label, const external_options& opt)
+{
+    edge_stream S;
+    if (!S.open(path, opt.block, false)) { return false; }
+    const index_t n = static_cast<index_t>(S.n);
+    disjoint_sets ds(static_cast<std::size_t>(n));
+    for (edge e; S.next(e); ) {
+        if (opt.symmetric && e.src > e.dst) { continue; }
+        ds.merge(e.src, e.dst);
+    }
+    if (S.failed()) { return false; }
+
+    // 各集合の代表元を、その集合に属する最小の頂点に付け替える
+    label.assign(n, limits::nil);
+    indices_t first(n, limits::nil);
+    for (index_t v = 0; v < n; ++v) {
+        index_t r = ds.find_set(v);
+        if (first[r] == limits::nil) { first[r] = v; }
+        label[v] = first[r];
+    }
+    return true;
+}
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
@@ -0,0 +1,112 @@
+/**
+ * @brief  スナップショットのファイルから辺を順に読み込み、素集合森だけをメモリに置いて最小全域森と連結成分を求める(準外部記憶のアルゴリズム)
+ *
+ * @note   kruskal(kruskal/kruskal.hpp)はすべての辺をedges_tとしてメモリに取り出してから整列するので、Θ(E)のメモリを要する
+ *         辺の集合がメモリに収まらないグラフでも、頂点ごとのΟ(V)のデータ(素集合森disjoint_sets)はメモリに収まることが多い
+ *         この準外部記憶(semi-external)のモデルでは、辺はスナップショット(snapshot/snapshot.hpp)のファイルの配列offset, dst, wを
+ *         先頭から順に大きなブロックで読み込み、メモリには読み込み中のブロックだけを置く
+ *
+ * @note   連結成分 : 辺を1回だけ順に読み、各辺(u, v)について素集合森でuとvを含む集合を合併する. 整列は要らない
+ *         最小全域森 : 外部整列(external sorting)の後にKruskalのアルゴリズムを実行する
+ *           1. 辺を大きさmemoryの連(run)に区切って読み込み、各連を重みの順に基数ソートして一時ファイルに書き出す
+ *           2. 各連の先頭の辺をmin優先度付きキューに置き、k個の連を併合(k-way merge)しながら、その順にKruskalのアルゴリズムで辺を検討する
+ *         連の数が一度に併合できる数(memory / block)を超えるときは、併合して長い連を作る段を重ねる. すべての辺が1つの連に収まれば、
+ *         一時ファイルを使わずにメモリの上で整列する
+ *
+ * @note   読み書きはすべてブロック単位の順次アクセスであり、ファイルの同じ位置を2度読むことはない
+ *         辺の読み書きの量は、連結成分ではΘ(E)、最小全域森では併合の段数をpとしてΘ(E(1 + 2p))バイトの定数倍である
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef SEMI_EXTERNAL_HPP
+#define SEMI_EXTERNAL_HPP
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "../graph/graph.hpp"
+#include <cstddef>
+#include <string>
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief  準外部記憶のアルゴリズムの設定
+ */
+struct external_options {
+    std::size_t memory    = std::size_t(256) << 20;  /**< 連の整列と併合に用いるメモリの上限[byte](素集合森と結果は含まない) */
+    std::size_t block     = std::size_t(1) << 20;    /**< ファイルを読み書きする単位[byte] */
+    std::string temp_dir;                            /**< 連を書き出す一時ファイルのディレクトリ(空ならばstd::tmpfileを用いる) */
+    bool        symmetric = false;                   /**< 無向グラフの各辺が両方向の辺として格納されているか？(trueならばu < vの辺だけを用いる) */
+    unsigned    threads   = 0;                       /**< 連の基数ソートのスレッド数(0ならばハードウェアの並列度) */
+};
+
+
+
+//****************************************
+// 関数の宣言
+//****************************************
+
+/**
+ * @brief  スナップショットのファイルpathのグラフに対して、辺をメモリに取り出さずにKruskalのアルゴリズムを実行する
+ *
+ * @note   結果の重みはkruskal(csr_graph)と同じである(重みの等しい辺があれば、辺集合は異なりうる)
+ *         辺を重みwの非減少順に併合しながら検討し、Aが|V| - 1本の辺を含んだ時点で残りの連は読まない
+ *         連の大きさはopt.memory / (2 sizeof(edge))本である(基数ソートが同じ大きさの作業領域を用いるため)
+ *
+ * @param  const std::string&      path  スナップショットのファイル名
+ * @param  edges_t&                A     最小全域森の辺集合
+ * @param  weight_t&               w     最小全域森の重み
+ * @param  const external_options& opt   設定
+ * @return ファイルの読み書きに成功したか？(失敗したときはAとwは不定である)
+ */
+bool external_kruskal(const std::string& path, edges_t& A, weight_t& w, const external_options& opt = external_options());
+
+
+
+/**
+ * @brief  スナップショットのファイルpathのグラフの連結成分を、辺を1回だけ順に読んで求める
+ *
+ * @note   結果はconnected_components(connected_components/connected_components.hpp)と同じであり、各頂点の連結成分の番号は成分に属する頂点の最小の添字である
+ *         有向グラフでは辺の向きを無視した弱連結成分を求める. 用いるメモリは素集合森とlabel、および配列offsetとdstの読み込み中のブロックだけである
+ *
+ * @param  const std::string&      path   スナップショットのファイル名
+ * @param  indices_t&              label  各頂点vの連結成分の番号
+ * @param  const external_options& opt    設定(blockとsymmetricだけを用いる)
+ * @return ファイルの読み込みに成功したか？
+ */
+bool external_connected_components(const std::string& path, indices_t& label, const external_options& opt = external_options());
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
+
+
+
+#endif  // end of SEMI_EXTERNAL_HPP
@@ -0,0 +1,170 @@
+/**
+ * @brief  CSR表現のグラフのスナップショットの保存と、メモリ写像による読み込みの実装を行う
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include "../graph/mapped_file.hpp"
+#include "snapshot.hpp"
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+namespace {
+
+    const char          magic[8]   = { 'G', 'R', 'A', 'P', 'H', 'C', 'S', 'R' };
+    const std::uint32_t version    = 1;
+    const std::uint32_t byte_order = 0x01020304;
+    const std::uint64_t alignment  = 64;
+
+    /**< @brief xをalignmentの倍数に切り上げる */
+    std::uint64_t align(std::uint64_t x) { return (x + alignment - 1) / alignment * alignment; }
+
+
+    /**< @brief 頂点数n、辺数mのグラフのヘッダを作る */
+    snapshot_header make_header(std::uint64_t n, std::uint64_t m)
+    {
+        snapshot_header h;
+        std::memset(&h, 0, sizeof(h));
+        std::memcpy(h.magic, magic, sizeof(magic));
+        h.version     = version;
+        h.byte_order  = byte_order;
+        h.index_size  = sizeof(index_t);
+        h.weight_size = sizeof(weight_t);
+        h.n = n; h.m = m;
+        h.offset_pos  = align(sizeof(snapshot_header));
+        h.dst_pos     = align(h.offset_pos + (n + 1) * sizeof(index_t));
+        h.w_pos       = align(h.dst_pos + m * sizeof(index_t));
+        return h;
+    }
+
+
+    /**< @brief ファイルの大きさ[byte]を返す */
+    std::uint64_t file_size(const snapshot_header& h) { return h.w_pos + h.m * sizeof(weight_t); }
+
+
+    /**
+     * @brief  大きさsize[byte]のファイルの先頭にあるヘッダhが、このプログラムで読める形式か確かめる
+     * @note   配列の位置を自分で計算し直して比べるので、ヘッダが壊れていても配列がファイルの外を指すことはない
+     */
+    bool valid_header(const snapshot_header& h, std::uint64_t size)
+    {
+        if (std::memcmp(h.magic, magic, sizeof(magic)) != 0 || h.version != version || h.byte_order != byte_order) { return false; }
+        if (h.index_size != sizeof(index_t) || h.weight_size != sizeof(weight_t)) { return false; }
+        if (h.n >= static_cast<std::uint64_t>(std::numeric_limits<index_t>::max()) ||
+            h.m >  static_cast<std::uint64_t>(std::numeric_limits<index_t>::max())) { return false; }
+        snapshot_header e = make_header(h.n, h.m);
+        return h.offset_pos == e.offset_pos && h.dst_pos == e.dst_pos && h.w_pos == e.w_pos && file_size(e) == size;
+    }
+
+
+    /**< @brief 配列の中身を検査する(load_snapshotのverify) */
+    bool valid_arrays(const csr_graph& G)
+    {
+        const index_t n = G.size();
+        for (index_t u = 0; u < n; ++u) { if (G.offset[u] > G.offset[u + 1]) { return false; } }
+        for (index_t i = 0; i < G.edge_count(); ++i) { if (G.dst[i] < 0 || G.dst[i] >= n) { return false; } }
+        return true;
+    }
+
+
+    /**< @brief ファイルfpの現在の位置にsize[byte]を書き込み、posまで0で埋める */
+    bool write_at(std::FILE* fp, std::uint64_t& cur, std::uint64_t pos, const void* p, std::size_t size)
+    {
+        static const char zeros[alignment] = {};
+        if (pos < cur || pos - cur > alignment) { return false; }
+        if (pos > cur && std::fwrite(zeros, 1, pos - cur, fp) != pos - cur) { return false; }
+        if (size > 0 && std::fwrite(p, 1, size, fp) != size) { return false; }
+        cur = pos + size;
+        return true;
+    }
+
+}
+
+
+/**
+ * @brief  グラフGをスナップショットとしてファイルpathに保存する
+ */
+bool save_snapshot(const std::string& path, const csr_graph& G)
+{
+    const std::uint64_t n = G.size(), m = G.edge_count();
+    snapshot_header h = make_header(n, m);
+    std::FILE* fp = std::fopen(path.c_str(), "wb");
+    if (!fp) { return false; }
+    std::uint64_t cur = 0;
+    bool ok = write_at(fp, cur, 0, &h, sizeof(h))
+           && write_at(fp, cur, h.offset_pos, G.offset.data(), (n + 1) * sizeof(index_t))
+           && write_at(fp, cur, h.dst_pos, G.dst.data(), m * sizeof(index_t))
+           && write_at(fp, cur, h.w_pos, G.w.data(), m * sizeof(weight_t));
+    return std::fclose(fp) == 0 && ok;
+}
+
+
+/**
+ * @brief  スナップショットのファイルpathを写像し、写像したメモリの上にGを構成する
+ * @note   写像の解除はG.offset, G.dst, G.wが共有するkeeperが行う
+ */
+bool load_snapshot(const std::string& path, csr_graph& G, bool verify)
+{
+    mapped_file F;
+    if (!map_file(path, F) || F.size < sizeof(snapshot_header)) { return false; }
+
+    snapshot_header h;
+    std::memcpy(&h, F.data, sizeof(h));
+    if (!valid_header(h, F.size)) { return false; }
+
+    const index_t* offset = reinterpret_cast<const index_t*>(F.data + h.offset_pos);
+    if (offset[0] != 0 || static_cast<std::uint64_t>(offset[h.n]) != h.m) { return false; }
+
+    csr_graph H;
+    H.offset = buffer<index_t>::borrow(offset, h.n + 1, F.keeper);
+    H.dst    = buffer<index_t>::borrow(reinterpret_cast<const index_t*>(F.data + h.dst_pos), h.m, F.keeper);
+    H.w      = buffer<weight_t>::borrow(reinterpret_cast<const weight_t*>(F.data + h.w_pos), h.m, F.keeper);
+    if (verify && !valid_arrays(H)) { return false; }
+    G = std::move(H);
+    return true;
+}
+
+
+/**
+ * @brief  スナップショットのファイルpathのヘッダだけを読み込み、検査する
+ */
+bool read_snapshot_header(const std::string& path, snapshot_header& h)
+{
+    std::FILE* fp = std::fopen(path.c_str(), "rb");
+    if (!fp) { return false; }
+    snapshot_header H;
+    bool ok = std::fread(&H, sizeof(H), 1, fp) == 1 && std::fseek(fp, 0, SEEK_END) == 0;
+    long size = ok ? std::ftell(fp) : -1;
+    std::fclose(fp);
+    if (size < 0 || !valid_header(H, static_cast<std::uint64_t>(size))) { return false; }
+    h = H;
+    return true;
+}
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
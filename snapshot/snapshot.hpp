@@ -0,0 +1,128 @@
+/**
+ * @brief  CSR表現のグラフをバイナリ形式のファイル(スナップショット)に保存し、メモリ写像(mmap)によってコピーせずに読み込む
+ *
+ * @note   テキストの辺リストを1辺ずつ解析してemplace_backする読み込みは、辺の数が多いと問い合わせそのものより時間がかかる
+ *         スナップショットはcsr_graphの3本の配列をそのままの表現で並べたファイルであり、load_snapshotはファイルを読み取り専用で
+ *         写像し、その上に配列を直接構成する. 読み込みはヘッダの検査だけでΟ(1)時間で終わり、各ページは初めて触れたときに
+ *         OSによって読み込まれる. 同じファイルを複数のプロセスで読み込めば、ページキャッシュを共有する
+ *
+ * @note   ファイルの形式(バージョン1). 数値はすべて書き込んだ計算機のバイト順である
+ *           [0, 64)                snapshot_header
+ *           [offset_pos, ...)      offset[0..|V|]  (index_t, |V| + 1個)
+ *           [dst_pos, ...)         dst[0..|E|)     (index_t, |E|個)
+ *           [w_pos, ...)           w[0..|E|)       (weight_t, |E|個)
+ *         各配列の開始位置は64バイト境界に揃える
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef SNAPSHOT_HPP
+#define SNAPSHOT_HPP
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "../graph/graph.hpp"
+#include "../graph/csr.hpp"
+#include <cstdint>
+#include <string>
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief スナップショットのファイルの先頭に置くヘッダ(64バイト)
+ */
+struct snapshot_header {
+    char          magic[8];     /**< "GRAPHCSR" */
+    std::uint32_t version;      /**< 形式のバージョン */
+    std::uint32_t byte_order;   /**< 0x01020304. 読み込む計算機とバイト順が異なれば、別の値として読める */
+    std::uint32_t index_size;   /**< sizeof(index_t) */
+    std::uint32_t weight_size;  /**< sizeof(weight_t) */
+    std::uint64_t n;            /**< 頂点数|V| */
+    std::uint64_t m;            /**< 辺数|E| */
+    std::uint64_t offset_pos;   /**< 配列offsetの開始位置[byte] */
+    std::uint64_t dst_pos;      /**< 配列dstの開始位置[byte] */
+    std::uint64_t w_pos;        /**< 配列wの開始位置[byte] */
+};
+
+static_assert(sizeof(snapshot_header) == 64, "the snapshot header must be 64 bytes");
+
+
+
+//****************************************
+// 関数の宣言
+//****************************************
+
+/**
+ * @brief  グラフGをスナップショットとしてファイルpathに保存する
+ * @param  const std::string& path  保存先のファイル名
+ * @param  const csr_graph&   G     グラフG
+ * @return 書き込みに成功したか？
+ */
+bool save_snapshot(const std::string& path, const csr_graph& G);
+
+
+
+/**
+ * @brief  スナップショットのファイルpathを読み込み、Gとする
+ *
+ * @note   ファイルをmap_file(graph/mapped_file.hpp)で読み取り専用で写像し、G.offset, G.dst, G.wは写像したメモリを直接参照する
+ *         写像はGとそのコピー(およびそれらの配列のコピー)がすべて破棄されたときに解除される. Gを書き換えると、その配列だけが
+ *         自分のメモリにコピーされる. mmapがない環境では、ファイル全体を読み込んだ配列を参照する
+ *
+ * @note   ヘッダの検査(マジックナンバー、バージョン、バイト順、型の大きさ、ファイルの大きさ)だけを行い、配列の中身は読まない
+ *         信頼できないファイルを読み込むときはverify = trueとすると、offsetが単調非減少でoffset[|V|] = |E|であること、
+ *         各dstが[0, |V|)にあることをΘ(V + E)時間で確かめる
+ *
+ * @param  const std::string& path    スナップショットのファイル名
+ * @param  csr_graph&         G       読み込んだグラフ(失敗したときは変更しない)
+ * @param  bool               verify  配列の中身も検査するか？
+ * @return 読み込みに成功したか？
+ */
+bool load_snapshot(const std::string& path, csr_graph& G, bool verify = false);
+
+
+
+/**
+ * @brief  スナップショットのファイルpathのヘッダだけを読み込み、検査する
+ * @note   配列を写像せずにファイルから順に読み込む処理(semi_external/semi_external.hpp)が、配列の位置と大きさを知るために用いる
+ *         検査の内容はload_snapshotのヘッダの検査と同じである
+ *
+ * @param  const std::string& path  スナップショットのファイル名
+ * @param  snapshot_header&   h     読み込んだヘッダ(失敗したときは変更しない)
+ * @return 読み込みに成功し、ヘッダが正しかったか？
+ */
+bool read_snapshot_header(const std::string& path, snapshot_header& h);
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
+
+
+
+#endif  // end of SNAPSHOT_HPP
@@ -0,0 +1,317 @@
+/**
+ * @brief  頂点数がコンパイル時に決まる小さなグラフに対するFloyd-Warshall、Dijkstra、Kruskal、トポロジカルソートを扱う
+ *
+ * @note   kruskal.cppのmainの9頂点のグラフや、dsp.cppのmainの6頂点のDAGのような小さな問題を大量に解くと、
+ *         graph_tの隣接リストやstd::priority_queueの確保と解放が、アルゴリズムそのものより時間を占める
+ *         この版はグラフを頂点数Nをテンプレート引数とするstd::arrayの隣接行列static_matrix<N>で表し、作業領域もすべてstd::arrayに置く
+ *           - 動的なメモリの確保を一切行わない
+ *           - すべての関数はconstexprであり、定数式の中で呼び出せる(static_assertで結果を確かめたり、表を翻訳時に作ったりできる)
+ *           - 最も内側のループ(行の緩和、最小値の選択)はstatic_forで展開し、ループの回数がNに比例する命令列をそのまま生成する
+ *
+ * @note   隣接行列の規約はfloyd_warshall(matrix_t)と同じである. wij = ∞(limits::inf)ならば辺(i, j)はなく、対角成分は0とする
+ *         結果は、行列から行の順に辺を並べた隣接リスト表現に対する実行時の版(floyd_warshall, dijkstra, kruskal, tsort)と同じである
+ *         (kruskalは重みが同じで、辺集合は重みの等しい辺の選び方だけ異なりうる)
+ *
+ * @note   使い方
+ *           constexpr auto W = graph::make_static_matrix<4>(std::array<graph::static_edge, 3>{{ {0, 1, 5}, {1, 2, 3}, {2, 3, 1} }});
+ *           constexpr auto D = graph::floyd_warshall(W);
+ *           static_assert(D[0][3] == 9, "");
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef STATIC_GRAPH_HPP
+#define STATIC_GRAPH_HPP
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "../graph/graph.hpp"
+#include <cstddef>
+#include <array>
+#include <utility>
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 型エイリアス
+//****************************************
+
+template<std::size_t N> using static_matrix = std::array<std::array<weight_t, N>, N>;  /**< N頂点のグラフの隣接行列 */
+template<std::size_t N> using static_order  = std::array<index_t, N>;                  /**< 頂点の並び */
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief  辺(u, v)と重みw
+ * @note   edgeは重みと容量の共用体を持ち、コンストラクタがconstexprでないので、定数式の中では代わりにこの集成体を用いる
+ */
+struct static_edge {
+    index_t  src;  /**< 辺の始点u */
+    index_t  dst;  /**< 辺の終点v */
+    weight_t w;    /**< 辺(u, v)の重み */
+};
+
+
+/**
+ * @brief  N頂点のグラフの単一始点最短路(dijkstraの結果)
+ */
+template<std::size_t N>
+struct static_paths {
+    std::array<weight_t, N> d;   /**< 始点sからの最短路重み(到達できなければ∞) */
+    std::array<index_t, N>  pi;  /**< 先行点(始点と到達できない頂点はNIL) */
+};
+
+
+/**
+ * @brief  N頂点のグラフの最小全域森(kruskalの結果)
+ */
+template<std::size_t N>
+struct static_forest {
+    std::array<static_edge, N> edges;  /**< 森の辺. 先頭のsize本だけが意味を持つ(高々N - 1本) */
+    std::size_t                size;   /**< 森の辺の数 */
+    weight_t                   w;      /**< 森の重み */
+};
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**
+ * @brief  f(0), f(1), ..., f(N - 1)を順に呼び出す
+ * @note   畳み込み式で呼び出しを並べるので、ループの制御を含まない命令列に展開される
+ */
+template<class Function, std::size_t... I>
+constexpr void static_for(Function&& f, std::index_sequence<I...>)
+{
+    (f(I), ...);
+}
+
+template<std::size_t N, class Function>
+constexpr void static_for(Function&& f)
+{
+    static_for(f, std::make_index_sequence<N>());
+}
+
+
+/**
+ * @brief  辺の集合EからN頂点のグラフの隣接行列を作る
+ * @note   対角成分を0、辺のない要素を∞とする. 同じ辺(u, v)が複数あれば、最も軽い重みを用いる
+ */
+template<std::size_t N, std::size_t M>
+constexpr static_matrix<N> make_static_matrix(const std::array<static_edge, M>& E)
+{
+    static_matrix<N> W{};
+    for (std::size_t i = 0; i < N; ++i) {
+        for (std::size_t j = 0; j < N; ++j) { W[i][j] = i == j ? 0 : static_cast<weight_t>(limits::inf); }
+    }
+    for (auto&& e : E) {
+        if (e.src != e.dst && e.w < W[e.src][e.dst]) { W[e.src][e.dst] = e.w; }
+    }
+    return W;
+}
+
+
+/**
+ * @brief  Floyd-Warshallのアルゴリズム
+ * @note   D(k)の第i行は、D(k-1)の第i行と、dikにD(k-1)の第k行を足したものの要素ごとの最小値である. 第k行は第kの段で変わらない
+ *         Θ(N^3)時間であり、第i行の更新は展開したN要素の最小値の列になる
+ *
+ * @param  const static_matrix<N>& W 重み行列
+ * @return 最短路重みの行列D
+ */
+template<std::size_t N>
+constexpr static_matrix<N> floyd_warshall(const static_matrix<N>& W)
+{
+    static_matrix<N> D = W;
+    for (std::size_t k = 0; k < N; ++k) {
+        for (std::size_t i = 0; i < N; ++i) {
+            const weight_t dik = D[i][k];
+            if (dik == limits::inf) { continue; }  // 頂点kを経由してもiからの路は改善されない
+            static_for<N>([&](std::size_t j) {
+                // dkj = ∞ならば飛ばす. 負のdikを足すと∞より小さくなり、到達できない要素が有限の値に見えてしまう
+                weight_t x = dik + D[k][j];  // ∞はweight_tの最大値の3分の1なので桁あふれしない
+                D[i][j] = D[k][j] != limits::inf && x < D[i][j] ? x : D[i][j];
+            });
+        }
+    }
+    return D;
+}
+
+
+/**
+ * @brief  Dijkstraのアルゴリズム
+ * @note   隣接行列に対するdijkstra(matrix_t, s)と同じく、優先度付きキューの代わりに未確定の頂点の推定値qから最小値を線形に探す
+ *         Θ(N^2)時間である. 辺の重みは非負であること
+ *
+ * @param  const static_matrix<N>& W 重み行列
+ * @param  index_t                 s 始点
+ * @return 最短路重みdと先行点π
+ */
+template<std::size_t N>
+constexpr static_paths<N> dijkstra(const static_matrix<N>& W, index_t s)
+{
+    static_paths<N> P{};
+    std::array<weight_t, N> q{};
+    for (std::size_t v = 0; v < N; ++v) { P.d[v] = q[v] = limits::inf; P.pi[v] = limits::nil; }
+    P.d[s] = q[s] = 0;
+    for (std::size_t round = 0; round < N; ++round) {
+        // 始点sからの最小の最短路推定値を持つ頂点u ∈ V - Sを選択する(等しければ添字の小さい頂点)
+        index_t  u = limits::nil;
+        weight_t m = limits::inf;
+        static_for<N>([&](std::size_t v) {
+            bool c = q[v] < m;
+            m = c ? q[v] : m;
+            u = c ? static_cast<index_t>(v) : u;
+        });
+        if (u == limits::nil) { break; }  // 残りの頂点には到達できない
+        const weight_t du = P.d[u];
+        static_for<N>([&](std::size_t v) {
+            weight_t x = du + W[u][v];
+            bool     c = x < P.d[v];
+            P.d[v]  = c ? x : P.d[v];
+            q[v]    = c ? x : q[v];
+            P.pi[v] = c ? u : P.pi[v];
+        });
+        q[u] = limits::inf;  // uは集合Sに属す
+    }
+    return P;
+}
+
+
+/**
+ * @brief  辺の集合Eに対するKruskalのアルゴリズム
+ * @note   辺を挿入ソートで重みの非減少順に安定に並べ、素集合森(要素の親、根ならば木の大きさの符号を反転したもの)で異なる木を結ぶ辺を選ぶ
+ *         辺の数Mは小さいと想定する(整列はΟ(M^2)時間). 森が|V| - 1本の辺を含んだ時点で残りの辺は調べない
+ *
+ * @tparam N 頂点数
+ * @param  const std::array<static_edge, M>& E 辺の集合
+ * @return 最小全域森
+ */
+template<std::size_t N, std::size_t M>
+constexpr static_forest<N> kruskal(std::array<static_edge, M> E)
+{
+    for (std::size_t i = 1; i < M; ++i) {  // 重みwの非減少順に辺を安定に並べる
+        static_edge e = E[i];
+        std::size_t j = i;
+        for (; j > 0 && e.w < E[j - 1].w; --j) { E[j] = E[j - 1]; }
+        E[j] = e;
+    }
+
+    std::array<index_t, N> p{};
+    for (auto&& x : p) { x = -1; }
+    auto find_set = [&p](index_t x) {  // 経路半分化を行う
+        while (p[x] >= 0) {
+            if (p[p[x]] >= 0) { p[x] = p[p[x]]; }
+            x = p[x];
+        }
+        return x;
+    };
+
+    static_forest<N> F{};
+    for (std::size_t i = 0; i < M && F.size + 1 < N; ++i) {
+        index_t x = find_set(E[i].src), y = find_set(E[i].dst);
+        if (x == y) { continue; }
+        if (p[x] > p[y]) { index_t t = x; x = y; y = t; }  // 小さい方の木の根を大きい方の木の根の子にする
+        p[x] += p[y];
+        p[y] = x;
+        F.edges[F.size++] = E[i];
+        F.w += E[i].w;
+    }
+    return F;
+}
+
+
+/**
+ * @brief  隣接行列Wで表されたグラフに対するKruskalのアルゴリズム
+ * @note   i != jかつwij != ∞の要素を、行の順に辺として並べてから調べる. 無向グラフは対称な行列で表す
+ */
+template<std::size_t N>
+constexpr static_forest<N> kruskal(const static_matrix<N>& W)
+{
+    std::array<static_edge, N * N> E{};
+    std::size_t m = 0;
+    for (std::size_t i = 0; i < N; ++i) {
+        for (std::size_t j = 0; j < N; ++j) {
+            if (i != j && W[i][j] != limits::inf) { E[m++] = static_edge{ static_cast<index_t>(i), static_cast<index_t>(j), W[i][j] }; }
+        }
+    }
+    for (std::size_t i = m; i < N * N; ++i) { E[i] = static_edge{ 0, 0, limits::inf }; }  // 自己ループは森に加わらないので、末尾を埋めるのに使う
+    return kruskal<N>(E);
+}
+
+
+/**
+ * @brief  隣接行列Wで表された有向非巡回グラフのトポロジカルソート
+ * @note   tsort(graph_t)と同じく、明示的なスタックによる深さ優先探索で終了した頂点を配列の末尾から置く
+ *         スタックには頂点uと、次に調べる列の位置を積む. 各頂点は高々1回しか積まれないので、スタックの大きさはNで足りる
+ *
+ * @param  const static_matrix<N>& W 重み行列
+ * @return 既ソートリスト
+ */
+template<std::size_t N>
+constexpr static_order<N> tsort(const static_matrix<N>& W)
+{
+    static_order<N> lst{};
+    std::array<vcolor, N>      color{};
+    std::array<index_t, N>     stack{};
+    std::array<std::size_t, N> next{};
+    for (auto&& c : color) { c = vcolor::white; }
+    std::size_t head = N, top = 0;
+
+    for (std::size_t s = 0; s < N; ++s) {
+        if (color[s] != vcolor::white) { continue; }
+        color[s] = vcolor::gray;
+        stack[top] = static_cast<index_t>(s); next[top] = 0; ++top;
+        while (top > 0) {
+            const index_t u = stack[top - 1];
+            std::size_t&  k = next[top - 1];
+            while (k < N && (static_cast<std::size_t>(u) == k || W[u][k] == limits::inf || color[k] != vcolor::white)) { ++k; }
+            if (k < N) {  // uと隣接する白頂点wを調べる
+                const std::size_t w = k++;
+                color[w] = vcolor::gray;
+                stack[top] = static_cast<index_t>(w); next[top] = 0; ++top;
+                continue;
+            }
+            --top;
+            color[u] = vcolor::black;  // uを黒に彩色し、
+            lst[--head] = u;           // リストの先頭に挿入する
+        }
+    }
+    return lst;
+}
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
+
+
+
+#endif  // end of STATIC_GRAPH_HPP
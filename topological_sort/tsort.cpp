@@ -1,6 +1,6 @@
 /**
  * @brief トポロジカルソートの実装
- * @date  @date  2016/02/14 ~ 2016/03/12
+ * @date  2016/02/14 ~ 2026/10/14
  */
 
 
@@ -9,7 +9,10 @@
 // 必要なヘッダファイルのインクルード
 //****************************************
 
-#include <functional>
+#include <atomic>
+#include <algorithm>
+#include <utility>
+#include "../graph/parallel.hpp"
 #include "tsort.hpp"
 
 
@@ -43,43 +46,166 @@ GRAPH_BEGIN
  * @note   深さ優先探索にΘ(V + E)時間かかり、|V|個の頂点のそれぞれを連結リストの先頭に挿入するのにΟ(1)時間かかるので、
  *         トポロジカルソートはΘ(V + E)時間で実行できる
  *
- * @param  const graph_t& G 有向非巡回グラフ
+ * @tparam Graph          グラフGの表現(graph_t, csr_graphまたはcompressed_graph)
+ * @param  const Graph& G 有向非巡回グラフ
  * @return 既ソートリスト
  */
-array_t tsort(const graph_t& G)
+template<class Graph>
+static indices_t tsort_impl(const Graph& G)
 {
     index_t n = G.size();
     std::vector<vcolor> color(n, vcolor::white);
-    array_t lst(n);
+    indices_t lst(n);      // 終了した頂点を末尾から順に置くので、lstは最初から|V|個の要素を持つ
+    index_t head = n;      // リストの先頭の位置
 
     // 白節点を訪れる
-    std::function<bool(index_t)> dfs_visit = [&](index_t u) {
-        color[u] = vcolor::gray;    // uを灰に彩色する
-        for (auto&& e : G[u]) {     // vと隣接する各頂点wを調べ、
-            index_t w = e.dst;
-
-            // wが白なら再帰的にwを調べる
-            if (color[w] == vcolor::white && !dfs_visit(w)) {
-                 return false;
+    // NOTE : 再帰の代わりに、訪問中の頂点uと次に調べる隣接リストの位置kの組を明示的なスタックに積む
+    //        したがって、長い道を含むグラフでもコールスタックを消費しない
+    using position = decltype(G[0].begin());
+    std::vector<std::pair<index_t, position>> stack;
+    auto dfs_visit = [&](index_t s) {
+        color[s] = vcolor::gray;          // sを灰に彩色する
+        stack.emplace_back(s, G[s].begin());
+        while (!stack.empty()) {
+            index_t u = stack.back().first;
+            position& k = stack.back().second;
+            if (k != G[u].end()) {        // uと隣接する各頂点wを調べ、
+                index_t w = (*k).dst; ++k;
+                if (color[w] == vcolor::white) {  // wが白ならwを調べる
+                    color[w] = vcolor::gray;
+                    stack.emplace_back(w, G[w].begin());
+                }
+                continue;
             }
+            stack.pop_back();
+            color[u] = vcolor::black;     // uを黒に彩色する
+            lst[--head] = u;              // リストの先頭に挿入する
         }
-        color[u] = vcolor::black;   // uを黒に彩色する
-        lst.emplace_back(u);        // リストの末尾に挿入する
-        return true;
     };
 
 
     // 各頂点vの終了時刻v.fを計算するためにDFS(G)を呼び出す
     for (index_t v = 0; v < n; ++v) {
-        if (color[v] == vcolor::white && !dfs_visit(v)) {
-            return { };
-        };
+        if (color[v] == vcolor::white) { dfs_visit(v); }
     }
-    reverse(lst.begin(), lst.end());  // リストが逆順にソートされているのでreverseを行う
     return lst;     // 頂点のリストを返す
 }
 
 
+/**
+ * @brief  Kahnのアルゴリズムにより、有向非巡回グラフGの頂点をthreads本のスレッドで段に分解する
+ * @note   各段では、その段の頂点をchunk個ずつ取ってスレッドで分担し、出る辺の終点の入次数を減らす
+ *         入次数を0にした頂点はスレッドごとのリストに置き、段の区切りでスレッド0がそれらをつなげて次の段にする
+ *
+ * @tparam Graph          グラフGの表現(graph_tまたはcsr_graph)
+ */
+template<class Graph>
+static dag_levels tsort_levels_impl(const Graph& G, unsigned threads)
+{
+    constexpr std::size_t chunk = 256;  // 1回に取る頂点の数
+    const std::size_t n = static_cast<std::size_t>(G.size());
+    threads = resolve_threads(threads);
+
+    std::vector<std::atomic<index_t>> indeg(n);
+    std::vector<indices_t> local(threads);
+    std::atomic<std::size_t> cursor(0);
+    dag_levels L;
+    L.order.reserve(n);
+    L.offset.push_back(0);
+    std::size_t first = 0, last = 0;   // 処理中の段の頂点はorder[first], ..., order[last - 1]
+    barrier sync(threads);
+
+    parallel_run(threads, [&](unsigned tid) {
+        const std::size_t lo = n * tid / threads, hi = n * (tid + 1) / threads;
+        for (std::size_t v = lo; v < hi; ++v) { indeg[v].store(0, std::memory_order_relaxed); }
+        sync.arrive_and_wait();
+
+        // 各頂点の入次数を数える
+        for (std::size_t u = lo; u < hi; ++u) {
+            for (auto&& e : G[static_cast<index_t>(u)]) { indeg[e.dst].fetch_add(1, std::memory_order_relaxed); }
+        }
+        sync.arrive_and_wait();
+
+        // 入次数が0の頂点を第0段とする
+        for (std::size_t v = lo; v < hi; ++v) {
+            if (indeg[v].load(std::memory_order_relaxed) == 0) { local[tid].push_back(static_cast<index_t>(v)); }
+        }
+        while (true) {
+            sync.arrive_and_wait();
+            if (tid == 0) {
+                first = L.order.size();
+                for (auto&& X : local) { L.order.insert(L.order.end(), X.begin(), X.end()); X.clear(); }
+                last = L.order.size();
+                if (last > first) { L.offset.push_back(static_cast<index_t>(last)); }
+                cursor.store(first, std::memory_order_relaxed);
+            }
+            sync.arrive_and_wait();
+            if (first == last) { break; }
+
+            // この段の頂点から出る辺を取り除く
+            for (std::size_t i; (i = cursor.fetch_add(chunk, std::memory_order_relaxed)) < last; ) {
+                std::size_t end = std::min(i + chunk, last);
+                for (; i < end; ++i) {
+                    for (auto&& e : G[L.order[i]]) {
+                        if (indeg[e.dst].fetch_sub(1, std::memory_order_acq_rel) == 1) { local[tid].push_back(e.dst); }
+                    }
+                }
+            }
+        }
+    });
+    return L;
+}
+
+
+/**< @brief CSR表現の有向非巡回グラフGの頂点を段に分解する */
+dag_levels tsort_levels(const csr_graph& G, unsigned threads)
+{
+    return tsort_levels_impl(G, threads);
+}
+
+
+/**< @brief 隣接リスト表現の有向非巡回グラフGの頂点を段に分解する */
+dag_levels tsort_levels(const graph_t& G, unsigned threads)
+{
+    return tsort_levels_impl(G, threads);
+}
+
+
+/**< @brief CSR表現の有向非巡回グラフGをthreads本のスレッドでトポロジカルソートする */
+indices_t tsort_parallel(const csr_graph& G, unsigned threads)
+{
+    return tsort_levels_impl(G, threads).order;
+}
+
+
+/**< @brief 隣接リスト表現の有向非巡回グラフGをthreads本のスレッドでトポロジカルソートする */
+indices_t tsort_parallel(const graph_t& G, unsigned threads)
+{
+    return tsort_levels_impl(G, threads).order;
+}
+
+
+/**< @brief 隣接リスト表現の有向非巡回グラフGをトポロジカルソートする */
+indices_t tsort(const graph_t& G)
+{
+    return tsort_impl(G);
+}
+
+
+/**< @brief CSR表現の有向非巡回グラフGをトポロジカルソートする */
+indices_t tsort(const csr_graph& G)
+{
+    return tsort_impl(G);
+}
+
+
+/**< @brief 圧縮表現の有向非巡回グラフGをトポロジカルソートする */
+indices_t tsort(const compressed_graph& G)
+{
+    return tsort_impl(G);
+}
+
+
 
 //****************************************
 // 名前空間の終端
@@ -1,6 +1,6 @@
 /**
  * @brief トポロジカルソート
- * @date  2016/02/14 ~ 2016/03/12
+ * @date  2016/02/14 ~ 2026/10/14
  */
 
 
@@ -19,6 +19,8 @@
 //****************************************
 
 #include "../graph/graph.hpp"
+#include "../graph/csr.hpp"
+#include "../graph/compressed.hpp"
 
 
 
@@ -30,6 +32,24 @@ GRAPH_BEGIN
 
 
 
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief 有向非巡回グラフの頂点の段(level)への分解
+ * @note  第l段の頂点はorder[offset[l]], ..., order[offset[l + 1] - 1]である. 各辺(u, v)について、uの段はvの段より小さい
+ */
+struct dag_levels {
+    indices_t order;   /**< 段の順に並べた頂点(トポロジカルソート順になっている) */
+    indices_t offset;  /**< 第l段の開始位置(offset[段の数] = order.size()) */
+
+    /**< @brief 段の数を返す */
+    index_t size() const { return static_cast<index_t>(offset.size()) - 1; }
+};
+
+
+
 //****************************************
 // 関数の宣言
 //****************************************
@@ -51,10 +71,68 @@ GRAPH_BEGIN
  * @note   深さ優先探索にΘ(V + E)時間かかり、|V|個の頂点のそれぞれを連結リストの先頭に挿入するのにΟ(1)時間かかるので、
  *         トポロジカルソートはΘ(V + E)時間で実行できる
  *
+ * @note   深さ優先探索は再帰を用いず明示的なスタックで行い、終了した頂点を長さ|V|の配列に末尾から置く
+ *         Gが巡回路を含む場合も、終了時刻の降順に並べた頂点のリストを返す
+ *
  * @param  const graph_t& G 有向非巡回グラフ
  * @return 既ソートリスト
  */
-array_t tsort(const graph_t& G);
+indices_t tsort(const graph_t& G);
+
+
+
+/**
+ * @brief  CSR表現の有向非巡回グラフGをトポロジカルソートする
+ * @note   結果はgraph_tに対するtsortと同じである
+ *
+ * @param  const csr_graph& G 有向非巡回グラフ
+ * @return 既ソートリスト
+ */
+indices_t tsort(const csr_graph& G);
+
+
+
+/**
+ * @brief  圧縮表現の有向非巡回グラフGをトポロジカルソートする
+ * @note   隣接リストは終点の昇順に並び直されているので、結果は同じ順に並べたgraph_tに対するtsortと同じである
+ *
+ * @param  const compressed_graph& G 有向非巡回グラフ
+ * @return 既ソートリスト
+ */
+indices_t tsort(const compressed_graph& G);
+
+
+
+/**
+ * @brief  Kahnのアルゴリズムにより、有向非巡回グラフGの頂点を段に分解する
+ *
+ * @note   入次数が0の頂点を第0段とし、第l段の頂点をすべて取り除いたときに入次数が0になる頂点を第l + 1段とする
+ *         同じ段の頂点の間には辺がないので、各段の頂点は互いに独立に処理できる
+ *         入次数は不可分な計数器で持ち、各段の頂点から出る辺をthreads本のスレッドで分担して入次数を減らす
+ *         入次数を0にしたスレッドだけがその頂点を次の段に加える. 段の区切りでは待ち合わせる
+ *
+ * @note   Gが巡回路を含むとき、巡回路上の頂点とそこから到達できる頂点はどの段にも入らない(order.size() < |V|となる)
+ *         各段の中の頂点の順序はスレッドの実行順によって変わりうる
+ *
+ * @param  const csr_graph& G       有向非巡回グラフ
+ * @param  unsigned         threads スレッド数(0ならばハードウェアの並列度)
+ * @return 頂点の段への分解
+ */
+dag_levels tsort_levels(const csr_graph& G, unsigned threads = 0);
+dag_levels tsort_levels(const graph_t& G, unsigned threads = 0);
+
+
+
+/**
+ * @brief  有向非巡回グラフGをthreads本のスレッドでトポロジカルソートする
+ * @note   tsort_levelsの段の順に頂点を並べたものを返す. Gが巡回路を含むとき、返すリストは|V|個より少ない頂点しか含まない
+ *
+ * @param  const csr_graph& G       有向非巡回グラフ
+ * @param  unsigned         threads スレッド数(0ならばハードウェアの並列度)
+ * @return 既ソートリスト
+ */
+indices_t tsort_parallel(const csr_graph& G, unsigned threads = 0);
+indices_t tsort_parallel(const graph_t& G, unsigned threads = 0);
 
 
 
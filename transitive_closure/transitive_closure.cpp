@@ -0,0 +1,139 @@
+/**
+ * @brief  有向グラフの推移閉包と到達可能性の問い合わせの実装
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "transitive_closure.hpp"
+#include "../graph/stats.hpp"
+#include <algorithm>
+#include <numeric>
+#include <vector>
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+namespace {
+
+    using word_t = bit_matrix::word_t;
+
+
+    /**
+     * @brief  c[k] |= b[k] (k = 0, 1, ..., len - 1)を計算する
+     * @note   c, bは64バイト境界に揃っており、lenは8の倍数である(bit_matrixの行の先頭とstride)
+     */
+    inline void or_row(word_t* c, const word_t* b, std::size_t len)
+    {
+        std::size_t k = 0;
+#if defined(__AVX512F__)
+        for (; k + 8 <= len; k += 8) {
+            __m512i vc = _mm512_load_si512(c + k), vb = _mm512_load_si512(b + k);
+            _mm512_store_si512(c + k, _mm512_or_si512(vc, vb));
+        }
+#elif defined(__AVX2__)
+        for (; k + 4 <= len; k += 4) {
+            __m256i vc = _mm256_load_si256(reinterpret_cast<const __m256i*>(c + k));
+            __m256i vb = _mm256_load_si256(reinterpret_cast<const __m256i*>(b + k));
+            _mm256_store_si256(reinterpret_cast<__m256i*>(c + k), _mm256_or_si256(vc, vb));
+        }
+#endif
+        for (; k < len; ++k) { c[k] |= b[k]; }
+    }
+
+
+    /**
+     * @brief  隣接行列Aで表したグラフで、始点sから到達できる頂点の集合をビット列seenに求める
+     * @note   各段で、フロンティアの頂点の行をnextにORし、既訪問の頂点を除いたものを次のフロンティアとする
+     */
+    void reach(const bit_matrix& A, index_t s, std::vector<word_t>& seen, std::vector<word_t>& frontier, std::vector<word_t>& next)
+    {
+        const std::size_t words = A.words();
+        seen.assign(words, 0);
+        frontier.assign(words, 0);
+        seen[s / bit_matrix::bits] = frontier[s / bit_matrix::bits] = word_t(1) << (s % bit_matrix::bits);
+
+        for (bool more = true; more; ) {
+            next.assign(words, 0);
+            for (std::size_t k = 0; k < words; ++k) {
+                for (word_t x = frontier[k]; x != 0; x &= x - 1) {
+                    const word_t* r = A.row(k * bit_matrix::bits + __builtin_ctzll(x));
+                    for (std::size_t l = 0; l < words; ++l) { next[l] |= r[l]; }
+                    GRAPH_STAT_ADD(edges_scanned, words);
+                }
+            }
+            more = false;
+            for (std::size_t l = 0; l < words; ++l) {
+                frontier[l] = next[l] & ~seen[l];
+                seen[l] |= frontier[l];
+                more = more || frontier[l] != 0;
+            }
+        }
+    }
+
+}
+
+
+/**< @brief ビット行列で表した有向グラフAの推移閉包Tを、Warshallのアルゴリズムで求める */
+bit_matrix transitive_closure(const bit_matrix& A)
+{
+    const std::size_t n = A.size();
+    bit_matrix T(A);
+    for (std::size_t i = 0; i < n; ++i) { T.set(i, i); }  // tij^(0) = 1 (i = j)
+
+    // 第k段では第k行は変わらない(tkk = 1なので、第k行に第k行自身をORするだけである)
+    for (std::size_t k = 0; k < n; ++k) {
+        const word_t* tk = T.row(k);
+        for (std::size_t i = 0; i < n; ++i) {
+            if (T.test(i, k)) { or_row(T.row(i), tk, T.stride()); }
+        }
+    }
+    return T;
+}
+
+
+/**
+ * @brief  隣接行列Aで表した有向グラフについて、頂点の対の列queryの到達可能性を答える
+ * @note   問い合わせを始点の順に並べ、同じ始点の問い合わせには1回の探索の結果で答える
+ */
+stamps_t reachable(const bit_matrix& A, const edges_t& query)
+{
+    stamps_t answer(query.size(), false);
+    indices_t order(query.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](index_t a, index_t b) { return query[a].src < query[b].src; });
+
+    std::vector<word_t> seen, frontier, next;
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        const edge& q = query[order[i]];
+        if (i == 0 || query[order[i - 1]].src != q.src) { reach(A, q.src, seen, frontier, next); }
+        answer[order[i]] = (seen[q.dst / bit_matrix::bits] >> (q.dst % bit_matrix::bits)) & 1;
+    }
+    return answer;
+}
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
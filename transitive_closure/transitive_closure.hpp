@@ -0,0 +1,87 @@
+/**
+ * @brief  有向グラフの推移閉包と到達可能性の問い合わせを扱う
+ *
+ * @note   有向グラフG = (V, E)の推移閉包(transitive closure)をグラフG* = (V, E*)と定義する. ただし、
+ *           E* = { (i, j) : Gに頂点iから頂点jへの道が存在する }
+ *         である. 推移閉包を一度求めておけば、「頂点iからjに到達できるか？」という問い合わせにはΟ(1)時間で答えられる
+ *
+ * @note   Floyd-Warshallアルゴリズムの算術演算min, +を論理演算∨, ∧に置き換えると、推移閉包を求めるWarshallのアルゴリズムになる
+ *           tij^(0) = { 1  i = jまたは(i, j) ∈ Eのとき
+ *                       0  それ以外 }
+ *           tij^(k+1) = tij^(k) ∨ (tik^(k) ∧ tkj^(k))
+ *         行列をビット行列(bit_matrix)で表すと、tik = 1の行iについて第k行を第i行にORするだけでよく、1語で64要素をまとめて更新できる
+ *
+ * @date   2026/10/14
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef TRANSITIVE_CLOSURE_HPP
+#define TRANSITIVE_CLOSURE_HPP
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "../graph/graph.hpp"
+#include "../graph/bitmatrix.hpp"
+
+
+
+//****************************************
+// 名前空間の始端
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 関数の宣言
+//****************************************
+
+/**
+ * @brief  ビット行列で表した有向グラフAの推移閉包Tを、Warshallのアルゴリズムで求める
+ *
+ * @note   各kについて、tik = 1の行iに第k行をORする. tik = 0の行は飛ばすので、疎なグラフでは多くの行が更新されない
+ *         ORはAVX2またはAVX-512が使えるときは256ビットまたは512ビットずつ、そうでなければ64ビットずつまとめて計算する
+ *         実行時間はΘ(n^3 / w)である(wはまとめて計算するビット数)
+ *
+ * @note   Tは反射的である(すべてのiについてtii = 1). 頂点iからjへの到達可能性T.test(i, j)は、Ο(1)時間で答えられる
+ *
+ * @param  const bit_matrix& A  隣接行列A
+ * @return 推移閉包T
+ */
+bit_matrix transitive_closure(const bit_matrix& A);
+
+
+
+/**
+ * @brief  隣接行列Aで表した有向グラフについて、頂点の対の列queryの到達可能性を答える
+ *
+ * @note   問い合わせの始点ごとに、フロンティアと既訪問集合をビット列で表した幅優先探索を1回だけ行う(bfs/bfs.hppのbfs(bit_matrix)と同じ手順)
+ *         推移閉包全体を求めるΘ(n^3 / w)時間をかけずに済むので、異なる始点の数が少ない問い合わせに向く
+ *
+ * @param  const bit_matrix& A   隣接行列A
+ * @param  const edges_t& query  問い合わせ(u, v)の列(重みは使わない)
+ * @return answer[i] = 1ならば、query[i]の始点から終点に到達できる
+ */
+stamps_t reachable(const bit_matrix& A, const edges_t& query);
+
+
+
+//****************************************
+// 名前空間の終端
+//****************************************
+
+GRAPH_END
+
+
+
+#endif  // end of TRANSITIVE_CLOSURE_HPP